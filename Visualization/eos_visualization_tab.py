@@ -13,16 +13,33 @@ from PyQt6.QtWidgets import (
     QWidget, QVBoxLayout, QHBoxLayout, QPushButton, QLabel,
     QLineEdit, QComboBox, QTableWidget, QTableWidgetItem,
     QGroupBox, QRadioButton, QButtonGroup, QFileDialog,
-    QMessageBox, QSplitter, QHeaderView, QCompleter, QScrollArea
+    QMessageBox, QSplitter, QHeaderView, QCompleter, QScrollArea, QToolTip
 )
 from PyQt6.QtCore import Qt, QStringListModel
-from PyQt6.QtGui import QFont, QColor
+from PyQt6.QtGui import QFont, QColor, QCursor
 
 from matplotlib.backends.backend_qt5agg import FigureCanvasQTAgg as FigureCanvas
 from matplotlib.backends.backend_qt5agg import NavigationToolbar2QT as NavigationToolbar
 from matplotlib.figure import Figure
+from matplotlib import colormaps
 
 from eos_engine import EOSCalculator
+from physics.isentropes import OffHugoniotEngine, write_family
+
+try:
+    from services.experimental_points import ExperimentalPoints
+    from services.point_inspector import PointInspector
+except ImportError:
+    from Visualization.experimental_points import ExperimentalPoints
+    from Visualization.point_inspector import PointInspector
+
+
+# Plot types drawn from release/reshock families instead of the principal Hugoniot
+OFF_HUGONIOT_PLOTS = [
+    "Release Isentropes (P vs V/Vo)",
+    "Release Isentropes (P vs Up)",
+    "Reshock Hugoniots (P vs V/Vo)"
+]
 
 
 class EOSVisualizationTab(QWidget):
@@ -36,12 +53,14 @@ class EOSVisualizationTab(QWidget):
         super().__init__(parent)
         self.db_manager = db_manager
         self.eos_calculator = EOSCalculator(db_manager)
+        self.off_hugoniot = OffHugoniotEngine()
         
         # Current state
         self.current_material = None
         self.experimental_data = None
         self.theoretical_data = None
         self.current_parameters = None
+        self.off_hugoniot_family = None
         
         self.init_ui()
         self.load_materials_list()
@@ -213,6 +232,12 @@ class EOSVisualizationTab(QWidget):
         self.s_input.setPlaceholderText("Auto-calculated from fit")
         params_layout.addWidget(self.s_input)
         
+        # Grüneisen coefficient (Γ₀)
+        params_layout.addWidget(QLabel("Γ₀ - Grüneisen Coefficient:"))
+        self.gamma0_input = QLineEdit()
+        self.gamma0_input.setPlaceholderText("From database (2s - 1 if blank)")
+        params_layout.addWidget(self.gamma0_input)
+        
         # R² display
         self.r_squared_label = QLabel("R² = N/A")
         self.r_squared_label.setStyleSheet("color: #2980b9; font-weight: bold; font-size: 12px;")
@@ -305,10 +330,17 @@ class EOSVisualizationTab(QWidget):
             "P vs Up",
             "P vs V/Vo",
             "V/Vo vs Up"
-        ])
+        ] + OFF_HUGONIOT_PLOTS)
         self.plot_combo.currentTextChanged.connect(self.update_plot)
         calc_layout.addWidget(self.plot_combo)
         
+        calc_layout.addWidget(QLabel("Release/Reshock from P (GPa):"))
+        self.release_pressures_input = QLineEdit("10, 20, 40, 80")
+        self.release_pressures_input.setToolTip(
+            "Hugoniot pressures of the starting states for release/reshock plots"
+        )
+        calc_layout.addWidget(self.release_pressures_input)
+        
         calc_group.setLayout(calc_layout)
         layout.addWidget(calc_group)
         
@@ -381,6 +413,12 @@ class EOSVisualizationTab(QWidget):
         self.canvas = FigureCanvas(self.figure)
         self.ax = self.figure.add_subplot(111)
         
+        # Hover tooltips for experimental points
+        self.inspector = PointInspector(
+            self.canvas,
+            show=lambda text, event: QToolTip.showText(QCursor.pos(), text, self.canvas),
+            hide=QToolTip.hideText)
+        
         # Toolbar
         self.toolbar = NavigationToolbar(self.canvas, self)
         layout.addWidget(self.toolbar)
@@ -458,19 +496,33 @@ class EOSVisualizationTab(QWidget):
         
         # Get dataset count
         try:
-            datasets = self.eos_calculator.db.get_experimental_datasets(material_name)
-            points = self.eos_calculator.db.get_all_points_for_material(material_name)
-            
+            points = self.load_experimental_points(material_name)
+
             info_text = f"Material: {material_name}\n"
-            info_text += f"Datasets: {len(datasets)} | Data Points: {len(points)}"
+            info_text += f"Datasets: {points.n_datasets} | Data Points: {len(points)}"
             self.material_info_label.setText(info_text)
             
+            self.load_stored_gamma(material_name)
+            
             # Auto-load and calculate parameters
             self.auto_calculate_parameters()
             
         except Exception as e:
             self.material_info_label.setText(f"Error loading material: {e}")
     
+    def load_stored_gamma(self, material_name: str):
+        """Fill Γ₀ from the material's stored EOS/thermomechanical data."""
+        try:
+            from db.query import MaterialQuerier
+            from physics.material_params import get_mie_gruneisen
+            
+            material_data = MaterialQuerier(self.db_manager).get_material_by_name(material_name)
+            gamma = get_mie_gruneisen(material_data)['gamma'] if material_data else None
+        except Exception:
+            gamma = None
+        
+        self.gamma0_input.setText(f"{gamma:.4f}" if gamma else "")
+    
     def update_model_description(self):
         """Update the model description based on current selection"""
         model_name = self.model_combo.currentText()
@@ -550,6 +602,18 @@ class EOSVisualizationTab(QWidget):
         except Exception as e:
             QMessageBox.critical(self, "Calculation Error", f"Failed to calculate parameters: {e}")
     
+    def load_experimental_points(self, material_name: str) -> ExperimentalPoints:
+        """
+        Fetch all experimental points of a material as arrays.
+        
+        Uses the single-query array fetch when the data service provides it,
+        otherwise converts the per-point rows.
+        """
+        db = self.eos_calculator.db
+        if hasattr(db, 'get_experimental_arrays'):
+            return db.get_experimental_arrays(material_name)
+        return ExperimentalPoints.from_records(db.get_all_points_for_material(material_name))
+    
     def get_calculation_mode(self) -> str:
         """Get the selected calculation mode."""
         mode_text = self.mode_combo.currentText()
@@ -577,12 +641,10 @@ class EOSVisualizationTab(QWidget):
             source_id = self.source_group_buttons.checkedId()
             
             # Get experimental data
-            if source_id in [1, 3]:  # Experimental or Both
-                self.experimental_data = self.eos_calculator.db.get_all_points_for_material(
-                    self.current_material
-                )
-            else:
-                self.experimental_data = None
+            experimental = None
+            if source_id in [1, 3] or rho0 is None:
+                experimental = self.load_experimental_points(self.current_material)
+            self.experimental_data = experimental if source_id in [1, 3] else None  # Experimental or Both
             
             # Get theoretical data
             if source_id in [2, 3]:  # Theoretical or Both
@@ -596,10 +658,8 @@ class EOSVisualizationTab(QWidget):
                 
                 # Get rho0 from experimental data if not provided
                 if rho0 is None:
-                    exp_points = self.eos_calculator.db.get_all_points_for_material(
-                        self.current_material
-                    )
-                    rho0 = exp_points[0]['rho0'] if exp_points else None
+                    measured = experimental['rho0'][np.isfinite(experimental['rho0'])]
+                    rho0 = float(measured[0]) if len(measured) else None
                 
                 if rho0 is None:
                     QMessageBox.warning(self, "Missing Density", 
@@ -612,6 +672,7 @@ class EOSVisualizationTab(QWidget):
                 self.current_parameters = {'rho0': rho0, 'C0': C0, 's': s}
             else:
                 self.theoretical_data = None
+            self.off_hugoniot_family = None
             
             # Update plot and table
             self.update_plot()
@@ -625,41 +686,50 @@ class EOSVisualizationTab(QWidget):
     def update_plot(self):
         """Update the matplotlib plot with current data."""
         self.ax.clear()
+        self.inspector.clear()
         
         if self.experimental_data is None and self.theoretical_data is None:
             self.ax.text(0.5, 0.5, 'No data to display\nClick "Generate Visualization"',
                         ha='center', va='center', fontsize=14, color='gray')
-            self.canvas.draw()
+            self.canvas.draw_idle()
             return
         
         plot_type = self.plot_combo.currentText()
         
+        if plot_type in OFF_HUGONIOT_PLOTS:
+            self.plot_off_hugoniot(plot_type)
+            return
+        
         # Plot experimental data
         if self.experimental_data:
-            exp_up = [p['up'] for p in self.experimental_data if p.get('up') is not None]
-            exp_us = [p['us'] for p in self.experimental_data if p.get('us') is not None]
-            exp_p = [p['p'] for p in self.experimental_data if p.get('p') is not None]
-            exp_v = [p['v_over_v0'] for p in self.experimental_data if p.get('v_over_v0') is not None]
-            
+            # Pair columns row-wise so a missing value drops the whole point
+            exp = self.experimental_data
+
             if "Us vs Up" in plot_type:
-                self.ax.scatter(exp_up, exp_us, color='red', marker='x', s=80, 
+                self.ax.scatter(*exp.pair('up', 'us'), color='red', marker='x', s=80,
                               linewidths=2, label='Experimental', zorder=3)
                 xlabel, ylabel = "Up (km/s)", "Us (km/s)"
-                
+
             elif "P vs Up" in plot_type:
-                self.ax.scatter(exp_p, exp_up, color='darkred', marker='o', s=60,
+                self.ax.scatter(*exp.pair('p', 'up'), color='darkred', marker='o', s=60,
                               label='Experimental', zorder=3)
                 xlabel, ylabel = "P (GPa)", "Up (km/s)"
-                
+
             elif "P vs V/Vo" in plot_type:
-                self.ax.scatter(exp_p, exp_v, color='darkblue', marker='s', s=60,
+                self.ax.scatter(*exp.pair('p', 'v_over_v0'), color='darkblue', marker='s', s=60,
                               label='Experimental', zorder=3)
                 xlabel, ylabel = "P (GPa)", "V/V₀"
-                
+
             else:  # V/Vo vs Up
-                self.ax.scatter(exp_up, exp_v, color='darkgreen', marker='^', s=60,
+                self.ax.scatter(*exp.pair('up', 'v_over_v0'), color='darkgreen', marker='^', s=60,
                               label='Experimental', zorder=3)
                 xlabel, ylabel = "Up (km/s)", "V/V₀"
+            
+            columns = {"Us vs Up": ('up', 'us'), "P vs Up": ('p', 'up'), "P vs V/Vo": ('p', 'v_over_v0')}
+            x_col, y_col = next((cols for key, cols in columns.items() if key in plot_type), ('up', 'v_over_v0'))
+            rows = exp.pair_rows(x_col, y_col)
+            self.inspector.add_points(self.ax, exp[x_col][rows], exp[y_col][rows],
+                                      lambda i: exp.describe(rows[i]), name=self.current_material)
         
         # Plot theoretical data
         if self.theoretical_data:
@@ -697,7 +767,70 @@ class EOSVisualizationTab(QWidget):
         self.ax.grid(True, alpha=0.3, linestyle='--')
         
         self.figure.tight_layout()
-        self.canvas.draw()
+        self.canvas.draw_idle()
+    
+    def get_off_hugoniot_family(self, kind: str):
+        """
+        Compute (or fetch cached) release/reshock curves for the current parameters.
+        
+        Args:
+            kind: 'release' or 'reshock'
+        """
+        if not self.current_parameters:
+            raise ValueError("Generate a theoretical Hugoniot first (C₀, s, ρ₀)")
+        
+        params = dict(self.current_parameters)
+        gamma_text = self.gamma0_input.text().strip()
+        params['gamma0'] = float(gamma_text) if gamma_text else 2.0 * params['s'] - 1.0
+        
+        pressures = [float(p) for p in self.release_pressures_input.text().split(',') if p.strip()]
+        if not pressures:
+            raise ValueError("Enter at least one starting pressure")
+        
+        if kind == 'release':
+            return self.off_hugoniot.release(self.current_material, params, pressures=pressures)
+        return self.off_hugoniot.reshock(self.current_material, params, pressures=pressures)
+    
+    def plot_off_hugoniot(self, plot_type: str):
+        """Draw a family of release isentropes or reshock Hugoniots."""
+        kind = 'reshock' if plot_type.startswith("Reshock") else 'release'
+        try:
+            family = self.get_off_hugoniot_family(kind)
+        except ValueError as e:
+            self.ax.text(0.5, 0.5, str(e), ha='center', va='center', fontsize=12, color='gray')
+            self.canvas.draw_idle()
+            return
+        self.off_hugoniot_family = family
+        
+        x_key = 'up' if "P vs Up" in plot_type else 'V_ratio'
+        
+        # Principal Hugoniot for reference
+        if self.theoretical_data:
+            x_ref = self.theoretical_data['Up'] if x_key == 'up' else self.theoretical_data['V_ratio']
+            self.ax.plot(x_ref, self.theoretical_data['P'], 'k-', linewidth=2,
+                        label='Principal Hugoniot', zorder=2)
+        
+        colors = colormaps['viridis'](np.linspace(0.1, 0.9, len(family['start']['P'])))
+        for i, p_start in enumerate(family['start']['P']):
+            self.ax.plot(family[x_key][i], family['P'][i], '--', color=colors[i], linewidth=1.8,
+                        label=f"{kind.title()} from {p_start:.1f} GPa", zorder=3)
+            self.ax.plot(family[x_key][i, 0], p_start, 'o', color=colors[i], zorder=4)
+        
+        p_max = 1.5 * float(np.max(family['start']['P']))
+        self.ax.set_ylim(max(min(float(np.nanmin(family['P'])), 0.0), -0.5 * p_max), p_max)
+        if x_key == 'V_ratio':
+            self.ax.set_xlim(float(np.nanmin(family['V_ratio'])) * 0.98, float(np.nanmax(family['V_ratio'])) * 1.01)
+        self.ax.axhline(0.0, color='gray', linewidth=0.8)
+        
+        self.ax.set_xlabel("Up (km/s)" if x_key == 'up' else "V/V₀", fontsize=12, fontweight='bold')
+        self.ax.set_ylabel("P (GPa)", fontsize=12, fontweight='bold')
+        self.ax.set_title(f"{plot_type} - {self.current_material}",
+                         fontsize=14, fontweight='bold', pad=15)
+        self.ax.legend(loc='best', fontsize=9, framealpha=0.9)
+        self.ax.grid(True, alpha=0.3, linestyle='--')
+        
+        self.figure.tight_layout()
+        self.canvas.draw_idle()
     
     def update_table(self):
         """Update the data table with current results."""
@@ -707,12 +840,12 @@ class EOSVisualizationTab(QWidget):
         
         # Add experimental data
         if self.experimental_data:
-            for point in self.experimental_data:
+            columns = [np.nan_to_num(self.experimental_data[name])
+                       for name in ('up', 'us', 'p', 'v_over_v0')]
+            for values in zip(*columns):
                 self.data_table.insertRow(row)
-                self.data_table.setItem(row, 0, QTableWidgetItem(f"{point.get('up', 0):.4f}"))
-                self.data_table.setItem(row, 1, QTableWidgetItem(f"{point.get('us', 0):.4f}"))
-                self.data_table.setItem(row, 2, QTableWidgetItem(f"{point.get('p', 0):.4f}"))
-                self.data_table.setItem(row, 3, QTableWidgetItem(f"{point.get('v_over_v0', 0):.4f}"))
+                for col, value in enumerate(values):
+                    self.data_table.setItem(row, col, QTableWidgetItem(f"{value:.4f}"))
                 
                 source_item = QTableWidgetItem("Experimental")
                 source_item.setBackground(QColor(255, 200, 200))
@@ -768,6 +901,8 @@ class EOSVisualizationTab(QWidget):
             return
         
         file_filter = "CSV File (*.csv);;XML File (*.xml);;Text File (*.txt)"
+        if self.off_hugoniot_family is not None:
+            file_filter += ";;Release/Reshock Curves CSV (*.csv);;Release/Reshock Curves Parquet (*.parquet)"
         file_path, selected_filter = QFileDialog.getSaveFileName(
             self,
             "Export Data",
@@ -779,7 +914,9 @@ class EOSVisualizationTab(QWidget):
             return
         
         try:
-            if "CSV" in selected_filter or "Text" in selected_filter:
+            if "Release/Reshock" in selected_filter:
+                write_family(self.off_hugoniot_family, file_path)
+            elif "CSV" in selected_filter or "Text" in selected_filter:
                 self.export_csv(file_path)
             elif "XML" in selected_filter:
                 self.export_xml(file_path)
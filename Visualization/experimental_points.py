@@ -0,0 +1,155 @@
+"""
+Columnar Experimental Points
+Contiguous NumPy storage for experimental shock data.
+
+All points of all requested datasets are concatenated per column, ordered
+by dataset and point_order, with an offsets array marking where each
+dataset starts: dataset i is rows offsets[i]:offsets[i+1]. Missing values
+are NaN, so columns stay aligned (a point without P still pairs its Us
+with its Up).
+
+Author: Materials Database Team
+"""
+
+from typing import Dict, List, Optional, Any
+
+import numpy as np
+
+
+# Numeric point columns (experimental_points)
+POINT_COLUMNS = ('rho0', 'us', 'up', 'p', 'v', 'rho', 'v_over_v0')
+
+
+class ExperimentalPoints:
+    """
+    Experimental points for many datasets as contiguous arrays.
+
+    Attributes:
+        datasets: Dataset metadata dictionaries (one per dataset)
+        offsets: int64 array of length n_datasets + 1
+        columns: {column: float64 array of all points}
+        labels: object array of experiment labels
+    """
+
+    COLUMNS = POINT_COLUMNS
+
+    def __init__(self, datasets: List[Dict[str, Any]], offsets, columns: Dict[str, np.ndarray],
+                 labels: Optional[np.ndarray] = None):
+        self.datasets = datasets
+        self.offsets = np.asarray(offsets, dtype=np.int64)
+        self.columns = {name: np.ascontiguousarray(columns.get(name, np.full(self.offsets[-1], np.nan)),
+                                                   dtype=np.float64)
+                        for name in POINT_COLUMNS}
+        self.labels = labels if labels is not None else np.full(self.offsets[-1], None, dtype=object)
+
+    def __len__(self):
+        return int(self.offsets[-1])
+
+    def __getitem__(self, column: str) -> np.ndarray:
+        return self.columns[column]
+
+    def __bool__(self):
+        return len(self) > 0
+
+    @property
+    def n_datasets(self) -> int:
+        return len(self.datasets)
+
+    @property
+    def dataset_index(self) -> np.ndarray:
+        """Dataset index of every point."""
+        return np.repeat(np.arange(self.n_datasets), np.diff(self.offsets))
+
+    def dataset(self, i: int) -> Dict[str, Any]:
+        """Views of one dataset's columns plus its metadata under 'info'."""
+        rows = slice(self.offsets[i], self.offsets[i + 1])
+        data = {name: column[rows] for name, column in self.columns.items()}
+        data['experiment_label'] = self.labels[rows]
+        data['info'] = self.datasets[i]
+        return data
+
+    def pair(self, x: str, y: str):
+        """
+        Aligned (x, y) arrays with rows missing either value removed.
+        """
+        mask = np.isfinite(self.columns[x]) & np.isfinite(self.columns[y])
+        return self.columns[x][mask], self.columns[y][mask]
+
+    def pair_rows(self, x: str, y: str) -> np.ndarray:
+        """Row indices of the points pair(x, y) returns, in the same order."""
+        return np.flatnonzero(np.isfinite(self.columns[x]) & np.isfinite(self.columns[y]))
+
+    def describe(self, row: int) -> str:
+        """Tooltip text for one point: dataset, reference and values."""
+        i = int(np.searchsorted(self.offsets, row, side='right')) - 1
+        info = self.datasets[i]
+        lines = [f"Dataset: {info.get('source_file') or info.get('yaml_filename') or info.get('dataset_id')}"]
+        if info.get('experiment_type'):
+            lines[0] += f" ({info['experiment_type']})"
+        reference = info.get('description') or self.labels[row]
+        if reference:
+            lines.append(f"Reference: {reference}")
+        values = [f"{name} = {self.columns[name][row]:.4g}"
+                  for name in POINT_COLUMNS if np.isfinite(self.columns[name][row])]
+        lines.append(", ".join(values))
+        return "\n".join(lines)
+
+    def by_type(self) -> Dict[str, List[int]]:
+        """Dataset indices grouped by experiment type."""
+        groups = {}
+        for i, info in enumerate(self.datasets):
+            groups.setdefault(info.get('experiment_type'), []).append(i)
+        return groups
+
+    def records(self, i: int) -> List[Dict[str, Any]]:
+        """One dataset as point dictionaries (None for missing values)."""
+        data = self.dataset(i)
+        records = []
+        for k in range(self.offsets[i + 1] - self.offsets[i]):
+            point = {name: (float(data[name][k]) if np.isfinite(data[name][k]) else None)
+                     for name in POINT_COLUMNS}
+            point['experiment_label'] = data['experiment_label'][k]
+            point['dataset_id'] = data['info'].get('dataset_id')
+            records.append(point)
+        return records
+
+    @classmethod
+    def from_aggregated_rows(cls, rows: List[Dict[str, Any]]) -> 'ExperimentalPoints':
+        """
+        Build from one row per dataset whose point columns are arrays
+        (array_agg(... ORDER BY point_order)); other keys become metadata.
+        """
+        counts = [len(row.get('up') or []) for row in rows]
+        offsets = np.concatenate([[0], np.cumsum(counts)]).astype(np.int64)
+
+        columns = {}
+        for name in POINT_COLUMNS:
+            column = np.full(offsets[-1], np.nan)
+            for row, start, end in zip(rows, offsets[:-1], offsets[1:]):
+                if row.get(name):
+                    column[start:end] = np.array(row[name], dtype=np.float64)
+            columns[name] = column
+
+        labels = np.empty(offsets[-1], dtype=object)
+        for row, start, end in zip(rows, offsets[:-1], offsets[1:]):
+            labels[start:end] = row.get('experiment_label') or [None] * (end - start)
+
+        excluded = set(POINT_COLUMNS) | {'experiment_label'}
+        datasets = [{k: v for k, v in row.items() if k not in excluded} for row in rows]
+        return cls(datasets, offsets, columns, labels)
+
+    @classmethod
+    def from_records(cls, points: List[Dict[str, Any]]) -> 'ExperimentalPoints':
+        """
+        Build from point dictionaries (get_experimental_points() rows),
+        grouping consecutive points by dataset_id when present.
+        """
+        points = list(points or [])
+        ids = [p.get('dataset_id') for p in points]
+        starts = [i for i in range(len(points)) if i == 0 or ids[i] != ids[i - 1]]
+        offsets = np.array(starts + [len(points)], dtype=np.int64) if points else np.zeros(1, dtype=np.int64)
+
+        columns = {name: np.array([p.get(name) for p in points], dtype=np.float64) for name in POINT_COLUMNS}
+        labels = np.array([p.get('experiment_label') for p in points], dtype=object)
+        datasets = [{'dataset_id': ids[i]} for i in starts]
+        return cls(datasets, offsets, columns, labels)
@@ -9,6 +9,7 @@ from .base_data_type import BaseDataType
 from .registry import DataTypeRegistry, register_data_type, get_available_data
 from .us_up_experimental import UsUpExperimentalType
 from .us_up_model import UsUpModelType
+from .model_index import XMLModelIndex, get_model_index
 
 __all__ = [
     'BaseDataType',
@@ -17,4 +18,6 @@ __all__ = [
     'get_available_data',
     'UsUpExperimentalType',
     'UsUpModelType',
+    'XMLModelIndex',
+    'get_model_index',
 ]
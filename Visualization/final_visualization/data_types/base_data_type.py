@@ -29,6 +29,8 @@ class BaseDataType(ABC):
         self.name = name
         self.category = category
         self.data_cache = {}
+        # Shared XMLModelIndex (attached by DataTypeRegistry.set_model_index)
+        self.model_index = None
     
     @abstractmethod
     def can_load(self, material_name: str) -> bool:
@@ -94,6 +96,16 @@ class BaseDataType(ABC):
         """
         return f"{self.name} data for {material_name}"
     
+    def availability_version(self):
+        """
+        Marker that changes when can_load() answers may have changed
+        
+        DataTypeRegistry re-probes cached availability when it differs.
+        Defaults to the shared model index listing (files added/removed);
+        None means cached answers hold until DataTypeRegistry.invalidate().
+        """
+        return self.model_index.version if self.model_index is not None else None
+    
     def clear_cache(self):
         """Clear cached data"""
         self.data_cache.clear()
@@ -0,0 +1,226 @@
+"""
+Experimental Data Index
+
+Directory index and binary cache for Us-Up experimental YAML files.
+
+The directory is listed once and re-listed only when its mtime changes
+(adding, removing or renaming a file updates it), so material lookups are
+a prefix search over sorted file names instead of a glob per miss.
+Parsed Up/Us arrays are stored as .npz files keyed by a hash of the YAML
+content; a YAML file is parsed again only when its content changes. The
+most recently used datasets are also kept in memory.
+
+The index is shared by the registry's worker threads: the listing and the
+in-memory cache are guarded by a lock, while YAML parsing runs outside it.
+"""
+
+import hashlib
+import json
+import os
+import threading
+from bisect import bisect_left
+from collections import OrderedDict
+from pathlib import Path
+from typing import Dict, List, Any, Optional
+
+import numpy as np
+import yaml
+
+# libyaml-backed loader when available (several times faster)
+_YAML_LOADER = getattr(yaml, 'CSafeLoader', yaml.SafeLoader)
+
+# Bump when the cached layout changes
+CACHE_VERSION = 1
+
+
+def parse_usup_yaml(data: Any) -> Optional[Dict[str, Any]]:
+    """
+    Extract Up/Us arrays and metadata from a parsed experimental YAML file.
+
+    Supports the current 'points' layout and the older 'Experimental_data'
+    layout. Points missing Up or Us are skipped.
+
+    Args:
+        data: Parsed YAML document
+
+    Returns:
+        {'Up': array, 'Us': array, 'metadata': {...}} or None if the file
+        has no Us-Up data
+    """
+    if not data:
+        return None
+
+    if 'points' in data:
+        points = [p for p in (data['points'] or []) if 'Up' in p and 'Us' in p]
+        if not points:
+            return None
+        metadata = data.get('metadata') or {}
+        return {
+            'Up': np.array([p['Up'] for p in points], dtype=np.float64),
+            'Us': np.array([p['Us'] for p in points], dtype=np.float64),
+            'metadata': {
+                'source': metadata.get('source_file', 'Unknown'),
+                'notes': metadata.get('notes', ''),
+                'material': metadata.get('material_name')
+            }
+        }
+
+    if 'Experimental_data' in data:
+        exp_data = data['Experimental_data']
+        if 'Up' not in exp_data or 'Us' not in exp_data:
+            return None
+        return {
+            'Up': np.array(exp_data['Up'], dtype=np.float64),
+            'Us': np.array(exp_data['Us'], dtype=np.float64),
+            'metadata': {
+                'source': exp_data.get('Source', 'Unknown'),
+                'notes': exp_data.get('Notes', '')
+            }
+        }
+
+    return None
+
+
+class ExperimentalDataIndex:
+    """
+    Material -> YAML file index with an .npz cache of parsed datasets.
+
+    Usage:
+        index = ExperimentalDataIndex(Path("Experimental_data"))
+        for path in index.files_for("Copper"):
+            dataset = index.load(path)
+    """
+
+    # Parsed datasets kept in memory (least recently used are dropped)
+    MEMORY_LIMIT = 256
+
+    def __init__(self, data_path: Path, cache_dir: Optional[Path] = None):
+        """
+        Args:
+            data_path: Directory containing the experimental YAML files
+            cache_dir: Where .npz files are written (default: data_path/.cache)
+        """
+        self.data_path = Path(data_path)
+        self.cache_dir = Path(cache_dir) if cache_dir else self.data_path / ".cache"
+        self._lock = threading.RLock()
+        self._dir_mtime = None
+        self._names: List[str] = []        # file names sorted by name
+        self._lower: List[tuple] = []      # (lowercase name, name) sorted
+        self._memory: 'OrderedDict[str, Optional[Dict[str, Any]]]' = OrderedDict()  # content hash -> dataset
+        self.parse_count = 0
+
+    def _refresh(self):
+        """Re-list the directory if it changed since the last listing (caller holds the lock)."""
+        try:
+            mtime = os.stat(self.data_path).st_mtime_ns
+        except OSError:
+            self._dir_mtime, self._names, self._lower = None, [], []
+            return
+        if mtime == self._dir_mtime:
+            return
+
+        with os.scandir(self.data_path) as entries:
+            names = [e.name for e in entries if e.name.endswith('.yaml') and e.is_file()]
+        self._names, self._lower = sorted(names), sorted((name.lower(), name) for name in names)
+        self._dir_mtime = mtime
+
+    @property
+    def version(self):
+        """Changes whenever the directory listing changes."""
+        with self._lock:
+            self._refresh()
+            return self._dir_mtime
+
+    def files_for(self, material_name: str) -> List[Path]:
+        """
+        YAML files for a material (file name starts with the material name).
+
+        An exact-case prefix match is preferred; a case-insensitive match is
+        used when there is none.
+        """
+        with self._lock:
+            self._refresh()
+            names, lower = self._names, self._lower
+
+        matches = []
+        i = bisect_left(names, material_name)
+        while i < len(names) and names[i].startswith(material_name):
+            matches.append(names[i])
+            i += 1
+
+        if not matches:
+            prefix = material_name.lower()
+            i = bisect_left(lower, (prefix, ''))
+            while i < len(lower) and lower[i][0].startswith(prefix):
+                matches.append(lower[i][1])
+                i += 1
+
+        return [self.data_path / name for name in matches]
+
+    def has_material(self, material_name: str) -> bool:
+        return bool(self.files_for(material_name))
+
+    def load(self, path: Path) -> Optional[Dict[str, Any]]:
+        """
+        Parsed Us-Up dataset of one YAML file, from cache when unchanged.
+
+        Args:
+            path: YAML file path
+
+        Returns:
+            Dataset dictionary (see parse_usup_yaml) or None
+        """
+        raw = Path(path).read_bytes()
+        key = hashlib.blake2b(raw, digest_size=16, key=str(CACHE_VERSION).encode()).hexdigest()
+
+        with self._lock:
+            if key in self._memory:
+                self._memory.move_to_end(key)
+                return self._memory[key]
+
+        # Parsed outside the lock; two threads may occasionally parse the same file
+        dataset = self._read_cache(key)
+        if dataset is None and not self._has_cache_marker(key):
+            with self._lock:
+                self.parse_count += 1
+            dataset = parse_usup_yaml(yaml.load(raw, Loader=_YAML_LOADER))
+            self._write_cache(key, dataset)
+
+        with self._lock:
+            self._memory[key] = dataset
+            self._memory.move_to_end(key)
+            while len(self._memory) > self.MEMORY_LIMIT:
+                self._memory.popitem(last=False)
+        return dataset
+
+    def _cache_file(self, key: str) -> Path:
+        return self.cache_dir / f"{key}.npz"
+
+    def _has_cache_marker(self, key: str) -> bool:
+        """Files without Us-Up data are cached as an empty marker."""
+        return (self.cache_dir / f"{key}.none").exists()
+
+    def _read_cache(self, key: str) -> Optional[Dict[str, Any]]:
+        try:
+            with np.load(self._cache_file(key), allow_pickle=False) as npz:
+                return {
+                    'Up': npz['Up'],
+                    'Us': npz['Us'],
+                    'metadata': json.loads(str(npz['metadata']))
+                }
+        except (OSError, KeyError, ValueError):
+            return None
+
+    def _write_cache(self, key: str, dataset: Optional[Dict[str, Any]]):
+        """Write atomically; an unwritable cache directory only disables caching."""
+        try:
+            self.cache_dir.mkdir(parents=True, exist_ok=True)
+            if dataset is None:
+                (self.cache_dir / f"{key}.none").touch()
+                return
+            tmp = self.cache_dir / f"{key}.{os.getpid()}.tmp.npz"
+            np.savez(tmp, Up=dataset['Up'], Us=dataset['Us'],
+                     metadata=np.array(json.dumps(dataset['metadata'], default=str)))
+            os.replace(tmp, self._cache_file(key))
+        except OSError as e:
+            print(f"[UsUpExp] ⚠ Cache write failed: {e}")
@@ -0,0 +1,174 @@
+"""
+XML Model Index
+
+Shared, thread-safe index of the model-parameter XML files.
+
+Each file is parsed once into a ModelEntry holding its Property parameter
+lists and Model parameter lists, keyed by lowercase material name, so data
+types look materials up in O(1) instead of globbing and re-parsing. The
+directory is re-listed when its mtime changes; a file is re-parsed only
+when its mtime/size changed and its content hash differs.
+"""
+
+import hashlib
+import os
+import threading
+import xml.etree.ElementTree as ET
+from dataclasses import dataclass, field
+from pathlib import Path
+from typing import Dict, List, Optional, Tuple
+
+
+@dataclass
+class ModelEntry:
+    """Parameters of one material XML file."""
+    material: str
+    path: Path
+    stamp: Tuple[int, int]
+    content_hash: str
+    # (property name, [(parameter name, text), ...]) from Property/Parameters/Parameter
+    properties: List[Tuple[str, List[Tuple[str, str]]]] = field(default_factory=list)
+    # (model type, [(parameter name, text), ...]) from all Parameters below a Model
+    models: List[Tuple[str, List[Tuple[str, str]]]] = field(default_factory=list)
+    error: Optional[str] = None
+
+    def property_names(self) -> List[str]:
+        return [name for name, _ in self.properties]
+
+    def model_types(self) -> List[str]:
+        return [model_type for model_type, _ in self.models]
+
+
+def _parse_entry(path: Path, raw: bytes, stamp, content_hash: str) -> ModelEntry:
+    """Parse one XML document into a ModelEntry (errors are recorded, not raised)."""
+    entry = ModelEntry(material=path.stem, path=path, stamp=stamp, content_hash=content_hash)
+    try:
+        root = ET.fromstring(raw)
+    except ET.ParseError as e:
+        entry.error = str(e)
+        return entry
+
+    for prop in root.iter('Property'):
+        params = prop.find('Parameters')
+        values = [] if params is None else [
+            (param.get('name', ''), param.text) for param in params.findall('Parameter')
+        ]
+        entry.properties.append((prop.get('name', ''), values))
+
+    for model in root.iter('Model'):
+        values = [(param.get('name'), param.text) for param in model.iter('Parameter')]
+        entry.models.append((model.get('type', ''), values))
+
+    return entry
+
+
+class XMLModelIndex:
+    """
+    Material -> ModelEntry index over a directory of XML files.
+
+    Usage:
+        index = get_model_index(Path("XML_Finalized_Structure"))
+        entry = index.get("Copper")
+        if entry and 'Shock_Hugoniot' in entry.property_names():
+            ...
+    """
+
+    def __init__(self, xml_path: Path):
+        self.xml_path = Path(xml_path)
+        self._lock = threading.RLock()
+        self._dir_mtime = None
+        self._paths: Dict[str, Path] = {}        # lowercase stem -> path
+        self._entries: Dict[str, ModelEntry] = {}
+        self.parse_count = 0
+
+    def _refresh_listing(self):
+        try:
+            mtime = os.stat(self.xml_path).st_mtime_ns
+        except OSError:
+            self._dir_mtime, self._paths = None, {}
+            return
+        if mtime == self._dir_mtime:
+            return
+
+        paths = {}
+        with os.scandir(self.xml_path) as entries:
+            for e in sorted(entries, key=lambda e: e.name):
+                if e.name.endswith('.xml') and e.is_file():
+                    # Exact-case names win over other spellings of the same stem
+                    paths.setdefault(Path(e.name).stem.lower(), self.xml_path / e.name)
+        self._paths = paths
+        self._entries = {k: v for k, v in self._entries.items() if k in paths}
+        self._dir_mtime = mtime
+
+    def _load(self, key: str, path: Path) -> Optional[ModelEntry]:
+        try:
+            st = path.stat()
+        except OSError:
+            return None
+        stamp = (st.st_mtime_ns, st.st_size)
+
+        entry = self._entries.get(key)
+        if entry is not None and entry.path == path and entry.stamp == stamp:
+            return entry
+
+        raw = path.read_bytes()
+        content_hash = hashlib.blake2b(raw, digest_size=16).hexdigest()
+        if entry is not None and entry.path == path and entry.content_hash == content_hash:
+            entry.stamp = stamp
+            return entry
+
+        self.parse_count += 1
+        entry = _parse_entry(path, raw, stamp, content_hash)
+        if entry.error:
+            print(f"[ModelIndex] Error parsing {path}: {entry.error}")
+        self._entries[key] = entry
+        return entry
+
+    def build(self) -> 'XMLModelIndex':
+        """Parse every file in one pass (subsequent lookups are dictionary hits)."""
+        with self._lock:
+            self._refresh_listing()
+            for key, path in self._paths.items():
+                self._load(key, path)
+        return self
+
+    def get(self, material_name: str) -> Optional[ModelEntry]:
+        """
+        Entry for a material (case-insensitive, exact-case file preferred).
+
+        Returns:
+            ModelEntry or None if there is no XML file for the material
+        """
+        with self._lock:
+            self._refresh_listing()
+            key = material_name.lower()
+            path = self._paths.get(key)
+            exact = self.xml_path / f"{material_name}.xml"
+            if path is not None and path.name != exact.name and exact.exists():
+                path = exact
+            return self._load(key, path) if path is not None else None
+
+    def materials(self) -> List[str]:
+        with self._lock:
+            self._refresh_listing()
+            return [path.stem for path in self._paths.values()]
+
+    @property
+    def version(self):
+        """Changes whenever the directory listing changes."""
+        with self._lock:
+            self._refresh_listing()
+            return self._dir_mtime
+
+
+_shared: Dict[Path, XMLModelIndex] = {}
+_shared_lock = threading.Lock()
+
+
+def get_model_index(xml_path: Path) -> XMLModelIndex:
+    """Shared index for a directory (one per resolved path)."""
+    key = Path(xml_path).resolve()
+    with _shared_lock:
+        if key not in _shared:
+            _shared[key] = XMLModelIndex(key)
+        return _shared[key]
@@ -3,9 +3,20 @@ Data Type Registry - Plugin system for extensible data types
 
 This registry allows automatic discovery and management of all data types.
 New data types can be added without modifying core code.
+
+Availability probes and data loads run on a shared thread pool: probing a
+material checks every data type concurrently and is cached, and
+load_data_async() and probe_async() return futures so the UI thread never
+waits on disk or database access. The per-type can_load() checks of a probe
+run on their own pool (a probe running on the shared pool would otherwise
+block on children queued behind it), and prefetches run on a small
+low-priority pool so they never hold up loads the user is waiting for.
 """
 
-from typing import Dict, List, Type, Optional
+import os
+import threading
+from concurrent.futures import Future, ThreadPoolExecutor
+from typing import Callable, Dict, List, Type, Optional
 from .base_data_type import BaseDataType
 
 
@@ -25,6 +36,21 @@ class DataTypeRegistry:
     """
     
     _registry: Dict[str, BaseDataType] = {}
+    _model_index = None
+    
+    # Thread pools and caches shared by probes, loads and prefetches
+    _executor: Optional[ThreadPoolExecutor] = None           # loads and probe_async()
+    _probe_executor: Optional[ThreadPoolExecutor] = None     # per-type can_load() checks
+    _prefetch_executor: Optional[ThreadPoolExecutor] = None  # background prefetches
+    _lock = threading.RLock()
+    _availability: Dict[tuple, tuple] = {}     # (type key, material) -> (version, can_load)
+    _pending: Dict[tuple, Future] = {}         # (type key, material) -> in-flight load
+    _prefetches: set = set()                   # futures in _pending queued by prefetch()
+    
+    # Materials prefetched at most per call
+    PREFETCH_LIMIT = 20
+    # Prefetch workers (kept low so prefetching never competes with real loads)
+    PREFETCH_WORKERS = 2
     
     @classmethod
     def register(cls, data_type: BaseDataType):
@@ -35,9 +61,27 @@ class DataTypeRegistry:
             data_type: Instance of BaseDataType subclass
         """
         key = f"{data_type.category}:{data_type.name}"
+        if data_type.model_index is None:
+            data_type.model_index = cls._model_index
         cls._registry[key] = data_type
         print(f"[Registry] ✓ Registered: {key}")
     
+    @classmethod
+    def set_model_index(cls, model_index):
+        """
+        Share a parsed XML model index with all data types
+        
+        Types registered without their own index (now or later) query
+        this one instead of parsing XML files themselves.
+        
+        Args:
+            model_index: XMLModelIndex instance
+        """
+        cls._model_index = model_index
+        for data_type in cls._registry.values():
+            if data_type.model_index is None:
+                data_type.model_index = model_index
+    
     @classmethod
     def unregister(cls, category: str, name: str):
         """Unregister a data type"""
@@ -75,30 +119,214 @@ class DataTypeRegistry:
         """Get all unique categories"""
         return list(set(dt.category for dt in cls._registry.values()))
     
+    @classmethod
+    def _get_executor(cls) -> ThreadPoolExecutor:
+        with cls._lock:
+            if cls._executor is None:
+                cls._executor = ThreadPoolExecutor(
+                    max_workers=min(8, (os.cpu_count() or 1) + 4),
+                    thread_name_prefix="datatype"
+                )
+            return cls._executor
+    
+    @classmethod
+    def _get_probe_executor(cls) -> ThreadPoolExecutor:
+        with cls._lock:
+            if cls._probe_executor is None:
+                cls._probe_executor = ThreadPoolExecutor(
+                    max_workers=min(8, (os.cpu_count() or 1) + 4),
+                    thread_name_prefix="datatype-probe"
+                )
+            return cls._probe_executor
+    
+    @classmethod
+    def _get_prefetch_executor(cls) -> ThreadPoolExecutor:
+        with cls._lock:
+            if cls._prefetch_executor is None:
+                cls._prefetch_executor = ThreadPoolExecutor(
+                    max_workers=cls.PREFETCH_WORKERS,
+                    thread_name_prefix="datatype-prefetch"
+                )
+            return cls._prefetch_executor
+    
+    @staticmethod
+    def _version(data_type: BaseDataType):
+        try:
+            return data_type.availability_version()
+        except Exception:
+            return None
+    
+    @classmethod
+    def _is_cached(cls, key: str, data_type: BaseDataType, material_name: str) -> bool:
+        cached = cls._availability.get((key, material_name))
+        return cached is not None and cached[0] == cls._version(data_type)
+    
+    @classmethod
+    def _can_load(cls, key: str, data_type: BaseDataType, material_name: str) -> bool:
+        """
+        Cached can_load (a failing probe counts as unavailable)
+        
+        Answers are re-probed when the type's availability_version()
+        changes, e.g. when experimental files are added or removed.
+        """
+        cache_key = (key, material_name)
+        version = cls._version(data_type)
+        cached = cls._availability.get(cache_key)
+        if cached is not None and cached[0] == version:
+            return cached[1]
+        try:
+            available = bool(data_type.can_load(material_name))
+        except Exception as e:
+            print(f"[Registry] ✗ {key} probe failed for {material_name}: {e}")
+            available = False
+        cls._availability[cache_key] = (version, available)
+        return available
+    
     @classmethod
     def get_available_for_material(cls, material_name: str) -> Dict[str, List[BaseDataType]]:
         """
         Get all available data types for a material, grouped by category
         
+        Uncached data types are probed concurrently on the probe pool;
+        results are cached until the type's availability_version() changes
+        or invalidate() is called. Blocks until every
+        probe finished, so UI code should use probe_async() instead.
+        
         Args:
             material_name: Material to check
             
         Returns:
-            Dictionary: {category: [data_types]}
+            Dictionary: {category: [data_types]} in registration order
         """
+        types = list(cls._registry.items())
+        uncached = [(key, dt) for key, dt in types if not cls._is_cached(key, dt, material_name)]
+        
+        if len(uncached) > 1:
+            executor = cls._get_probe_executor()
+            futures = [executor.submit(cls._can_load, key, dt, material_name) for key, dt in uncached]
+            for future in futures:
+                future.result()
+        
         result = {}
-        for data_type in cls._registry.values():
-            if data_type.can_load(material_name):
-                category = data_type.category
-                if category not in result:
-                    result[category] = []
-                result[category].append(data_type)
+        for key, data_type in types:
+            if cls._can_load(key, data_type, material_name):
+                result.setdefault(data_type.category, []).append(data_type)
         return result
     
+    @classmethod
+    def probe_async(cls, material_name: str) -> Future:
+        """
+        Future resolving to get_available_for_material(material_name)
+        
+        The probe's can_load() checks run on the probe pool, so the worker
+        waiting on them never starves the shared pool.
+        """
+        return cls._get_executor().submit(cls.get_available_for_material, material_name)
+    
+    @classmethod
+    def load_data_async(cls, data_type: BaseDataType, material_name: str) -> Future:
+        """
+        Load a material's data on the thread pool
+        
+        Concurrent requests for the same type and material share one load.
+        A prefetch of the same load that has not started yet is moved to
+        the shared pool instead of being waited for. The future resolves to
+        load_data()'s result, or None when the data type has no data for
+        the material.
+        
+        Args:
+            data_type: Registered data type
+            material_name: Material name
+        """
+        return cls._submit_load(data_type, material_name, prefetch=False)
+    
+    @classmethod
+    def _submit_load(cls, data_type: BaseDataType, material_name: str, prefetch: bool) -> Future:
+        key = f"{data_type.category}:{data_type.name}"
+        with cls._lock:
+            pending = cls._pending.get((key, material_name))
+            if pending is not None:
+                if prefetch or pending not in cls._prefetches or not pending.cancel():
+                    return pending
+            
+            def load():
+                if not cls._can_load(key, data_type, material_name):
+                    return None
+                return data_type.load_data(material_name)
+            
+            executor = cls._get_prefetch_executor() if prefetch else cls._get_executor()
+            future = executor.submit(load)
+            cls._pending[(key, material_name)] = future
+            if prefetch:
+                cls._prefetches.add(future)
+        
+        def done(_):
+            with cls._lock:
+                cls._prefetches.discard(future)
+                if cls._pending.get((key, material_name)) is future:
+                    del cls._pending[(key, material_name)]
+        future.add_done_callback(done)
+        return future
+    
+    @classmethod
+    def when_all(cls, futures: List[Future], callback: Callable[[List], None]):
+        """
+        Call callback(results) once every future is done (on the thread
+        that completes the last one; failed futures give None)
+        """
+        remaining = [len(futures)]
+        lock = threading.Lock()
+        
+        def done(_):
+            with lock:
+                remaining[0] -= 1
+                if remaining[0]:
+                    return
+            callback([None if f.exception() else f.result() for f in futures])
+        
+        if not futures:
+            callback([])
+        for future in futures:
+            future.add_done_callback(done)
+    
+    @classmethod
+    def prefetch(cls, material_names: List[str]):
+        """
+        Warm availability and data caches for materials likely to be used
+        next (recent selections, search results). Returns immediately; the
+        loads run on the low-priority prefetch pool.
+        """
+        for material_name in list(dict.fromkeys(material_names))[:cls.PREFETCH_LIMIT]:
+            for data_type in cls._registry.values():
+                cls._submit_load(data_type, material_name, prefetch=True)
+    
+    @classmethod
+    def invalidate(cls, material_name: Optional[str] = None):
+        """Forget cached availability (for one material or all)"""
+        with cls._lock:
+            if material_name is None:
+                cls._availability.clear()
+            else:
+                for cache_key in [k for k in cls._availability if k[1] == material_name]:
+                    del cls._availability[cache_key]
+    
+    @classmethod
+    def shutdown(cls):
+        """Stop the thread pools (pending loads are cancelled)"""
+        with cls._lock:
+            for name in ('_executor', '_probe_executor', '_prefetch_executor'):
+                executor = getattr(cls, name)
+                if executor is not None:
+                    executor.shutdown(wait=False, cancel_futures=True)
+                    setattr(cls, name, None)
+            cls._pending.clear()
+            cls._prefetches.clear()
+    
     @classmethod
     def clear(cls):
         """Clear all registered types (useful for testing)"""
         cls._registry.clear()
+        cls.invalidate()
         print("[Registry] ✓ Cleared")
     
     @classmethod
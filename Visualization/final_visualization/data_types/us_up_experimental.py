@@ -6,10 +6,10 @@ Handles loading and displaying Us-Up experimental data from YAML files.
 
 from pathlib import Path
 from typing import Dict, List, Any, Optional
-import yaml
 from PyQt6.QtWidgets import QWidget, QVBoxLayout, QLabel, QTreeWidget, QTreeWidgetItem
 
 from .base_data_type import BaseDataType
+from .experimental_index import ExperimentalDataIndex
 
 
 class UsUpExperimentalType(BaseDataType):
@@ -19,88 +19,75 @@ class UsUpExperimentalType(BaseDataType):
     This loads shock physics data in the format:
     - Up (particle velocity)
     - Us (shock velocity)
+    
+    File lookup goes through a directory index and parsed arrays through
+    an .npz cache, so YAML is only parsed when a file changes.
     """
     
-    def __init__(self, experimental_data_path: Path):
+    def __init__(self, experimental_data_path: Path, cache_dir: Optional[Path] = None):
         super().__init__(name="Us-Up Experiment", category="experimental")
         self.data_path = experimental_data_path
+        self.index = ExperimentalDataIndex(experimental_data_path, cache_dir)
         self._available_cache = {}
+        self._available_version = None
+        self._data_stamps = {}
         print(f"[UsUpExp] Initialized with path: {experimental_data_path}")
     
     def can_load(self, material_name: str) -> bool:
         """Check if Us-Up data exists for material"""
-        if material_name in self._available_cache:
-            return self._available_cache[material_name]
-        
-        # Search for YAML files matching material
-        pattern = f"{material_name}*.yaml"
-        files = list(self.data_path.glob(pattern))
-        
-        # Also check case-insensitive
-        if not files:
-            pattern_lower = f"{material_name.lower()}*.yaml"
-            files = [f for f in self.data_path.glob("*.yaml") 
-                    if f.stem.lower().startswith(material_name.lower())]
+        # Availability answers stay valid until the directory listing changes
+        if self.index.version != self._available_version:
+            self._available_cache.clear()
+            self._available_version = self.index.version
         
-        available = len(files) > 0
-        self._available_cache[material_name] = available
+        if material_name not in self._available_cache:
+            self._available_cache[material_name] = self.index.has_material(material_name)
         
-        return available
+        return self._available_cache[material_name]
+    
+    def availability_version(self):
+        """Experimental files are added or removed when the directory listing changes"""
+        return self.index.version
+    
+    def _stamp(self, files: List[Path]):
+        """Cheap change marker for a material's files (name, mtime, size)."""
+        stamp = []
+        for path in files:
+            try:
+                st = path.stat()
+                stamp.append((path.name, st.st_mtime_ns, st.st_size))
+            except OSError:
+                stamp.append((path.name, None, None))
+        return tuple(stamp)
     
     def load_data(self, material_name: str) -> Dict[str, Any]:
         """Load all Us-Up datasets for material"""
-        if material_name in self.data_cache:
+        yaml_files = self.index.files_for(material_name)
+        stamp = self._stamp(yaml_files)
+        
+        if material_name in self.data_cache and self._data_stamps.get(material_name) == stamp:
             return self.data_cache[material_name]
         
         datasets = []
-        pattern = f"{material_name}*.yaml"
-        
-        # Find matching files
-        yaml_files = list(self.data_path.glob(pattern))
-        if not yaml_files:
-            yaml_files = [f for f in self.data_path.glob("*.yaml") 
-                         if f.stem.lower().startswith(material_name.lower())]
-        
         for yaml_file in yaml_files:
             try:
-                with open(yaml_file, 'r') as f:
-                    data = yaml.safe_load(f)
-                    
-                # Check for 'points' structure (current format)
-                if data and 'points' in data:
-                    points = data['points']
-                    if points and len(points) > 0:
-                        # Extract Us and Up from points
-                        Up_values = [p.get('Up', 0.0) for p in points if 'Up' in p and 'Us' in p]
-                        Us_values = [p.get('Us', 0.0) for p in points if 'Up' in p and 'Us' in p]
-                        
-                        if Up_values and Us_values:
-                            datasets.append({
-                                'file': yaml_file.name,
-                                'Up': Up_values,
-                                'Us': Us_values,
-                                'metadata': {
-                                    'source': data.get('metadata', {}).get('source_file', 'Unknown'),
-                                    'notes': data.get('metadata', {}).get('notes', ''),
-                                    'material': data.get('metadata', {}).get('material_name', material_name)
-                                }
-                            })
-                
-                # Fallback: Check old 'Experimental_data' structure
-                elif data and 'Experimental_data' in data:
-                    exp_data = data['Experimental_data']
-                    if 'Up' in exp_data and 'Us' in exp_data:
-                        datasets.append({
-                            'file': yaml_file.name,
-                            'Up': exp_data['Up'],
-                            'Us': exp_data['Us'],
-                            'metadata': {
-                                'source': exp_data.get('Source', 'Unknown'),
-                                'notes': exp_data.get('Notes', '')
-                            }
-                        })
+                parsed = self.index.load(yaml_file)
             except Exception as e:
                 print(f"[UsUpExp] Error loading {yaml_file}: {e}")
+                continue
+            
+            if parsed is None or len(parsed['Up']) == 0:
+                continue
+            
+            metadata = dict(parsed['metadata'])
+            if 'material' in metadata and not metadata['material']:
+                metadata['material'] = material_name
+            datasets.append({
+                'file': yaml_file.name,
+                'Up': parsed['Up'],
+                'Us': parsed['Us'],
+                'metadata': metadata
+            })
         
         result = {
             'material': material_name,
@@ -109,6 +96,7 @@ class UsUpExperimentalType(BaseDataType):
         }
         
         self.data_cache[material_name] = result
+        self._data_stamps[material_name] = stamp
         return result
     
     def get_plot_data(self, material_name: str) -> Dict[str, Any]:
@@ -7,11 +7,51 @@ Linear model: Us = C0 + S * Up
 
 from pathlib import Path
 from typing import Dict, List, Any, Optional
-import xml.etree.ElementTree as ET
 import numpy as np
 from PyQt6.QtWidgets import QWidget, QVBoxLayout, QLabel, QFormLayout
 
 from .base_data_type import BaseDataType
+from .model_index import ModelEntry, get_model_index
+
+# Property names that mark a Us-Up model
+USUP_PROPERTIES = ('Us_Up', 'UsUp', 'Shock_Hugoniot')
+
+
+def has_usup_model(entry: ModelEntry) -> bool:
+    """Check a parsed XML entry for a Us-Up model"""
+    if any(name in USUP_PROPERTIES for name in entry.property_names()):
+        return True
+    return any('usup' in model_type.lower() for model_type in entry.model_types())
+
+
+def extract_usup_parameters(entry: ModelEntry) -> Dict[str, Any]:
+    """Collect C0/S (or Us-Up model parameters) from a parsed XML entry"""
+    parameters = {}
+    
+    # Try to find C0 and S parameters
+    for prop_name, params in entry.properties:
+        if 'C0' in prop_name or 'c0' in prop_name.lower():
+            for name, value in params:
+                if 'C0' in name:
+                    parameters['C0'] = float(value)
+        
+        if 'S' in prop_name or 'slope' in prop_name.lower():
+            for name, value in params:
+                if name == 'S':
+                    parameters['S'] = float(value)
+    
+    # If not found, try alternative structure
+    if not parameters:
+        for model_type, params in entry.models:
+            if 'usup' in model_type.lower():
+                for name, value in params:
+                    if name and value:
+                        try:
+                            parameters[name] = float(value)
+                        except ValueError:
+                            parameters[name] = value
+    
+    return parameters
 
 
 class UsUpModelType(BaseDataType):
@@ -22,123 +62,57 @@ class UsUpModelType(BaseDataType):
     - C0: Bulk sound speed
     - S: Slope parameter
     - For linear Us-Up relation: Us = C0 + S*Up
+    
+    XML files are read through the shared XMLModelIndex, so each file is
+    parsed once and lookups are dictionary hits.
     """
     
     def __init__(self, xml_models_path: Path):
         super().__init__(name="Us-Up Model", category="model")
         self.xml_path = xml_models_path
+        self.model_index = get_model_index(xml_models_path)
         self._available_cache = {}
         print(f"[UsUpModel] Initialized with path: {xml_models_path}")
     
     def can_load(self, material_name: str) -> bool:
         """Check if Us-Up model exists for material"""
-        if material_name in self._available_cache:
-            return self._available_cache[material_name]
-        
-        # Look for XML file
-        xml_file = self.xml_path / f"{material_name}.xml"
-        if not xml_file.exists():
-            # Try case-insensitive
-            xml_files = [f for f in self.xml_path.glob("*.xml") 
-                        if f.stem.lower() == material_name.lower()]
-            xml_file = xml_files[0] if xml_files else None
-        
-        if not xml_file or not xml_file.exists():
-            self._available_cache[material_name] = False
+        entry = self.model_index.get(material_name)
+        if entry is None or entry.error:
             return False
         
-        # Check if Us-Up model exists in XML
-        try:
-            tree = ET.parse(xml_file)
-            root = tree.getroot()
-            
-            # Look for Us-Up model in various locations
-            has_usup = False
-            
-            # Check in Properties
-            for prop in root.findall('.//Property'):
-                if prop.get('name') in ['Us_Up', 'UsUp', 'Shock_Hugoniot']:
-                    has_usup = True
-                    break
-            
-            # Check in Models section
-            if not has_usup:
-                for model in root.findall('.//Model'):
-                    if 'usup' in model.get('type', '').lower():
-                        has_usup = True
-                        break
-            
-            self._available_cache[material_name] = has_usup
-            return has_usup
-            
-        except Exception as e:
-            print(f"[UsUpModel] Error checking {xml_file}: {e}")
-            self._available_cache[material_name] = False
-            return False
+        # Cached per file content, so edited files are re-checked
+        cached = self._available_cache.get(material_name)
+        if cached is None or cached[0] != entry.content_hash:
+            cached = (entry.content_hash, has_usup_model(entry))
+            self._available_cache[material_name] = cached
+        return cached[1]
     
     def load_data(self, material_name: str) -> Dict[str, Any]:
         """Load Us-Up model parameters"""
-        if material_name in self.data_cache:
-            return self.data_cache[material_name]
-        
-        xml_file = self.xml_path / f"{material_name}.xml"
-        if not xml_file.exists():
-            xml_files = [f for f in self.xml_path.glob("*.xml") 
-                        if f.stem.lower() == material_name.lower()]
-            xml_file = xml_files[0] if xml_files else None
-        
-        if not xml_file:
+        entry = self.model_index.get(material_name)
+        if entry is None or entry.error:
             return {'material': material_name, 'parameters': {}, 'found': False}
         
+        cached = self.data_cache.get(material_name)
+        if cached is not None and cached.get('content_hash') == entry.content_hash:
+            return cached
+        
         try:
-            tree = ET.parse(xml_file)
-            root = tree.getroot()
-            
-            parameters = {}
-            
-            # Try to find C0 and S parameters
-            for prop in root.findall('.//Property'):
-                prop_name = prop.get('name', '')
-                if 'C0' in prop_name or 'c0' in prop_name.lower():
-                    params = prop.find('Parameters')
-                    if params is not None:
-                        for param in params.findall('Parameter'):
-                            if 'C0' in param.get('name', ''):
-                                parameters['C0'] = float(param.text)
-                
-                if 'S' in prop_name or 'slope' in prop_name.lower():
-                    params = prop.find('Parameters')
-                    if params is not None:
-                        for param in params.findall('Parameter'):
-                            if param.get('name') == 'S':
-                                parameters['S'] = float(param.text)
-            
-            # If not found, try alternative structure
-            if not parameters:
-                for model in root.findall('.//Model'):
-                    if 'usup' in model.get('type', '').lower():
-                        for param in model.findall('.//Parameter'):
-                            name = param.get('name')
-                            value = param.text
-                            if name and value:
-                                try:
-                                    parameters[name] = float(value)
-                                except:
-                                    parameters[name] = value
-            
-            result = {
-                'material': material_name,
-                'parameters': parameters,
-                'found': len(parameters) > 0,
-                'model_type': 'Linear' if 'C0' in parameters and 'S' in parameters else 'Unknown'
-            }
-            
-            self.data_cache[material_name] = result
-            return result
-            
-        except Exception as e:
-            print(f"[UsUpModel] Error loading {xml_file}: {e}")
+            parameters = extract_usup_parameters(entry)
+        except (TypeError, ValueError) as e:
+            print(f"[UsUpModel] Error loading {entry.path}: {e}")
             return {'material': material_name, 'parameters': {}, 'found': False}
+        
+        result = {
+            'material': material_name,
+            'parameters': parameters,
+            'found': len(parameters) > 0,
+            'model_type': 'Linear' if 'C0' in parameters and 'S' in parameters else 'Unknown',
+            'content_hash': entry.content_hash
+        }
+        
+        self.data_cache[material_name] = result
+        return result
     
     def get_plot_data(self, material_name: str) -> Dict[str, Any]:
         """Get model curve for plotting"""
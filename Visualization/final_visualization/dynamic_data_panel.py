@@ -7,16 +7,23 @@ This panel automatically builds a tree structure showing:
 - Calibration ranges
 
 The structure adapts based on what data is actually available.
+Material nodes are probed and filled in only when expanded, and adding or
+removing a material inserts/removes just that node. Probes run in the
+background (DataTypeRegistry.probe_async) and their results are queued back
+to the UI thread.
 """
 
 from typing import Dict, List, Optional
 from PyQt6.QtWidgets import (
-    QWidget, QVBoxLayout, QTreeWidget, QTreeWidgetItem,
+    QWidget, QVBoxLayout, QTreeView,
     QLabel, QScrollArea, QFrame
 )
 from PyQt6.QtCore import Qt, pyqtSignal
 from PyQt6.QtGui import QFont
 
+from gui.views.lazy_tree import LazyNode
+from gui.views.lazy_tree_model import LazyTreeModel
+
 from .data_types import DataTypeRegistry
 
 
@@ -29,14 +36,21 @@ class DynamicDataPanel(QWidget):
     """
     
     data_selected = pyqtSignal(str, str, str)  # (material, category, data_type)
+    # Background probe finished (material node, available data); queued to the UI thread
+    availability_ready = pyqtSignal(object, object)
+    
+    AUTO_EXPAND_LIMIT = 10  # New material nodes are expanded while at most this many are shown
     
     def __init__(self, parent=None):
         super().__init__(parent)
         
         self.current_materials = []
-        self.tree_items = {}  # Cache tree items
+        self._expand_when_ready = set()  # Material nodes to expand once probed
         
         self._setup_ui()
+        # Queued even when a cached probe completes on the UI thread (inside the loader)
+        self.availability_ready.connect(self._on_availability_ready,
+                                        Qt.ConnectionType.QueuedConnection)
     
     def _setup_ui(self):
         """Setup the UI"""
@@ -56,27 +70,30 @@ class DynamicDataPanel(QWidget):
         line.setFrameShadow(QFrame.Shadow.Sunken)
         layout.addWidget(line)
         
-        # Tree widget
-        self.tree = QTreeWidget()
+        # Tree view over a lazy model (material nodes are filled in on expand)
+        self.model = LazyTreeModel(parent=self)
+        self.tree = QTreeView()
         self.tree.setHeaderHidden(True)
+        self.tree.setUniformRowHeights(True)
+        self.tree.setModel(self.model)
         self.tree.setStyleSheet("""
-            QTreeWidget {
+            QTreeView {
                 border: 1px solid #ddd;
                 border-radius: 5px;
                 background-color: white;
             }
-            QTreeWidget::item {
+            QTreeView::item {
                 padding: 5px;
             }
-            QTreeWidget::item:hover {
+            QTreeView::item:hover {
                 background-color: #e8f4f8;
             }
-            QTreeWidget::item:selected {
+            QTreeView::item:selected {
                 background-color: #3498db;
                 color: white;
             }
         """)
-        self.tree.itemClicked.connect(self._on_item_clicked)
+        self.tree.clicked.connect(self._on_item_clicked)
         layout.addWidget(self.tree)
         
         # Info label
@@ -89,18 +106,21 @@ class DynamicDataPanel(QWidget):
         """
         Set materials to display
         
+        Only added/removed materials change; existing nodes keep their
+        expansion and selection.
+        
         Args:
             materials: List of material names
         """
-        self.current_materials = materials
+        self.current_materials = list(materials)
         self.rebuild_tree()
     
     def rebuild_tree(self):
-        """Rebuild entire tree based on current materials"""
-        self.tree.clear()
-        self.tree_items.clear()
+        """Sync the tree with the current materials"""
+        tree = self.model.tree
         
         if not self.current_materials:
+            tree.clear_children(tree.root)
             self.info_label.setText("No materials selected")
             return
         
@@ -108,72 +128,97 @@ class DynamicDataPanel(QWidget):
         count = len(self.current_materials)
         self.info_label.setText(f"Showing data for {count} material(s)")
         
-        # Build tree for each material
-        for material in self.current_materials:
-            self._add_material_node(material)
+        new_materials = [m for m in self.current_materials if tree.root.child(m) is None]
+        tree.sync(tree.root, self.current_materials, self._material_node)
         
-        # Expand all
-        self.tree.expandAll()
+        # Expand new materials while the list is short (expanding probes their data)
+        if count <= self.AUTO_EXPAND_LIMIT:
+            for material in new_materials:
+                self._expand_all(tree.root.child(material))
+    
+    def _expand_all(self, node):
+        if node.loader is not None:
+            # Probe in the background; expanded when the results arrive
+            self._expand_when_ready.add(node)
+        self.model.tree.fetch_all(node)
+        index = self.model.index_of(node)
+        self.tree.expand(index)
+        for child in node.children:
+            self.tree.expand(self.model.index_of(child))
     
-    def _add_material_node(self, material: str):
-        """Add a material node with all its data"""
+    def _material_node(self, material: str) -> LazyNode:
+        """Material node; its categories are probed on first expand"""
+        return LazyNode(material, f"📦 {material}", loader=self._load_material,
+                        style={'font': ('Arial', 10, True)})
+    
+    def _load_material(self, material_node: LazyNode):
+        """Loader: start probing available data; children are added when it finishes"""
+        material = material_node.key
+        material_node.text = f"📦 {material} (checking...)"
+        
+        def done(future):
+            try:
+                available_data = future.result()
+            except Exception as e:
+                print(f"[DataPanel] ✗ Probe failed for {material}: {e}")
+                available_data = {}
+            self.availability_ready.emit(material_node, available_data)
         
-        # Get available data for this material
-        available_data = DataTypeRegistry.get_available_for_material(material)
+        DataTypeRegistry.probe_async(material).add_done_callback(done)
+        return [], None
+    
+    def _on_availability_ready(self, material_node: LazyNode, available_data):
+        """Fill in a probed material node (UI thread)"""
+        expand = material_node in self._expand_when_ready
+        self._expand_when_ready.discard(material_node)
+        
+        # Material may have been removed (or removed and re-added) while probing
+        if material_node.parent is not self.model.tree.root:
+            return
+        
+        material = material_node.key
+        expand = expand or self.tree.isExpanded(self.model.index_of(material_node))
+        available_data = {category: types for category, types in available_data.items() if types}
         
         if not available_data:
             # No data available
-            item = QTreeWidgetItem([f"📦 {material} (No data)"])
-            item.setForeground(0, Qt.GlobalColor.gray)
-            self.tree.addTopLevelItem(item)
+            material_node.text = f"📦 {material} (No data)"
+            material_node.style = {'color': 'gray'}
+            self.model.changed(material_node)
             return
         
-        # Create material root node
         total_items = sum(len(types) for types in available_data.values())
-        material_item = QTreeWidgetItem([f"📦 {material} ({total_items} datasets)"])
-        material_item.setFont(0, QFont('Arial', 10, QFont.Weight.Bold))
-        self.tree.addTopLevelItem(material_item)
+        material_node.text = f"📦 {material} ({total_items} datasets)"
         
-        # Add categories
-        for category in sorted(available_data.keys()):
+        def category_node(category):
             data_types = available_data[category]
-            
-            # Category node
             category_icon = self._get_category_icon(category)
-            category_item = QTreeWidgetItem([f"{category_icon} {category.title()} ({len(data_types)})"])
-            category_item.setFont(0, QFont('Arial', 9, QFont.Weight.Bold))
-            material_item.addChild(category_item)
-            
-            # Add each data type
-            for data_type in data_types:
-                data_item = QTreeWidgetItem([f"  • {data_type.name}"])
-                
-                # Store metadata
-                data_item.setData(0, Qt.ItemDataRole.UserRole, {
-                    'material': material,
-                    'category': category,
-                    'data_type': data_type.name,
-                    'instance': data_type
-                })
-                
-                # Get summary
-                try:
-                    summary = data_type.get_summary(material)
-                    data_item.setToolTip(0, summary)
-                except Exception as e:
-                    print(f"[DataPanel] Error getting summary: {e}")
-                
-                category_item.addChild(data_item)
-                
-                # Try to get and add display widget
-                try:
-                    widget = data_type.get_display_widget(material)
-                    if widget:
-                        # Add widget as child (for future expansion)
-                        # For now, just show text
-                        pass
-                except Exception as e:
-                    print(f"[DataPanel] Error getting widget: {e}")
+            node = LazyNode(category, f"{category_icon} {category.title()} ({len(data_types)})",
+                            style={'font': ('Arial', 9, True)})
+            by_name = {data_type.name: data_type for data_type in data_types}
+            node.pending = list(by_name)
+            node.factory = lambda name: self._data_type_node(material, category, by_name[name])
+            return node
+        
+        self.model.tree.set_children(material_node, sorted(available_data), category_node)
+        if expand:
+            self._expand_all(material_node)
+    
+    def _data_type_node(self, material: str, category: str, data_type) -> LazyNode:
+        """Leaf node for one data type (summary computed on first hover)"""
+        def summary(node):
+            try:
+                return data_type.get_summary(material)
+            except Exception as e:
+                print(f"[DataPanel] Error getting summary: {e}")
+                return None
+        
+        return LazyNode(data_type.name, f"  • {data_type.name}", data={
+            'material': material,
+            'category': category,
+            'data_type': data_type.name,
+            'instance': data_type
+        }, tooltip=summary)
     
     def _get_category_icon(self, category: str) -> str:
         """Get icon for category"""
@@ -185,9 +230,9 @@ class DynamicDataPanel(QWidget):
         }
         return icons.get(category.lower(), '📁')
     
-    def _on_item_clicked(self, item: QTreeWidgetItem, column: int):
+    def _on_item_clicked(self, index):
         """Handle tree item click"""
-        data = item.data(0, Qt.ItemDataRole.UserRole)
+        data = index.data(Qt.ItemDataRole.UserRole)
         
         if data and isinstance(data, dict):
             material = data['material']
@@ -199,23 +244,20 @@ class DynamicDataPanel(QWidget):
     
     def get_selected_data(self) -> Optional[Dict]:
         """Get currently selected data item"""
-        current = self.tree.currentItem()
-        if current:
-            return current.data(0, Qt.ItemDataRole.UserRole)
+        current = self.tree.currentIndex()
+        if current.isValid():
+            return current.data(Qt.ItemDataRole.UserRole)
         return None
     
     def highlight_material(self, material: str):
         """Highlight a specific material in the tree"""
-        # Find and select material node
-        for i in range(self.tree.topLevelItemCount()):
-            item = self.tree.topLevelItem(i)
-            if material in item.text(0):
-                self.tree.setCurrentItem(item)
-                break
+        node = self.model.tree.root.child(material)
+        if node is not None:
+            self.tree.setCurrentIndex(self.model.index_of(node))
     
     def clear(self):
         """Clear the panel"""
-        self.tree.clear()
-        self.tree_items.clear()
+        self.model.tree.clear_children(self.model.tree.root)
+        self._expand_when_ready.clear()
         self.current_materials.clear()
         self.info_label.setText("Select materials to view data")
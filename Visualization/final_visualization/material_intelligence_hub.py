@@ -72,6 +72,8 @@ class MaterialIntelligenceHub(QWidget):
     
     material_added = pyqtSignal(str)  # Emitted when material is added
     material_removed = pyqtSignal(str)  # Emitted when material is removed
+    # Background load finished (material, exp_data, model_data); queued to the UI thread
+    material_data_ready = pyqtSignal(str, object, object)
     
     def __init__(self, db_manager, querier, parent=None):
         super().__init__(parent)
@@ -95,6 +97,7 @@ class MaterialIntelligenceHub(QWidget):
         # Track selected materials
         self.selected_materials: List[str] = []
         self.material_colors: Dict[str, str] = {}
+        self.recent_materials: List[str] = []  # most recent first, prefetched
         
         # Current mode
         self.current_mode = "compare"  # single, compare, overlay
@@ -107,11 +110,14 @@ class MaterialIntelligenceHub(QWidget):
     
     def _init_data_types(self):
         """Initialize and register all data types"""
-        from .data_types import DataTypeRegistry, UsUpExperimentalType, UsUpModelType
+        from .data_types import DataTypeRegistry, UsUpExperimentalType, UsUpModelType, get_model_index
         
         # Clear any existing registrations
         DataTypeRegistry.clear()
         
+        # Parse the XML model files once; data types share the index
+        DataTypeRegistry.set_model_index(get_model_index(self.xml_models_path).build())
+        
         # Register Us-Up data types
         us_up_exp = UsUpExperimentalType(self.experimental_data_path)
         us_up_model = UsUpModelType(self.xml_models_path)
@@ -339,6 +345,9 @@ class MaterialIntelligenceHub(QWidget):
         
         # Chart type
         self.chart_combo.currentTextChanged.connect(self._on_chart_type_changed)
+        
+        # Background data loads
+        self.material_data_ready.connect(self._on_material_data_ready)
     
     # ========== EVENT HANDLERS ==========
     
@@ -375,8 +384,27 @@ class MaterialIntelligenceHub(QWidget):
         # Update plot
         self._update_visualization()
         
+        self._remember_recent(material_name)
+        
         print(f"[Intelligence Hub] ✓ Added material: {material_name}")
     
+    def _remember_recent(self, material_name: str):
+        """Track recently used materials and prefetch the unselected ones"""
+        if material_name in self.recent_materials:
+            self.recent_materials.remove(material_name)
+        self.recent_materials.insert(0, material_name)
+        del self.recent_materials[10:]
+        
+        self.prefetch_materials([m for m in self.recent_materials if m not in self.selected_materials])
+    
+    def prefetch_materials(self, material_names: List[str]):
+        """
+        Warm data caches for materials the user is likely to add next
+        (recent selections, search results) without blocking the UI
+        """
+        from .data_types import DataTypeRegistry
+        DataTypeRegistry.prefetch(material_names)
+    
     def _add_chip(self, material_name: str, color: str):
         """Add material chip to selection bar"""
         chip = QWidget()
@@ -430,6 +458,8 @@ class MaterialIntelligenceHub(QWidget):
         if hasattr(self, 'data_panel'):
             self.data_panel.set_materials(self.selected_materials)
         
+        self._remember_recent(material_name)
+        
         print(f"[Intelligence Hub] ✓ Removed material: {material_name}")
     
     def _on_mode_changed(self):
@@ -485,21 +515,35 @@ class MaterialIntelligenceHub(QWidget):
                 self._load_and_plot_material(material_name)
     
     def _load_and_plot_material(self, material_name: str):
-        """Load data for material and add to plot"""
+        """Load data for material in the background and add it to the plot when ready"""
         from .data_types import DataTypeRegistry
         
-        # Get experimental data
-        exp_data = None
-        exp_type = DataTypeRegistry.get_by_name("experimental", "Us-Up Experiment")
-        if exp_type and exp_type.can_load(material_name):
-            exp_data = exp_type.load_data(material_name)
-            print(f"  ✓ Loaded experimental data for {material_name}")
+        futures = []
+        for category, name in (("experimental", "Us-Up Experiment"), ("model", "Us-Up Model")):
+            data_type = DataTypeRegistry.get_by_name(category, name)
+            if data_type:
+                futures.append(DataTypeRegistry.load_data_async(data_type, material_name))
+            else:
+                futures.append(None)
+        
+        pending = [f for f in futures if f is not None]
         
-        # Get model data
-        model_data = None
-        model_type = DataTypeRegistry.get_by_name("model", "Us-Up Model")
-        if model_type and model_type.can_load(material_name):
-            model_data = model_type.load_data(material_name)
+        def ready(_):
+            exp_data, model_data = [f.result() if f is not None and not f.exception() else None
+                                    for f in futures]
+            self.material_data_ready.emit(material_name, exp_data, model_data)
+        
+        DataTypeRegistry.when_all(pending, ready)
+    
+    def _on_material_data_ready(self, material_name: str, exp_data, model_data):
+        """Add background-loaded data to the plot (UI thread)"""
+        # Material may have been removed while loading
+        if material_name not in self.selected_materials:
+            return
+        
+        if exp_data:
+            print(f"  ✓ Loaded experimental data for {material_name}")
+        if model_data:
             print(f"  ✓ Loaded model data for {material_name}")
         
         # Get color for this material
@@ -516,6 +560,8 @@ class MaterialIntelligenceHub(QWidget):
     
     def refresh(self):
         """Refresh the hub"""
+        from .data_types import DataTypeRegistry
+        DataTypeRegistry.invalidate()
         self._update_visualization()
     
     # ===== EXPORT METHODS =====
@@ -664,5 +710,7 @@ class MaterialIntelligenceHub(QWidget):
     
     def cleanup(self):
         """Cleanup resources"""
+        from .data_types import DataTypeRegistry
+        DataTypeRegistry.shutdown()
         self.selected_materials.clear()
         self.material_colors.clear()
@@ -6,12 +6,26 @@ Manages plot creation and updates based on:
 - View mode (single, compare, overlay)
 - Chart type
 - Data types selected
+
+Artists are retained per material (see RetainedPlot): adding, removing or
+recolouring a material only touches that material's artists, and a full
+figure rebuild happens only when the layout changes.
 """
 
 import numpy as np
 from typing import Dict, List, Any, Optional
-from PyQt6.QtWidgets import QWidget, QVBoxLayout, QHBoxLayout, QPushButton, QLabel
-from PyQt6.QtCore import Qt, pyqtSignal
+from PyQt6.QtWidgets import QWidget, QVBoxLayout, QHBoxLayout, QPushButton, QLabel, QToolTip
+from PyQt6.QtCore import Qt, pyqtSignal, QTimer
+from PyQt6.QtGui import QCursor
+
+from .retained_plot import RetainedPlot
+
+try:
+    from services.level_of_detail import level_of_detail
+    from services.point_inspector import PointInspector
+except ImportError:
+    from Visualization.level_of_detail import level_of_detail
+    from Visualization.point_inspector import PointInspector
 
 try:
     from matplotlib.figure import Figure
@@ -68,6 +82,19 @@ class PlotManager(QWidget):
         self.canvas = FigureCanvas(self.figure)
         layout.addWidget(self.canvas)
         
+        # Retained artists; updates in one event-loop turn share one draw.
+        # Dense series are decimated for the current view and re-reduced on zoom.
+        self.plot = RetainedPlot(self.figure, self.canvas,
+                                 scheduler=lambda fn: QTimer.singleShot(0, fn),
+                                 lod=level_of_detail(self.figure))
+        self._layout_key = None
+        
+        # Hover tooltips for experimental points (KD-tree over screen positions)
+        self.inspector = PointInspector(
+            self.canvas,
+            show=lambda text, event: QToolTip.showText(QCursor.pos(), text, self.canvas),
+            hide=QToolTip.hideText)
+        
         # Add toolbar
         self.toolbar = NavigationToolbar(self.canvas, self)
         layout.addWidget(self.toolbar)
@@ -123,7 +150,7 @@ class PlotManager(QWidget):
             self.material_colors[material_name] = self.color_palette[idx]
         
         print(f"[PlotManager] Added data for {material_name}")
-        self.refresh_plot()
+        self._update_material(material_name)
     
     def remove_material_data(self, material_name: str):
         """Remove material data"""
@@ -133,201 +160,213 @@ class PlotManager(QWidget):
             del self.material_colors[material_name]
         
         print(f"[PlotManager] Removed data for {material_name}")
-        self.refresh_plot()
+        if not MATPLOTLIB_AVAILABLE:
+            return
+        # Compare subplots are placed by position, so the remaining ones reflow
+        if (not self.materials_data or self.current_mode == "compare"
+                or self._current_layout_key() != self._layout_key):
+            self.refresh_plot()
+            return
+        self.plot.remove_material(material_name)
+        self.inspector.remove_points(material_name)
+        self._update_status()
+    
+    def set_material_color(self, material_name: str, color: str):
+        """Restyle one material without redrawing the others"""
+        self.material_colors[material_name] = color
+        if MATPLOTLIB_AVAILABLE:
+            self.plot.set_color(material_name, color)
     
     def clear_plot(self):
         """Clear all data and plot"""
         self.materials_data.clear()
         self.material_colors.clear()
-        self.figure.clear()
-        self.canvas.draw()
+        self.plot.reset()
+        self.inspector.clear()
+        self._layout_key = None
+        self.canvas.draw_idle()
         self.status_label.setText("Plot cleared")
     
     def refresh_plot(self):
-        """Refresh the plot with current data"""
+        """Rebuild the plot with current data"""
         if not MATPLOTLIB_AVAILABLE:
             return
         
+        self.plot.reset()
+        self.inspector.clear()
+        self._layout_key = None
+        
         if not self.materials_data:
-            self.figure.clear()
-            ax = self.figure.add_subplot(111)
+            ax = self.plot.add_axes(None, 111)
             ax.text(0.5, 0.5, 'No data to plot\n\nAdd materials to begin',
                    ha='center', va='center', fontsize=14, color='#7f8c8d')
             ax.set_xlim(0, 1)
             ax.set_ylim(0, 1)
             ax.axis('off')
-            self.canvas.draw()
+            self.plot.request_update(full=True)
             self.status_label.setText("No data")
             return
         
-        # Route to appropriate plotting method
-        if self.current_mode == "single":
-            self._plot_single_mode()
-        elif self.current_mode == "compare":
-            self._plot_compare_mode()
-        elif self.current_mode == "overlay":
-            self._plot_overlay_mode()
-        else:
-            self._plot_overlay_mode()  # Default
+        self._build_layout()
+        for material_name in self._plotted_materials():
+            self._set_material_series(material_name)
+        self.plot.request_update(full=True)
+        self._update_status()
     
-    def _plot_single_mode(self):
-        """Plot single material in detail"""
-        self.figure.clear()
-        
-        # Get first material
-        if not self.materials_data:
-            return
-        
-        material_name = list(self.materials_data.keys())[0]
-        data = self.materials_data[material_name]
-        color = self.material_colors[material_name]
-        
-        ax = self.figure.add_subplot(111)
-        
-        # Plot experimental data
-        if 'experimental' in data:
-            exp_data = data['experimental']
-            if exp_data and 'datasets' in exp_data:
-                for i, dataset in enumerate(exp_data['datasets']):
-                    Up = dataset.get('Up', [])
-                    Us = dataset.get('Us', [])
-                    if Up and Us:
-                        label = f"Exp: {dataset.get('file', f'Dataset {i+1}')}"
-                        ax.plot(Up, Us, 'o', color=color, label=label, markersize=6, alpha=0.7)
-        
-        # Plot model data
-        if 'model' in data:
-            model_data = data['model']
-            if model_data and 'parameters' in model_data:
-                params = model_data['parameters']
-                if 'C0' in params and 'S' in params:
-                    C0 = params['C0']
-                    S = params['S']
-                    Up_model = np.linspace(0, 5, 100)
-                    Us_model = C0 + S * Up_model
-                    ax.plot(Up_model, Us_model, '-', color=color, linewidth=2,
-                           label=f"Model: Us = {C0:.2f} + {S:.2f}×Up")
-        
-        ax.set_xlabel('Up (Particle Velocity, km/s)', fontsize=12)
-        ax.set_ylabel('Us (Shock Velocity, km/s)', fontsize=12)
-        ax.set_title(f'{material_name} - Us-Up Data', fontsize=14, fontweight='bold')
-        ax.legend(loc='best')
-        ax.grid(True, alpha=0.3)
-        
-        self.figure.tight_layout()
-        self.canvas.draw()
-        self.status_label.setText(f"Showing: {material_name} (Single mode)")
+    # ========== LAYOUT ==========
     
-    def _plot_compare_mode(self):
-        """Plot materials side-by-side"""
-        self.figure.clear()
-        
-        n_materials = len(self.materials_data)
-        
-        if n_materials == 0:
-            return
-        
-        # Calculate subplot layout
+    def _plotted_materials(self) -> List[str]:
+        """Materials drawn in the current mode"""
+        names = list(self.materials_data.keys())
+        if self.current_mode == "single":
+            return names[:1]
+        if self.current_mode == "compare":
+            return names[:9]  # Max 9 subplots
+        return names
+    
+    def _compare_grid(self, n_materials: int):
+        """Calculate subplot layout"""
         if n_materials == 1:
-            rows, cols = 1, 1
+            return 1, 1
         elif n_materials == 2:
-            rows, cols = 1, 2
+            return 1, 2
         elif n_materials <= 4:
-            rows, cols = 2, 2
+            return 2, 2
         elif n_materials <= 6:
-            rows, cols = 2, 3
-        else:
-            rows, cols = 3, 3
+            return 2, 3
+        return 3, 3
+    
+    def _current_layout_key(self):
+        """Identifies the axes layout; materials can be added incrementally while it holds"""
+        if self.current_mode == "single":
+            return ("single", tuple(self._plotted_materials()))
+        if self.current_mode == "compare":
+            return ("compare",) + self._compare_grid(len(self._plotted_materials()))
+        return ("overlay",)
+    
+    def _build_layout(self):
+        """Create the axes for the current mode"""
+        self._layout_key = self._current_layout_key()
         
-        for idx, (material_name, data) in enumerate(self.materials_data.items()):
-            if idx >= 9:  # Max 9 subplots
-                break
-            
-            ax = self.figure.add_subplot(rows, cols, idx + 1)
-            color = self.material_colors[material_name]
-            
-            # Plot experimental
-            if 'experimental' in data:
-                exp_data = data['experimental']
-                if exp_data and 'datasets' in exp_data:
-                    for dataset in exp_data['datasets']:
-                        Up = dataset.get('Up', [])
-                        Us = dataset.get('Us', [])
-                        if Up and Us:
-                            ax.plot(Up, Us, 'o', color=color, markersize=4, alpha=0.7)
-            
-            # Plot model
-            if 'model' in data:
-                model_data = data['model']
-                if model_data and 'parameters' in model_data:
-                    params = model_data['parameters']
-                    if 'C0' in params and 'S' in params:
-                        C0 = params['C0']
-                        S = params['S']
-                        Up_model = np.linspace(0, 5, 100)
-                        Us_model = C0 + S * Up_model
-                        ax.plot(Up_model, Us_model, '-', color=color, linewidth=1.5)
-            
+        if self.current_mode == "compare":
+            self.figure.suptitle('Material Comparison - Us-Up Data', fontsize=12, fontweight='bold')
+            return  # Subplots are added per material
+        
+        ax = self.plot.add_axes("main", 111)
+        if self.current_mode == "single":
+            material_name = self._plotted_materials()[0]
+            ax.set_xlabel('Up (Particle Velocity, km/s)', fontsize=12)
+            ax.set_ylabel('Us (Shock Velocity, km/s)', fontsize=12)
+            ax.set_title(f'{material_name} - Us-Up Data', fontsize=14, fontweight='bold')
+            self.plot.enable_legend("main", loc='best')
+        else:
+            ax.set_xlabel('Up (Particle Velocity, km/s)', fontsize=12)
+            ax.set_ylabel('Us (Shock Velocity, km/s)', fontsize=12)
+            ax.set_title('Material Comparison - Us-Up Overlay', fontsize=14, fontweight='bold')
+            self.plot.enable_legend("main", loc='best', fontsize=10)
+        ax.grid(True, alpha=0.3)
+    
+    def _compare_axes(self, material_name: str):
+        """Subplot of a material in compare mode (created on first use)"""
+        if material_name not in self.plot.axes:
+            rows, cols = self._layout_key[1:]
+            idx = self._plotted_materials().index(material_name)
+            ax = self.plot.add_axes(material_name, rows, cols, idx + 1)
             ax.set_title(material_name, fontsize=10, fontweight='bold')
             ax.set_xlabel('Up (km/s)', fontsize=9)
             ax.set_ylabel('Us (km/s)', fontsize=9)
             ax.grid(True, alpha=0.3)
             ax.tick_params(labelsize=8)
-        
-        self.figure.suptitle('Material Comparison - Us-Up Data', fontsize=12, fontweight='bold')
-        self.figure.tight_layout()
-        self.canvas.draw()
-        self.status_label.setText(f"Comparing {n_materials} materials (Side-by-side)")
+        return material_name
     
-    def _plot_overlay_mode(self):
-        """Plot all materials on one plot"""
-        self.figure.clear()
-        ax = self.figure.add_subplot(111)
-        
-        legend_items = []
-        
-        for material_name, data in self.materials_data.items():
-            color = self.material_colors[material_name]
+    # ========== SERIES ==========
+    
+    def _update_material(self, material_name: str):
+        """Redraw one material, rebuilding only if the layout changed"""
+        if not MATPLOTLIB_AVAILABLE:
+            return
+        if self._current_layout_key() != self._layout_key:
+            self.refresh_plot()
+            return
+        if material_name in self._plotted_materials():
+            self._set_material_series(material_name)
+        self._update_status()
+    
+    def _set_material_series(self, material_name: str):
+        if self.current_mode == "compare":
+            key = self._compare_axes(material_name)
+        else:
+            key = "main"
+        self.plot.set_series(material_name, key, self._material_series(material_name))
+        
+        # Tooltips: dataset, reference and values of each experimental point
+        self.inspector.remove_points(material_name)
+        exp_data = self.materials_data[material_name].get('experimental') or {}
+        for dataset in exp_data.get('datasets', []):
+            Up = np.asarray(dataset.get('Up', []), dtype=float)
+            Us = np.asarray(dataset.get('Us', []), dtype=float)
+            if len(Up) == 0 or len(Up) != len(Us):
+                continue
+            source = (dataset.get('metadata') or {}).get('source', '')
             
-            # Plot experimental
-            if 'experimental' in data:
-                exp_data = data['experimental']
-                if exp_data and 'datasets' in exp_data:
-                    for i, dataset in enumerate(exp_data['datasets']):
-                        Up = dataset.get('Up', [])
-                        Us = dataset.get('Us', [])
-                        if Up and Us:
-                            label = f"{material_name} (Exp)" if i == 0 else None
-                            line = ax.plot(Up, Us, 'o', color=color, markersize=6,
-                                         alpha=0.6, label=label)
-                            if label:
-                                legend_items.append(line[0])
+            def describe(i, Up=Up, Us=Us, file=dataset.get('file', ''), source=source):
+                text = f"Dataset: {file}"
+                if source:
+                    text += f"\nReference: {source}"
+                return text + f"\nUp = {Up[i]:.3f} km/s, Us = {Us[i]:.3f} km/s"
             
-            # Plot model
-            if 'model' in data:
-                model_data = data['model']
-                if model_data and 'parameters' in model_data:
-                    params = model_data['parameters']
-                    if 'C0' in params and 'S' in params:
-                        C0 = params['C0']
-                        S = params['S']
-                        Up_model = np.linspace(0, 5, 100)
-                        Us_model = C0 + S * Up_model
-                        line = ax.plot(Up_model, Us_model, '-', color=color, linewidth=2,
-                                     label=f"{material_name} (Model)")
-                        legend_items.append(line[0])
-        
-        ax.set_xlabel('Up (Particle Velocity, km/s)', fontsize=12)
-        ax.set_ylabel('Us (Shock Velocity, km/s)', fontsize=12)
-        ax.set_title('Material Comparison - Us-Up Overlay', fontsize=14, fontweight='bold')
-        
-        if legend_items:
-            ax.legend(loc='best', fontsize=10)
-        
-        ax.grid(True, alpha=0.3)
-        
-        self.figure.tight_layout()
-        self.canvas.draw()
-        
+            self.inspector.add_points(self.plot.axes[key], Up, Us, describe, name=material_name)
+    
+    def _material_series(self, material_name: str) -> List[Dict[str, Any]]:
+        """Experimental and model series of a material, styled for the current mode"""
+        data = self.materials_data[material_name]
+        color = self.material_colors[material_name]
+        mode = self.current_mode
+        series = []
+        
+        # Experimental
+        exp_data = data.get('experimental')
+        if exp_data and 'datasets' in exp_data:
+            for i, dataset in enumerate(exp_data['datasets']):
+                Up = dataset.get('Up', [])
+                Us = dataset.get('Us', [])
+                if len(Up) == 0 or len(Us) == 0:
+                    continue
+                if mode == "single":
+                    style = dict(label=f"Exp: {dataset.get('file', f'Dataset {i+1}')}",
+                                 markersize=6, alpha=0.7)
+                elif mode == "compare":
+                    style = dict(markersize=4, alpha=0.7)
+                else:
+                    style = dict(label=f"{material_name} (Exp)" if i == 0 else '_nolegend_',
+                                 markersize=6, alpha=0.6)
+                series.append({'x': Up, 'y': Us, 'fmt': 'o', 'style': dict(style, color=color)})
+        
+        # Model
+        model_data = data.get('model')
+        if model_data and 'parameters' in model_data:
+            params = model_data['parameters']
+            if 'C0' in params and 'S' in params:
+                C0 = params['C0']
+                S = params['S']
+                Up_model = np.linspace(0, 5, 100)
+                Us_model = C0 + S * Up_model
+                if mode == "single":
+                    style = dict(linewidth=2, label=f"Model: Us = {C0:.2f} + {S:.2f}×Up")
+                elif mode == "compare":
+                    style = dict(linewidth=1.5)
+                else:
+                    style = dict(linewidth=2, label=f"{material_name} (Model)")
+                series.append({'x': Up_model, 'y': Us_model, 'fmt': '-',
+                               'style': dict(style, color=color)})
+        
+        return series
+    
+    def _update_status(self):
         n_materials = len(self.materials_data)
-        self.status_label.setText(f"Overlaying {n_materials} materials")
+        if self.current_mode == "single":
+            self.status_label.setText(f"Showing: {self._plotted_materials()[0]} (Single mode)")
+        elif self.current_mode == "compare":
+            self.status_label.setText(f"Comparing {n_materials} materials (Side-by-side)")
+        else:
+            self.status_label.setText(f"Overlaying {n_materials} materials")
@@ -0,0 +1,222 @@
+"""
+Retained Plot - Incremental matplotlib updates
+
+Keeps one set of artists per material so adding, removing or restyling a
+material only touches its own artists. The static part of the figure
+(axes, ticks, grid, titles) is rendered once into a cached background;
+updates restore that background and blit the data artists and legends on
+top. A full redraw happens only when the layout or the axis limits change.
+
+Author: Materials Database Team
+"""
+
+from typing import Any, Callable, Dict, List, Optional
+
+
+class RetainedPlot:
+    """
+    Retained artist model over a matplotlib figure and canvas.
+
+    Usage:
+        plot = RetainedPlot(figure, canvas, scheduler=lambda fn: QTimer.singleShot(0, fn))
+        plot.add_axes('main', 111)
+        plot.set_series('Copper', 'main', [{'x': up, 'y': us, 'fmt': 'o', 'style': {...}}])
+        plot.remove_material('Copper')
+    """
+
+    def __init__(self, figure, canvas, scheduler: Optional[Callable[[Callable], None]] = None,
+                 lod=None):
+        """
+        Args:
+            figure: matplotlib Figure
+            canvas: Canvas of the figure (Agg-based for blitting)
+            scheduler: Runs a callback later (e.g. QTimer.singleShot(0, fn)) so
+                       several changes in one event-loop turn share one update;
+                       None updates immediately
+            lod: Optional LevelOfDetail controller; series are registered with
+                 it so dense data is decimated for the current view
+        """
+        self.figure = figure
+        self.canvas = canvas
+        self._scheduler = scheduler
+        self.lod = lod
+
+        self.axes: Dict[Any, Any] = {}              # axes key -> Axes
+        self.artists: Dict[str, List[Any]] = {}     # material -> artists
+        self._material_axes: Dict[str, Any] = {}    # material -> axes key
+        self._legends: Dict[Any, dict] = {}         # axes key -> legend kwargs
+
+        self._background = None
+        self._full = True
+        self._layout = False
+        self._scheduled = False
+        self._capturing = False
+
+        # Counters for diagnostics and tests
+        self.full_draws = 0
+        self.blits = 0
+
+        canvas.mpl_connect('draw_event', self._on_draw)
+        canvas.mpl_connect('resize_event', self._on_resize)
+
+    # ========== STRUCTURE ==========
+
+    def reset(self):
+        """Remove all axes and artists"""
+        self.figure.clear()
+        if self.lod is not None:
+            self.lod.clear()
+        self.axes.clear()
+        self.artists.clear()
+        self._material_axes.clear()
+        self._legends.clear()
+        self._background = None
+        self._full = True
+
+    def add_axes(self, key, *subplot_args):
+        """Add a subplot (changes the layout, so the next update is a full draw)"""
+        ax = self.figure.add_subplot(*subplot_args)
+        self.axes[key] = ax
+        self._full = True
+        self._layout = True
+        return ax
+
+    def enable_legend(self, key, **kwargs):
+        """Keep a legend on an axes in sync with its labelled artists"""
+        self._legends[key] = kwargs
+
+    def materials(self) -> List[str]:
+        return list(self.artists)
+
+    # ========== ARTISTS ==========
+
+    def set_series(self, material: str, key, series: List[dict]):
+        """
+        Replace a material's artists.
+
+        Args:
+            material: Material name
+            key: Axes key the series are drawn on
+            series: [{'x', 'y', 'fmt', 'style': {...plot kwargs}}, ...]
+        """
+        self._remove_artists(material)
+        ax = self.axes[key]
+        lines = []
+        for s in series:
+            new = ax.plot(s['x'], s['y'], s.get('fmt', '-'), **s.get('style', {}))
+            if self.lod is not None:
+                for line in new:
+                    self.lod.attach(line, s['x'], s['y'])
+            lines.extend(new)
+        self.artists[material] = lines
+        self._material_axes[material] = key
+        self._limits_changed(ax)
+        self.request_update()
+
+    def remove_material(self, material: str):
+        """Remove a material's artists"""
+        key = self._remove_artists(material)
+        if key is not None and key in self.axes:
+            self._limits_changed(self.axes[key])
+        self.request_update()
+
+    def set_color(self, material: str, color: str):
+        """Restyle a material (blit only; limits are unchanged)"""
+        for artist in self.artists.get(material, []):
+            artist.set_color(color)
+        self.request_update()
+
+    def _remove_artists(self, material: str):
+        for artist in self.artists.pop(material, []):
+            if self.lod is not None:
+                self.lod.detach(artist)
+            artist.remove()
+        return self._material_axes.pop(material, None)
+
+    def _limits_changed(self, ax):
+        """Autoscale after data changes; new limits invalidate the background"""
+        before = (tuple(ax.get_xlim()), tuple(ax.get_ylim()))
+        ax.relim()
+        ax.autoscale_view()
+        if (tuple(ax.get_xlim()), tuple(ax.get_ylim())) != before:
+            self._full = True
+
+    # ========== DRAWING ==========
+
+    def request_update(self, full: bool = False):
+        """Schedule an update; requests before it runs are coalesced"""
+        self._full = self._full or full
+        if self._scheduler is None:
+            self.flush()
+        elif not self._scheduled:
+            self._scheduled = True
+            self._scheduler(self.flush)
+
+    def flush(self):
+        """Bring the canvas up to date (blit when the background is valid)"""
+        self._scheduled = False
+        self._update_legends()
+        if self._full or self._background is None:
+            self._draw_full()
+        else:
+            self._blit()
+
+    def _update_legends(self):
+        for key, kwargs in self._legends.items():
+            ax = self.axes.get(key)
+            if ax is None:
+                continue
+            handles, labels = ax.get_legend_handles_labels()
+            if handles:
+                ax.legend(handles, labels, **kwargs)
+            elif ax.get_legend() is not None:
+                ax.get_legend().remove()
+
+    def _dynamic_artists(self):
+        """(axes, artist) pairs drawn on top of the background"""
+        pairs = [(line.axes, line) for lines in self.artists.values() for line in lines]
+        for ax in self.axes.values():
+            if ax.get_legend() is not None:
+                pairs.append((ax, ax.get_legend()))
+        return pairs
+
+    def _draw_full(self):
+        """Render the static background without data artists, then blit them"""
+        if self._layout:
+            try:
+                self.figure.tight_layout()
+            except Exception:
+                pass
+            self._layout = False
+
+        dynamic = self._dynamic_artists()
+        for _, artist in dynamic:
+            artist.set_visible(False)
+        self._capturing = True
+        try:
+            self.canvas.draw()
+            self._background = self.canvas.copy_from_bbox(self.figure.bbox)
+        finally:
+            self._capturing = False
+            for _, artist in dynamic:
+                artist.set_visible(True)
+
+        self._full = False
+        self.full_draws += 1
+        self._blit(dynamic)
+
+    def _blit(self, dynamic=None):
+        self.canvas.restore_region(self._background)
+        for ax, artist in (dynamic if dynamic is not None else self._dynamic_artists()):
+            ax.draw_artist(artist)
+        self.canvas.blit(self.figure.bbox)
+        self.blits += 1
+
+    def _on_draw(self, event):
+        # Any draw we did not start (resize, zoom, pan) makes the background stale
+        if not self._capturing:
+            self._background = None
+
+    def _on_resize(self, event):
+        self._background = None
+        self._layout = True
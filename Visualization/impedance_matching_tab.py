@@ -0,0 +1,238 @@
+"""
+Impedance Matching Tab - Plate-Impact Design Visualization
+Shows P-Up mirror curves for flyer/target pairs and multi-layer stacks
+using linear Us-Up parameters from the visualization database.
+"""
+
+import sys
+from pathlib import Path
+from typing import Optional
+
+import numpy as np
+
+from PyQt6.QtWidgets import (
+    QWidget, QVBoxLayout, QHBoxLayout, QPushButton, QLabel,
+    QLineEdit, QComboBox, QTableWidget, QTableWidgetItem,
+    QGroupBox, QMessageBox, QSplitter, QHeaderView
+)
+from PyQt6.QtCore import Qt
+
+from matplotlib.backends.backend_qtagg import FigureCanvasQTAgg as FigureCanvas
+from matplotlib.backends.backend_qtagg import NavigationToolbar2QT as NavigationToolbar
+from matplotlib.figure import Figure
+
+# Add project root to path
+sys.path.insert(0, str(Path(__file__).parent.parent))
+from physics.impedance import HugoniotTable, hugoniot_pressure, solve_stack, mirror_curves
+
+
+class ImpedanceMatchingTab(QWidget):
+    """
+    Impedance matching visualization:
+    - Select flyer, one or more target layers and impact velocity
+    - Plot target Hugoniots and mirrored flyer/layer curves in P-Up plane
+    - Tabulate interface states for every layer
+    """
+
+    def __init__(self, service=None, parent=None):
+        """
+        Args:
+            service: VisualizationDataService instance (created if None)
+        """
+        super().__init__(parent)
+        self.service = service
+        self.table: Optional[HugoniotTable] = None
+
+        self.init_ui()
+        self.load_materials()
+
+    def init_ui(self):
+        """Initialize the user interface."""
+        main_layout = QHBoxLayout(self)
+        splitter = QSplitter(Qt.Orientation.Horizontal)
+
+        # ========== Controls ==========
+        controls = QWidget()
+        controls_layout = QVBoxLayout(controls)
+
+        setup_group = QGroupBox("🎯 Shot Setup")
+        setup_layout = QVBoxLayout()
+
+        setup_layout.addWidget(QLabel("Flyer Material:"))
+        self.flyer_combo = QComboBox()
+        setup_layout.addWidget(self.flyer_combo)
+
+        setup_layout.addWidget(QLabel("Target Layers (impact side first):"))
+        self.layer_combo = QComboBox()
+        setup_layout.addWidget(self.layer_combo)
+
+        layer_buttons = QHBoxLayout()
+        add_layer_btn = QPushButton("➕ Add Layer")
+        add_layer_btn.clicked.connect(self.add_layer)
+        layer_buttons.addWidget(add_layer_btn)
+        clear_layers_btn = QPushButton("🗑️ Clear")
+        clear_layers_btn.clicked.connect(self.clear_layers)
+        layer_buttons.addWidget(clear_layers_btn)
+        setup_layout.addLayout(layer_buttons)
+
+        self.layers_label = QLabel("Layers: (none)")
+        self.layers_label.setWordWrap(True)
+        self.layers_label.setStyleSheet("color: #7f8c8d; font-size: 11px;")
+        setup_layout.addWidget(self.layers_label)
+
+        setup_layout.addWidget(QLabel("Impact Velocity (km/s):"))
+        self.velocity_input = QLineEdit("2.0")
+        setup_layout.addWidget(self.velocity_input)
+
+        setup_group.setLayout(setup_layout)
+        controls_layout.addWidget(setup_group)
+
+        self.solve_btn = QPushButton("📊 Solve && Plot")
+        self.solve_btn.setStyleSheet("""
+            QPushButton {
+                background-color: #27ae60;
+                color: white;
+                font-weight: bold;
+                padding: 10px;
+                border-radius: 6px;
+            }
+            QPushButton:hover {
+                background-color: #229954;
+            }
+        """)
+        self.solve_btn.clicked.connect(self.solve_and_plot)
+        controls_layout.addWidget(self.solve_btn)
+
+        self.status_label = QLabel("")
+        self.status_label.setStyleSheet("color: #7f8c8d; font-size: 11px;")
+        self.status_label.setWordWrap(True)
+        controls_layout.addWidget(self.status_label)
+        controls_layout.addStretch()
+
+        # ========== Plot + Table ==========
+        right = QWidget()
+        right_layout = QVBoxLayout(right)
+
+        self.figure = Figure(figsize=(8, 5), dpi=100)
+        self.canvas = FigureCanvas(self.figure)
+        self.ax = self.figure.add_subplot(111)
+        right_layout.addWidget(NavigationToolbar(self.canvas, self))
+        right_layout.addWidget(self.canvas)
+
+        self.results_table = QTableWidget()
+        self.results_table.setColumnCount(5)
+        self.results_table.setHorizontalHeaderLabels([
+            "Interface", "Up (km/s)", "P (GPa)", "Us (km/s)", "V/V₀"
+        ])
+        self.results_table.horizontalHeader().setSectionResizeMode(QHeaderView.ResizeMode.Stretch)
+        self.results_table.setMaximumHeight(180)
+        right_layout.addWidget(self.results_table)
+
+        splitter.addWidget(controls)
+        splitter.addWidget(right)
+        splitter.setStretchFactor(0, 0)
+        splitter.setStretchFactor(1, 1)
+        main_layout.addWidget(splitter)
+
+        self.layers = []
+
+    def load_materials(self):
+        """Load Us-Up parameters for all materials."""
+        try:
+            if self.service is None:
+                from Visualization.visualization_service import VisualizationDataService
+                self.service = VisualizationDataService()
+
+            self.table = HugoniotTable.from_service(self.service)
+            self.flyer_combo.clear()
+            self.layer_combo.clear()
+            self.flyer_combo.addItems(self.table.names)
+            self.layer_combo.addItems(self.table.names)
+            self.status_label.setText(f"{len(self.table)} materials with Us-Up parameters")
+        except Exception as e:
+            QMessageBox.warning(self, "Database Error", f"Failed to load Us-Up parameters: {e}")
+
+    def add_layer(self):
+        """Append selected material to the target stack."""
+        name = self.layer_combo.currentText()
+        if name:
+            self.layers.append(name)
+            self.layers_label.setText("Layers: " + " / ".join(self.layers))
+
+    def clear_layers(self):
+        """Clear the target stack."""
+        self.layers = []
+        self.layers_label.setText("Layers: (none)")
+
+    def solve_and_plot(self):
+        """Solve the stack and draw the P-Up diagram."""
+        if self.table is None or len(self.table) == 0:
+            QMessageBox.warning(self, "No Data", "No materials with Us-Up parameters")
+            return
+
+        flyer = self.flyer_combo.currentText()
+        layers = self.layers or [self.layer_combo.currentText()]
+
+        try:
+            velocity = float(self.velocity_input.text())
+        except ValueError:
+            QMessageBox.warning(self, "Input Error", "Impact velocity must be a number")
+            return
+
+        interfaces = solve_stack(self.table, flyer, layers, velocity)
+        self.update_plot(flyer, interfaces, velocity)
+        self.update_table(interfaces)
+
+    def update_plot(self, flyer: str, interfaces, velocity: float):
+        """Draw Hugoniots and mirror curves for each interface."""
+        self.ax.clear()
+
+        first = mirror_curves(self.table, flyer, interfaces[0]['downstream'], velocity)
+        self.ax.plot(first['up'], first['P_flyer'], '--', linewidth=2,
+                     label=f"{flyer} (flyer, mirrored)")
+
+        up_max = velocity
+        for iface in interfaces:
+            params = self.table.get(iface['downstream'])
+            up_grid = np.linspace(0.0, up_max, 200)
+            self.ax.plot(up_grid, hugoniot_pressure(params['rho0'], params['C0'], params['s'], up_grid),
+                         '-', linewidth=2, label=f"{iface['downstream']} Hugoniot")
+
+            up_state = float(iface['up'][0])
+            p_state = float(iface['P'][0])
+            self.ax.plot([up_state], [p_state], 'o', color='black', zorder=4)
+            self.ax.annotate(f"{p_state:.2f} GPa", (up_state, p_state),
+                             textcoords="offset points", xytext=(6, 6), fontsize=9)
+
+            # Mirror of this layer about its state (path into the next layer)
+            if iface is not interfaces[-1]:
+                mirror_up = np.linspace(0.0, 2.0 * up_state, 200)
+                self.ax.plot(mirror_up,
+                             hugoniot_pressure(params['rho0'], params['C0'], params['s'],
+                                               2.0 * up_state - mirror_up),
+                             ':', linewidth=1.5, label=f"{iface['downstream']} (mirrored)")
+                up_max = max(up_max, 2.0 * up_state)
+
+        self.ax.set_xlabel("Up (km/s)", fontsize=12, fontweight='bold')
+        self.ax.set_ylabel("P (GPa)", fontsize=12, fontweight='bold')
+        self.ax.set_title(f"Impedance Match: {flyer} at {velocity:.2f} km/s",
+                          fontsize=13, fontweight='bold')
+        self.ax.set_ylim(bottom=0.0)
+        self.ax.legend(loc='best', fontsize=9)
+        self.ax.grid(True, alpha=0.3, linestyle='--')
+        self.figure.tight_layout()
+        self.canvas.draw()
+
+    def update_table(self, interfaces):
+        """Tabulate interface states."""
+        self.results_table.setRowCount(len(interfaces))
+        for row, iface in enumerate(interfaces):
+            values = [
+                f"{iface['upstream']} | {iface['downstream']}",
+                f"{float(iface['up'][0]):.4f}",
+                f"{float(iface['P'][0]):.3f}",
+                f"{float(iface['us_target'][0]):.4f}",
+                f"{float(iface['v_ratio_target'][0]):.4f}"
+            ]
+            for col, text in enumerate(values):
+                self.results_table.setItem(row, col, QTableWidgetItem(text))
@@ -0,0 +1,346 @@
+"""
+Level of Detail - Decimation for dense plot series
+
+Interactive plots draw at most a few thousand points per series:
+- Lines are decimated with LTTB (Largest-Triangle-Three-Buckets) or
+  min/max bucketing, over the visible x-range only
+- Marker series and scatters keep one representative point per occupied
+  screen-space cell, so the shape, density and outliers stay visible
+- Axis-limit callbacks recompute the reduction on zoom and pan, so zooming
+  into a region reveals its full-resolution points
+
+Exports use full resolution: wrap savefig in full_resolution(fig).
+
+Usage:
+    lod = level_of_detail(fig)
+    lod.line(ax, x, y, '-', color='C0')
+    lod.scatter(ax, x, y, s=20)
+    with full_resolution(fig):
+        fig.savefig('plot.pdf')
+
+Author: Materials Database Team
+"""
+
+import weakref
+from contextlib import contextmanager
+from typing import Dict, List, Optional
+
+import numpy as np
+
+
+MAX_LINE_POINTS = 2000      # Points per decimated line (~2 per horizontal pixel)
+SCATTER_GRID = 300          # Screen-space cells per axis for point binning
+MAX_SCATTER_POINTS = 5000   # Marker series up to this size are never binned
+
+
+# ========== DECIMATION ==========
+
+def lttb_indices(x: np.ndarray, y: np.ndarray, n_out: int) -> np.ndarray:
+    """
+    Largest-Triangle-Three-Buckets downsampling.
+
+    Keeps the first and last point; from each of the n_out - 2 buckets in
+    between keeps the point forming the largest triangle with the previously
+    kept point and the mean of the next bucket.
+
+    Returns:
+        Sorted indices into x/y
+    """
+    n = len(x)
+    if n_out >= n or n_out < 3:
+        return np.arange(n)
+
+    edges = np.linspace(1, n - 1, n_out - 1).astype(np.int64)
+    # Bucket means, with the last point standing in after the final bucket
+    sums_x = np.add.reduceat(x[1:n - 1], edges[:-1] - 1)
+    sums_y = np.add.reduceat(y[1:n - 1], edges[:-1] - 1)
+    counts = np.diff(edges)
+    mean_x = np.append(sums_x / counts, x[-1])
+    mean_y = np.append(sums_y / counts, y[-1])
+
+    out = np.empty(n_out, dtype=np.int64)
+    out[0], out[-1] = 0, n - 1
+    a = 0
+    for i in range(n_out - 2):
+        lo, hi = edges[i], edges[i + 1]
+        bx, by = x[lo:hi], y[lo:hi]
+        area = np.abs((x[a] - mean_x[i + 1]) * (by - y[a]) - (x[a] - bx) * (mean_y[i + 1] - y[a]))
+        a = lo + int(np.argmax(area))
+        out[i + 1] = a
+    return out
+
+
+def minmax_indices(y: np.ndarray, n_out: int) -> np.ndarray:
+    """
+    Min/max bucketing: the first, last, minimum and maximum of each bucket.
+
+    Cheaper than LTTB and keeps every spike, at the cost of a noisier look.
+
+    Returns:
+        Sorted indices into y
+    """
+    n = len(y)
+    n_buckets = max(n_out // 2, 1)
+    if n_out >= n or n < 4 * n_buckets:
+        return np.arange(n)
+
+    size = n // n_buckets
+    body = y[:size * n_buckets].reshape(n_buckets, size)
+    starts = np.arange(n_buckets) * size
+    keep = np.concatenate((
+        starts + np.nanargmin(np.where(np.isnan(body), np.inf, body), axis=1),
+        starts + np.nanargmax(np.where(np.isnan(body), -np.inf, body), axis=1),
+        [0, n - 1],
+        np.arange(size * n_buckets, n),
+    ))
+    return np.unique(keep)
+
+
+def binned_indices(x: np.ndarray, y: np.ndarray, xlim, ylim, grid: int = SCATTER_GRID) -> np.ndarray:
+    """
+    One representative point per occupied cell of a grid x grid raster
+    over the view.
+
+    Points outside the view are dropped; a marker covers roughly one cell,
+    so the binned plot looks like the full one at screen resolution.
+
+    Returns:
+        Sorted indices of the kept points
+    """
+    x0, x1 = sorted(xlim)
+    y0, y1 = sorted(ylim)
+    inside = np.flatnonzero((x >= x0) & (x <= x1) & (y >= y0) & (y <= y1))
+    if len(inside) <= grid:
+        return inside
+
+    cx = ((x[inside] - x0) * (grid / ((x1 - x0) or 1.0))).astype(np.int64).clip(0, grid - 1)
+    cy = ((y[inside] - y0) * (grid / ((y1 - y0) or 1.0))).astype(np.int64).clip(0, grid - 1)
+    _, first = np.unique(cx * grid + cy, return_index=True)
+    return inside[np.sort(first)]
+
+
+# ========== AXES INTEGRATION ==========
+
+def _extreme_indices(x: np.ndarray, y: np.ndarray) -> np.ndarray:
+    """Indices of the finite minimum and maximum of x and y"""
+    finite = np.flatnonzero(np.isfinite(x) & np.isfinite(y))
+    if len(finite) == 0:
+        return finite
+    fx, fy = x[finite], y[finite]
+    return np.unique(finite[[np.argmin(fx), np.argmax(fx), np.argmin(fy), np.argmax(fy)]])
+
+
+class _Series:
+    """A registered artist with its full-resolution data."""
+
+    def __init__(self, artist, x, y, kind: str, method: str):
+        self.artist = artist
+        self.x = np.asarray(x, dtype=float)
+        self.y = np.asarray(y, dtype=float)
+        self.kind = kind            # 'line', 'markers' (Line2D without a line) or 'scatter'
+        self.method = method        # 'lttb' or 'minmax' for lines
+        self.sorted = bool(np.all(np.diff(self.x) >= 0)) if len(self.x) > 1 else True
+        self.shown = None           # Indices currently drawn (None = all)
+        self.per_point = {}         # Per-point scatter properties (colors, sizes)
+        self.extremes = _extreme_indices(self.x, self.y)
+        if kind == 'scatter':
+            self._capture_per_point()
+
+    def _capture_per_point(self):
+        n = len(self.x)
+        getters = {
+            'array': self.artist.get_array,
+            'sizes': self.artist.get_sizes,
+            'facecolors': self.artist.get_facecolors,
+            'edgecolors': self.artist.get_edgecolors,
+        }
+        for name, getter in getters.items():
+            value = getter()
+            if value is not None and n > 1 and len(value) == n:
+                self.per_point[name] = np.asarray(value)
+
+    def show(self, idx: Optional[np.ndarray]):
+        """Draw the subset idx (None = full resolution)"""
+        if idx is not None and len(idx) == len(self.x):
+            idx = None
+        if idx is None and self.shown is None:
+            return
+        self.shown = idx
+        sel = slice(None) if idx is None else idx
+        if self.kind == 'scatter':
+            self.artist.set_offsets(np.column_stack((self.x[sel], self.y[sel])))
+            setters = {
+                'array': self.artist.set_array,
+                'sizes': self.artist.set_sizes,
+                'facecolors': self.artist.set_facecolors,
+                'edgecolors': self.artist.set_edgecolors,
+            }
+            for name, value in self.per_point.items():
+                setters[name](value[sel])
+        else:
+            self.artist.set_data(self.x[sel], self.y[sel])
+
+
+class LevelOfDetail:
+    """
+    Level-of-detail controller for the axes of one figure.
+
+    Series are registered per axes; whenever an axes' limits change the
+    registered series are reduced again for the new view.
+    """
+
+    def __init__(self, max_line_points: int = MAX_LINE_POINTS,
+                 scatter_grid: int = SCATTER_GRID, max_scatter_points: int = MAX_SCATTER_POINTS):
+        self.max_line_points = max_line_points
+        self.scatter_grid = scatter_grid
+        self.max_scatter_points = max_scatter_points
+        self._series: Dict[object, List[_Series]] = {}   # axes -> series
+        self._suspended = False
+
+    # ---------- registration ----------
+
+    def line(self, ax, x, y, *args, method: str = 'lttb', **kwargs):
+        """ax.plot() with decimation; returns the Line2D list like ax.plot"""
+        x = np.asarray(x, dtype=float)
+        y = np.asarray(y, dtype=float)
+        lines = ax.plot(x, y, *args, **kwargs)
+        for line in lines:
+            self.attach(line, x, y, method=method)
+        return lines
+
+    def scatter(self, ax, x, y, **kwargs):
+        """ax.scatter() with screen-space binning; returns the PathCollection"""
+        x = np.asarray(x, dtype=float)
+        y = np.asarray(y, dtype=float)
+        collection = ax.scatter(x, y, **kwargs)
+        self.attach(collection, x, y)
+        return collection
+
+    def attach(self, artist, x=None, y=None, method: str = 'lttb'):
+        """
+        Register an existing Line2D or PathCollection.
+
+        Args:
+            artist: Artist already on an axes
+            x, y: Full-resolution data (defaults to the artist's data)
+            method: 'lttb' or 'minmax' for lines
+        """
+        if hasattr(artist, 'get_offsets'):
+            if x is None:
+                x, y = np.asarray(artist.get_offsets()).T
+            kind = 'scatter'
+        else:
+            if x is None:
+                x, y = artist.get_xdata(), artist.get_ydata()
+            kind = 'markers' if artist.get_linestyle() in ('None', '', ' ') else 'line'
+
+        ax = artist.axes
+        if ax not in self._series:
+            self._series[ax] = []
+            ax.callbacks.connect('xlim_changed', self._on_limits)
+            ax.callbacks.connect('ylim_changed', self._on_limits)
+        series = _Series(artist, x, y, kind, method)
+        self._series[ax].append(series)
+        self._reduce(ax, series)
+        return artist
+
+    def detach(self, artist):
+        """Stop tracking an artist (e.g. before removing it)"""
+        for ax, series in self._series.items():
+            series[:] = [s for s in series if s.artist is not artist]
+
+    def clear(self):
+        """Forget every series (after figure.clear())"""
+        self._series.clear()
+
+    def shown_points(self, artist) -> int:
+        """Number of points currently drawn for an artist"""
+        for series in self._series.values():
+            for s in series:
+                if s.artist is artist:
+                    return len(s.x) if s.shown is None else len(s.shown)
+        return 0
+
+    # ---------- reduction ----------
+
+    def _on_limits(self, ax):
+        if self._suspended:
+            return
+        for series in self._series.get(ax, []):
+            self._reduce(ax, series)
+
+    def _reduce(self, ax, series: _Series):
+        # Drop series whose artist was removed from the axes
+        if series.artist.axes is None:
+            self._series[ax].remove(series)
+            return
+        series.show(self._indices(ax, series))
+
+    def _indices(self, ax, s: _Series) -> Optional[np.ndarray]:
+        idx = self._reduced(ax, s)
+        if idx is None:
+            return None
+        # Keep the extremes so relim()/autoscale still see the full data limits
+        return np.union1d(idx, s.extremes)
+
+    def _reduced(self, ax, s: _Series) -> Optional[np.ndarray]:
+        n = len(s.x)
+        if s.kind == 'line':
+            if n <= self.max_line_points:
+                return None
+            lo, hi = 0, n
+            if s.sorted:
+                # Visible x-range plus one point either side so the line reaches the edges
+                x0, x1 = sorted(ax.get_xlim())
+                lo = max(int(np.searchsorted(s.x, x0, side='left')) - 1, 0)
+                hi = min(int(np.searchsorted(s.x, x1, side='right')) + 1, n)
+            if hi - lo <= self.max_line_points:
+                return np.arange(lo, hi)
+            if s.method == 'minmax':
+                return lo + minmax_indices(s.y[lo:hi], self.max_line_points)
+            return lo + lttb_indices(s.x[lo:hi], s.y[lo:hi], self.max_line_points)
+
+        if n <= self.max_scatter_points:
+            return None
+        return binned_indices(s.x, s.y, ax.get_xlim(), ax.get_ylim(), self.scatter_grid)
+
+    def refresh(self):
+        """Recompute every series for the current limits"""
+        for ax, series in list(self._series.items()):
+            for s in list(series):
+                self._reduce(ax, s)
+
+    @contextmanager
+    def full_resolution(self):
+        """Draw every point inside the block (for exports)"""
+        self._suspended = True
+        try:
+            for series in self._series.values():
+                for s in series:
+                    s.show(None)
+            yield
+        finally:
+            self._suspended = False
+            self.refresh()
+
+
+_controllers = weakref.WeakKeyDictionary()
+
+
+def level_of_detail(figure) -> LevelOfDetail:
+    """Level-of-detail controller of a figure (created on first use)"""
+    controller = _controllers.get(figure)
+    if controller is None:
+        controller = _controllers[figure] = LevelOfDetail()
+    return controller
+
+
+@contextmanager
+def full_resolution(figure):
+    """Full-resolution drawing for a figure while saving; no-op without a controller"""
+    controller = _controllers.get(figure)
+    if controller is None:
+        yield
+        return
+    with controller.full_resolution():
+        yield
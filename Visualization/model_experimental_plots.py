@@ -22,6 +22,7 @@ import sys
 # Add project root to path
 sys.path.insert(0, str(Path(__file__).parent.parent))
 from services.plotting_utils import PlottingUtils, apply_publication_style
+from services.level_of_detail import level_of_detail
 
 # Set up logging
 logging.basicConfig(level=logging.INFO)
@@ -264,6 +265,9 @@ def plot_model_vs_experimental(
     # Apply theme
     apply_theme_to_figure(fig, theme)
     
+    # Dense series are decimated for display (exports use full resolution)
+    lod = level_of_detail(fig)
+    
     # Extract metadata with defaults
     if metadata is None:
         metadata = {}
@@ -287,8 +291,8 @@ def plot_model_vs_experimental(
         if show_equation and model_equation:
             model_label = f"{model_name}: {model_equation}"
         
-        ax.plot(
-            model_x, model_y,
+        lod.line(
+            ax, model_x, model_y,
             color=theme['model_color'],
             linestyle='-',
             linewidth=2.5,
@@ -303,8 +307,8 @@ def plot_model_vs_experimental(
     exp_labels = exp_data.get('labels', None)  # Optional point labels
     
     if len(exp_x) > 0 and len(exp_y) > 0:
-        ax.scatter(
-            exp_x, exp_y,
+        lod.scatter(
+            ax, exp_x, exp_y,
             color=theme['exp_color'],
             marker='o',
             s=100,
@@ -15,6 +15,11 @@ import numpy as np
 from typing import Dict, List, Tuple, Optional, Union
 import logging
 
+try:
+    from services.level_of_detail import full_resolution
+except ImportError:
+    from Visualization.level_of_detail import full_resolution
+
 # Configure logging
 logging.basicConfig(level=logging.INFO)
 logger = logging.getLogger(__name__)
@@ -372,15 +377,17 @@ class PlottingUtils:
         if not filename.endswith(f'.{format}'):
             filename = f'{filename}.{format}'
         
-        fig.savefig(
-            filename,
-            dpi=dpi,
-            format=format,
-            bbox_inches='tight',
-            transparent=transparent,
-            facecolor='white' if not transparent else 'none',
-            edgecolor='none'
-        )
+        # Decimated series are exported at full resolution
+        with full_resolution(fig):
+            fig.savefig(
+                filename,
+                dpi=dpi,
+                format=format,
+                bbox_inches='tight',
+                transparent=transparent,
+                facecolor='white' if not transparent else 'none',
+                edgecolor='none'
+            )
         
         logger.info(f"Saved figure to: {filename} ({format}, {dpi} DPI)")
     
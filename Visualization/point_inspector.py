@@ -0,0 +1,284 @@
+"""
+Point Inspector - Hover and click inspection for dense plots
+
+Registered point sets are indexed by a KD-tree over their screen-space
+(pixel) coordinates. The tree is rebuilt only when points are added or an
+axes' limits or size changed (zoom, pan, resize), so each mouse move is one
+O(log n) nearest-point query instead of matplotlib's linear scan over every
+artist.
+
+Usage:
+    inspector = PointInspector(canvas, show=show_tooltip, hide=hide_tooltip)
+    inspector.add_points(ax, up, us, lambda i: f"Point {i}")
+    inspector.clear()   # before redrawing the figure
+
+Author: Materials Database Team
+"""
+
+import math
+from typing import Callable, List, Optional, Sequence, Tuple, Union
+
+import numpy as np
+
+
+# ========== KD-TREE ==========
+
+class KDTree:
+    """
+    Static 2-D KD-tree over an (n, 2) array.
+
+    The tree is implicit: nodes are (lo, hi) ranges of a permutation, split
+    at the median of alternating axes until LEAF_SIZE points remain; leaves
+    are scanned with NumPy.
+    """
+
+    LEAF_SIZE = 16
+
+    def __init__(self, points: np.ndarray):
+        self.points = np.asarray(points, dtype=float).reshape(-1, 2)
+        self.order = np.arange(len(self.points))
+        self._build()
+
+    def _build(self):
+        stack = [(0, len(self.points), 0)]
+        while stack:
+            lo, hi, axis = stack.pop()
+            if hi - lo <= self.LEAF_SIZE:
+                continue
+            mid = (lo + hi) // 2
+            seg = self.order[lo:hi]
+            part = np.argpartition(self.points[seg, axis], mid - lo)
+            self.order[lo:hi] = seg[part]
+            stack.append((lo, mid, 1 - axis))
+            stack.append((mid + 1, hi, 1 - axis))
+
+    def __len__(self):
+        return len(self.points)
+
+    def query(self, point: Sequence[float], max_distance: float = math.inf) -> Tuple[int, float]:
+        """
+        Nearest point to `point`.
+
+        Returns:
+            (index, distance), or (-1, inf) if no point is within max_distance
+        """
+        px, py = float(point[0]), float(point[1])
+        best = [-1, max_distance * max_distance]
+        points, order = self.points, self.order
+
+        def visit(lo, hi, axis):
+            if hi - lo <= self.LEAF_SIZE:
+                if hi > lo:
+                    leaf = order[lo:hi]
+                    d = (points[leaf, 0] - px) ** 2 + (points[leaf, 1] - py) ** 2
+                    k = int(np.argmin(d))
+                    if d[k] < best[1]:
+                        best[0], best[1] = int(leaf[k]), float(d[k])
+                return
+            mid = (lo + hi) // 2
+            node = order[mid]
+            nx, ny = points[node]
+            d = (nx - px) ** 2 + (ny - py) ** 2
+            if d < best[1]:
+                best[0], best[1] = int(node), float(d)
+            diff = (px - nx) if axis == 0 else (py - ny)
+            near, far = ((lo, mid), (mid + 1, hi)) if diff < 0 else ((mid + 1, hi), (lo, mid))
+            visit(near[0], near[1], 1 - axis)
+            if diff * diff < best[1]:
+                visit(far[0], far[1], 1 - axis)
+
+        visit(0, len(points), 0)
+        if best[0] < 0:
+            return -1, math.inf
+        return best[0], math.sqrt(best[1])
+
+
+# ========== INSPECTOR ==========
+
+Describer = Union[Callable[[int], str], Sequence[str]]
+
+
+class _PointSet:
+    def __init__(self, ax, x, y, describe: Describer, name: Optional[str]):
+        self.ax = ax
+        self.data = np.column_stack((np.asarray(x, dtype=float), np.asarray(y, dtype=float)))
+        self.describe = describe
+        self.name = name
+
+    def text(self, i: int) -> str:
+        if callable(self.describe):
+            text = self.describe(i)
+        elif self.describe is not None:
+            text = str(self.describe[i])
+        else:
+            x, y = self.data[i]
+            text = f"x = {x:.4g}\ny = {y:.4g}"
+        return f"{self.name}\n{text}" if self.name else text
+
+
+class PointInspector:
+    """
+    Hover/click inspector for a matplotlib canvas.
+
+    Tooltips go through the show/hide callbacks (e.g. QToolTip in Qt widgets);
+    without them an annotation is drawn on the hovered axes.
+    """
+
+    def __init__(self, canvas, show: Optional[Callable[[str, object], None]] = None,
+                 hide: Optional[Callable[[], None]] = None, radius: float = 8.0,
+                 on_pick: Optional[Callable[[str, object], None]] = None):
+        """
+        Args:
+            canvas: matplotlib canvas
+            show: show(text, mouse_event) displays a tooltip
+            hide: hide() removes it
+            radius: Maximum pick distance in pixels
+            on_pick: on_pick(text, mouse_event) called for clicks on a point
+        """
+        self.canvas = canvas
+        self.radius = radius
+        self._show = show
+        self._hide = hide
+        self.on_pick = on_pick
+
+        self._sets: List[_PointSet] = []
+        self._tree: Optional[KDTree] = None
+        self._owner = None          # (set index, point index) of every tree point
+        self._key = None            # Transform state the tree was built for
+        self._hovered = None
+        self._annotation = None
+        self.builds = 0
+
+        canvas.mpl_connect('motion_notify_event', self._on_motion)
+        canvas.mpl_connect('button_press_event', self._on_click)
+
+    # ---------- registration ----------
+
+    def clear(self):
+        """Forget all point sets (call when the figure is cleared)"""
+        self._sets.clear()
+        self._tree = None
+        self._key = None
+        if self._hovered is not None and self._hide is not None:
+            self._hide()
+        self._hovered = None
+        self._annotation = None
+
+    def add_points(self, ax, x, y, describe: Describer = None, name: Optional[str] = None):
+        """
+        Register points drawn on an axes.
+
+        Args:
+            ax: Axes the points are drawn on (data coordinates)
+            x, y: Point coordinates (non-finite points are ignored)
+            describe: describe(i) -> tooltip text, or a sequence of texts
+            name: Optional heading (e.g. material or series name)
+        """
+        self._sets.append(_PointSet(ax, x, y, describe, name))
+        self._key = None
+
+    def remove_points(self, name: str):
+        """Forget the point sets registered under a name"""
+        self._sets = [s for s in self._sets if s.name != name]
+        self._key = None
+        if self._hovered is not None:
+            self._hovered = None
+            self._hide_tooltip()
+
+    def add_collection(self, artist, describe: Describer = None, name: Optional[str] = None):
+        """Register the points of a scatter (PathCollection) or Line2D"""
+        if hasattr(artist, 'get_offsets'):
+            x, y = np.asarray(artist.get_offsets(), dtype=float).reshape(-1, 2).T
+        else:
+            x, y = artist.get_xdata(), artist.get_ydata()
+        self.add_points(artist.axes, x, y, describe, name)
+
+    # ---------- index ----------
+
+    def _state(self):
+        return tuple((tuple(s.ax.bbox.bounds), tuple(s.ax.viewLim.bounds)) for s in self._sets)
+
+    def _ensure_tree(self):
+        key = self._state()
+        if self._tree is not None and key == self._key:
+            return
+        screens, owners = [], []
+        for k, s in enumerate(self._sets):
+            if s.ax.figure is None:
+                continue
+            screen = s.ax.transData.transform(s.data)
+            valid = np.flatnonzero(np.isfinite(screen).all(axis=1))
+            screens.append(screen[valid])
+            owners.append(np.column_stack((np.full(len(valid), k), valid)))
+        points = np.concatenate(screens) if screens else np.empty((0, 2))
+        self._owner = np.concatenate(owners) if owners else np.empty((0, 2), dtype=np.int64)
+        self._tree = KDTree(points)
+        self._key = key
+        self.builds += 1
+
+    def nearest(self, x_px: float, y_px: float) -> Optional[Tuple[int, int, float]]:
+        """
+        Nearest registered point to a pixel position within the pick radius.
+
+        Returns:
+            (set index, point index, distance in pixels) or None
+        """
+        if not self._sets:
+            return None
+        self._ensure_tree()
+        i, distance = self._tree.query((x_px, y_px), self.radius)
+        if i < 0:
+            return None
+        k, j = self._owner[i]
+        return int(k), int(j), distance
+
+    def text_at(self, x_px: float, y_px: float) -> Optional[str]:
+        hit = self.nearest(x_px, y_px)
+        if hit is None:
+            return None
+        return self._sets[hit[0]].text(hit[1])
+
+    # ---------- events ----------
+
+    def _on_motion(self, event):
+        hit = self.nearest(event.x, event.y) if event.inaxes is not None else None
+        if hit is None:
+            if self._hovered is not None:
+                self._hovered = None
+                self._hide_tooltip()
+            return
+        if hit[:2] == self._hovered:
+            return
+        self._hovered = hit[:2]
+        self._show_tooltip(self._sets[hit[0]], hit[1], event)
+
+    def _on_click(self, event):
+        if self.on_pick is None or event.inaxes is None:
+            return
+        text = self.text_at(event.x, event.y)
+        if text is not None:
+            self.on_pick(text, event)
+
+    def _show_tooltip(self, point_set: _PointSet, i: int, event):
+        text = point_set.text(i)
+        if self._show is not None:
+            self._show(text, event)
+            return
+        if self._annotation is None or self._annotation.axes is not point_set.ax:
+            if self._annotation is not None:
+                self._annotation.remove()
+            self._annotation = point_set.ax.annotate(
+                '', xy=(0, 0), xytext=(12, 12), textcoords='offset points', fontsize=9,
+                bbox=dict(boxstyle='round,pad=0.4', facecolor='lightyellow', alpha=0.95),
+                arrowprops=dict(arrowstyle='->', color='gray'), zorder=10)
+        self._annotation.xy = tuple(point_set.data[i])
+        self._annotation.set_text(text)
+        self._annotation.set_visible(True)
+        self.canvas.draw_idle()
+
+    def _hide_tooltip(self):
+        if self._hide is not None:
+            self._hide()
+        elif self._annotation is not None:
+            self._annotation.set_visible(False)
+            self.canvas.draw_idle()
@@ -0,0 +1,401 @@
+"""
+Columnar Property Catalogue
+In-memory, column-oriented copy of xml_finalized_parameters for the
+visualization tabs.
+
+All materials are loaded once into NumPy arrays:
+- material, property, unit and reference strings are integer-coded through
+  dictionaries (codes are stable across refreshes; new names are appended)
+- values are float64 (NaN when the stored text is not numeric), the
+  original text is kept alongside
+- rows are sorted by (property, material, entry_index), so all entries of
+  one property are a contiguous, zero-copy slice
+- a dense (n_properties × n_materials) matrix holds the first entry of
+  every property, so "property P for materials M" is a row view or a
+  small fancy-indexed block instead of a query
+
+refresh() first compares a cheap change signal (the trigger-maintained
+table_versions counters, or the highest value_id and the tables' write
+statistics where those cannot be installed); only when it moved does it
+compare per-material checksums computed in SQL and reload the materials
+whose rows changed.
+
+Author: Materials Database Team
+"""
+
+from typing import Dict, List, Optional, Any
+
+import numpy as np
+
+
+CATALOGUE_QUERY = """
+SELECT
+    p.material_id,
+    m.name AS material_name,
+    p.parameter_name,
+    p.parameter_unit,
+    p.parameter_value,
+    p.value_ref,
+    p.value_id,
+    p.entry_index,
+    p.category_name,
+    p.category_number
+FROM xml_finalized_parameters p
+JOIN xml_finalized_materials m ON p.material_id = m.material_id
+WHERE p.is_empty_value = FALSE
+  AND p.parameter_value IS NOT NULL
+"""
+
+CHECKSUM_QUERY = """
+SELECT
+    p.material_id,
+    md5(string_agg(
+        p.parameter_name || '|' || COALESCE(p.entry_index::text, '') || '|' ||
+        p.parameter_value || '|' || COALESCE(p.parameter_unit, '') || '|' ||
+        COALESCE(p.value_ref::text, '') || '|' || m.name,
+        ',' ORDER BY p.parameter_name, p.entry_index, p.value_id
+    )) AS checksum
+FROM xml_finalized_parameters p
+JOIN xml_finalized_materials m ON p.material_id = m.material_id
+WHERE p.is_empty_value = FALSE
+  AND p.parameter_value IS NOT NULL
+GROUP BY p.material_id
+"""
+
+# Cheap change signal: the trigger-maintained counters of the catalogue tables
+CHANGE_SIGNAL_QUERY = """
+SELECT COALESCE(SUM(version), 0) AS version
+FROM table_versions
+WHERE table_name IN ('xml_finalized_parameters', 'xml_finalized_materials')
+"""
+
+# Without the counters: highest value_id (primary key index) and statistics counters
+FALLBACK_SIGNAL_QUERY = """
+SELECT
+    (SELECT MAX(value_id) FROM xml_finalized_parameters) AS max_value_id,
+    (SELECT COALESCE(SUM(n_tup_ins + n_tup_upd + n_tup_del), 0)
+     FROM pg_stat_user_tables
+     WHERE relname IN ('xml_finalized_parameters', 'xml_finalized_materials')) AS writes
+"""
+
+
+def _to_float(value) -> float:
+    """Convert a stored TEXT value to float (NaN if not numeric)."""
+    try:
+        return float(value)
+    except (TypeError, ValueError):
+        return float('nan')
+
+
+class _Codes:
+    """Append-only string dictionary (name <-> integer code)."""
+
+    def __init__(self, initial: Optional[List[str]] = None):
+        self.names: List[str] = []
+        self._codes: Dict[Any, int] = {}
+        for name in initial or []:
+            self.encode(name)
+
+    def __len__(self):
+        return len(self.names)
+
+    def __contains__(self, name) -> bool:
+        return name in self._codes
+
+    def encode(self, name) -> int:
+        """Get the code for a name, adding it if new."""
+        code = self._codes.get(name)
+        if code is None:
+            code = len(self.names)
+            self._codes[name] = code
+            self.names.append(name)
+        return code
+
+    def code(self, name) -> int:
+        """Get the code for an existing name (KeyError if unknown)."""
+        return self._codes[name]
+
+
+class PropertyCatalogue:
+    """
+    Columnar catalogue of all material properties.
+
+    Long-format columns (one element per stored entry):
+        material, property, unit, ref: int32 codes
+        value: float64, text: object (original string)
+        value_id: int64, entry_index: int32
+    """
+
+    def __init__(self):
+        """Initialize an empty catalogue (use load() to fill it)."""
+        self.materials = _Codes()          # material_id -> code
+        self.properties = _Codes()         # parameter_name -> code
+        self.units = _Codes([''])          # code 0 = no unit
+        self.refs = _Codes([''])           # code 0 = no reference
+        self.material_names: List[str] = []
+        self.property_categories: List[str] = []
+        self.property_category_numbers: List[int] = []
+
+        self.material = np.empty(0, dtype=np.int32)
+        self.property = np.empty(0, dtype=np.int32)
+        self.unit = np.empty(0, dtype=np.int32)
+        self.ref = np.empty(0, dtype=np.int32)
+        self.value = np.empty(0, dtype=np.float64)
+        self.text = np.empty(0, dtype=object)
+        self.value_id = np.empty(0, dtype=np.int64)
+        self.entry_index = np.empty(0, dtype=np.int32)
+
+        self.first = np.empty((0, 0))                      # first entry value
+        self.first_row = np.empty((0, 0), dtype=np.int64)  # row of first entry (-1 = none)
+        self._offsets = np.zeros(1, dtype=np.int64)
+
+        self._checksums: Dict[int, str] = {}
+        self._signal: Optional[Dict[str, Any]] = None
+        self.version = 0
+
+    def __len__(self):
+        return len(self.value)
+
+    # ========================================================================
+    # LOADING
+    # ========================================================================
+
+    def load(self, service) -> 'PropertyCatalogue':
+        """
+        Load every material from the database.
+
+        Args:
+            service: VisualizationDataService (uses its _execute_query)
+
+        Returns:
+            self
+        """
+        self._signal = self._change_signal(service)
+        checksums = service._execute_query(CHECKSUM_QUERY)
+        rows = service._execute_query(CATALOGUE_QUERY)
+        self._replace_materials(rows, None)
+        self._checksums = {row['material_id']: row['checksum'] for row in checksums}
+        print(f"✓ Property catalogue loaded: {len(self)} entries, "
+              f"{len(self.properties)} properties, {len(self._checksums)} materials")
+        return self
+
+    def refresh(self, service) -> List[int]:
+        """
+        Reload only materials whose rows changed since the last load/refresh.
+
+        Args:
+            service: VisualizationDataService
+
+        Returns:
+            Material IDs that were added, changed or removed
+        """
+        signal = self._change_signal(service)
+        if signal is not None and signal == self._signal:
+            return []
+        self._signal = signal
+        
+        current = {row['material_id']: row['checksum'] for row in service._execute_query(CHECKSUM_QUERY)}
+        changed = [mid for mid, checksum in current.items() if self._checksums.get(mid) != checksum]
+        removed = [mid for mid in self._checksums if mid not in current]
+
+        if not changed and not removed:
+            return []
+
+        rows = []
+        if changed:
+            rows = service._execute_query(CATALOGUE_QUERY + " AND p.material_id = ANY(%s)", (changed,))
+        self._replace_materials(rows, changed + removed)
+        self._checksums = current
+        print(f"✓ Property catalogue refreshed: {len(changed)} changed, {len(removed)} removed")
+        return changed + removed
+
+    @staticmethod
+    def _change_signal(service) -> Optional[Dict[str, Any]]:
+        """Table version counters, or the fallback signal (None if unavailable)."""
+        query = CHANGE_SIGNAL_QUERY if service._ensure_table_versions() else FALLBACK_SIGNAL_QUERY
+        rows = service._execute_query(query)
+        return dict(rows[0]) if rows else None
+
+    def _replace_materials(self, rows: List[Dict], material_ids: Optional[List[int]]):
+        """
+        Replace the rows of some materials (all materials if material_ids is None).
+        """
+        if material_ids is None:
+            keep = np.zeros(len(self.value), dtype=bool)
+        else:
+            codes = [self.materials.code(mid) for mid in material_ids if mid in self.materials]
+            keep = ~np.isin(self.material, codes)
+
+        n = len(rows)
+        material = np.empty(n, dtype=np.int32)
+        prop = np.empty(n, dtype=np.int32)
+        unit = np.empty(n, dtype=np.int32)
+        ref = np.empty(n, dtype=np.int32)
+        value_id = np.empty(n, dtype=np.int64)
+        entry_index = np.empty(n, dtype=np.int32)
+        text = np.empty(n, dtype=object)
+
+        for i, row in enumerate(rows):
+            m = self.materials.encode(row['material_id'])
+            if m == len(self.material_names):
+                self.material_names.append(row['material_name'])
+            else:
+                self.material_names[m] = row['material_name']
+
+            p = self.properties.encode(row['parameter_name'])
+            if p == len(self.property_categories):
+                self.property_categories.append(row.get('category_name'))
+                self.property_category_numbers.append(row.get('category_number'))
+
+            material[i] = m
+            prop[i] = p
+            unit[i] = self.units.encode(row.get('parameter_unit') or '')
+            ref[i] = self.refs.encode(str(row['value_ref']) if row.get('value_ref') is not None else '')
+            value_id[i] = row.get('value_id') if row.get('value_id') is not None else -1
+            entry_index[i] = row.get('entry_index') or 0
+            text[i] = row['parameter_value']
+
+        value = np.array([_to_float(t) for t in text], dtype=np.float64)
+
+        columns = {
+            'material': np.concatenate([self.material[keep], material]),
+            'property': np.concatenate([self.property[keep], prop]),
+            'unit': np.concatenate([self.unit[keep], unit]),
+            'ref': np.concatenate([self.ref[keep], ref]),
+            'value': np.concatenate([self.value[keep], value]),
+            'text': np.concatenate([self.text[keep], text]),
+            'value_id': np.concatenate([self.value_id[keep], value_id]),
+            'entry_index': np.concatenate([self.entry_index[keep], entry_index]),
+        }
+
+        order = np.lexsort((columns['value_id'], columns['entry_index'],
+                            columns['material'], columns['property']))
+        for name, column in columns.items():
+            setattr(self, name, column[order])
+
+        self._rebuild_index()
+        self.version += 1
+
+    def _rebuild_index(self):
+        """Rebuild property offsets and the dense first-entry matrices."""
+        n_props, n_mats = len(self.properties), len(self.materials)
+        self._offsets = np.searchsorted(self.property, np.arange(n_props + 1)).astype(np.int64)
+
+        self.first = np.full((n_props, n_mats), np.nan)
+        self.first_row = np.full((n_props, n_mats), -1, dtype=np.int64)
+        if len(self.value):
+            head = np.ones(len(self.value), dtype=bool)
+            head[1:] = (self.property[1:] != self.property[:-1]) | (self.material[1:] != self.material[:-1])
+            rows = np.flatnonzero(head)
+            self.first[self.property[rows], self.material[rows]] = self.value[rows]
+            self.first_row[self.property[rows], self.material[rows]] = rows
+
+    # ========================================================================
+    # QUERIES
+    # ========================================================================
+
+    def material_codes(self, material_ids: List[int]) -> np.ndarray:
+        """Codes for material IDs (KeyError for unknown IDs)."""
+        return np.array([self.materials.code(mid) for mid in material_ids], dtype=np.int64)
+
+    def property_codes(self, property_names: List[str]) -> np.ndarray:
+        """Codes for property names (KeyError for unknown names)."""
+        return np.array([self.properties.code(name) for name in property_names], dtype=np.int64)
+
+    def entries(self, property_name: str) -> Dict[str, np.ndarray]:
+        """
+        Every stored entry of one property (zero-copy views).
+
+        Returns:
+            Dictionary of long-format column slices (material, unit, ref codes,
+            value, text, value_id, entry_index); empty if the property is unknown
+        """
+        if property_name not in self.properties:
+            return {name: getattr(self, name)[:0] for name in
+                    ('material', 'unit', 'ref', 'value', 'text', 'value_id', 'entry_index')}
+        p = self.properties.code(property_name)
+        rows = slice(self._offsets[p], self._offsets[p + 1])
+        return {name: getattr(self, name)[rows] for name in
+                ('material', 'unit', 'ref', 'value', 'text', 'value_id', 'entry_index')}
+
+    def column(self, property_name: str) -> np.ndarray:
+        """First-entry value of a property for every material code (zero-copy view)."""
+        return self.first[self.properties.code(property_name)]
+
+    def values(self, material_ids: List[int], property_names: List[str]) -> np.ndarray:
+        """
+        First-entry values as a (n_properties, n_materials) matrix.
+        Unknown materials or properties give NaN rows/columns.
+        """
+        result = np.full((len(property_names), len(material_ids)), np.nan)
+        p_ok = [i for i, name in enumerate(property_names) if name in self.properties]
+        m_ok = [j for j, mid in enumerate(material_ids) if mid in self.materials]
+        if p_ok and m_ok:
+            p = self.property_codes([property_names[i] for i in p_ok])
+            m = self.material_codes([material_ids[j] for j in m_ok])
+            result[np.ix_(p_ok, m_ok)] = self.first[np.ix_(p, m)]
+        return result
+
+    def lookup(self, material_ids: List[int], property_names: List[str]) -> Dict[int, Dict[str, Dict]]:
+        """
+        First entry per material and property in the layout of
+        VisualizationDataService.get_material_properties() (single entries).
+
+        Returns:
+            {material_id: {'_material_name': str, property_name: {value, unit, ref, value_id, category}}}
+        """
+        data = {}
+        for mid in material_ids:
+            if mid not in self.materials:
+                continue
+            m = self.materials.code(mid)
+            entry = {'_material_name': self.material_names[m]}
+            for name in property_names:
+                if name not in self.properties:
+                    continue
+                p = self.properties.code(name)
+                row = self.first_row[p, m]
+                if row < 0:
+                    continue
+                entry[name] = {
+                    'value': self.text[row],
+                    'unit': self.units.names[self.unit[row]],
+                    'ref': self.refs.names[self.ref[row]] or None,
+                    'value_id': int(self.value_id[row]),
+                    'category': self.property_categories[p]
+                }
+            data[mid] = entry
+        return data
+
+    def material_name(self, material_id: int) -> Optional[str]:
+        """Material name for an ID (None if unknown)."""
+        if material_id not in self.materials:
+            return None
+        return self.material_names[self.materials.code(material_id)]
+
+    def available_properties(self, material_ids: Optional[List[int]] = None) -> List[Dict]:
+        """
+        Properties present for the given materials, in the layout of
+        VisualizationDataService.get_available_properties().
+
+        Returns:
+            List of {'parameter_name', 'category_name', 'category_number', 'material_count'}
+        """
+        present = self.first_row >= 0
+        if material_ids is not None:
+            codes = [self.materials.code(mid) for mid in material_ids if mid in self.materials]
+            present = present[:, codes]
+        counts = present.sum(axis=1)
+
+        result = [
+            {
+                'parameter_name': self.properties.names[p],
+                'category_name': self.property_categories[p],
+                'category_number': self.property_category_numbers[p],
+                'material_count': int(counts[p])
+            }
+            for p in np.flatnonzero(counts)
+        ]
+        result.sort(key=lambda r: (r['category_number'] if r['category_number'] is not None else 0,
+                                   r['parameter_name']))
+        return result
@@ -24,6 +24,7 @@ import sys
 # Add project root to path
 sys.path.insert(0, str(Path(__file__).parent.parent))
 from services.plotting_utils import PlottingUtils, apply_publication_style
+from services.level_of_detail import level_of_detail
 
 # Set up logging
 logging.basicConfig(level=logging.INFO)
@@ -446,9 +447,9 @@ def plot_property_scatter(
             color = colors[idx]
         material_colors.append(color)
     
-    # Create scatter plot
-    scatter = ax.scatter(
-        x_values, y_values,
+    # Create scatter plot (binned for display when very dense)
+    scatter = level_of_detail(fig).scatter(
+        ax, x_values, y_values,
         c=material_colors,
         s=150,
         alpha=0.7,
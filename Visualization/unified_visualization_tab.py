@@ -32,10 +32,10 @@ from PyQt6.QtWidgets import (
     QGroupBox, QSplitter, QFrame, QScrollArea, QStackedWidget,
     QLineEdit, QCheckBox, QSpinBox, QDoubleSpinBox,
     QTableWidget, QTableWidgetItem, QHeaderView,
-    QAbstractItemView, QSizePolicy
+    QAbstractItemView, QSizePolicy, QToolTip
 )
 from PyQt6.QtCore import Qt, QSize, pyqtSignal, QTimer
-from PyQt6.QtGui import QFont, QIcon, QPalette, QColor
+from PyQt6.QtGui import QFont, QIcon, QPalette, QColor, QCursor
 
 import sys
 from pathlib import Path
@@ -47,6 +47,8 @@ sys.path.insert(0, str(Path(__file__).parent.parent.parent))
 # Import backend services
 from services.visualization_service import VisualizationDataService
 from services.plotting_utils import PlottingUtils
+from services.point_inspector import PointInspector
+from gui.views.incremental_filter import IncrementalFilter
 
 # Import Material Comparison (reuse existing widget)
 try:
@@ -114,6 +116,8 @@ class MaterialSelectorWidget(QWidget):
         self.viz_service = viz_service
         self.all_materials = []  # List of all materials from database
         self.selected_material_ids = []  # Currently selected material IDs
+        self._filter = IncrementalFilter()  # Search over name, common name and ID
+        self._shown_rows = set()  # Rows not hidden by the search
         
         # Setup UI
         self._init_ui()
@@ -289,22 +293,21 @@ class MaterialSelectorWidget(QWidget):
             
             self.material_list.addItem(item)
         
+        self._filter.set_items(
+            f"{m['name']} {m.get('common_name') or ''} {m.get('xml_id') or ''}" for m in self.all_materials)
+        self._shown_rows = set(range(len(self.all_materials)))
+        
         # Update count
         self._update_count()
     
     def _filter_materials(self, text: str):
-        """Filter materials based on search text."""
-        text = text.lower()
+        """Filter materials based on search text (matches aliases and IDs too)."""
+        shown = set(self._filter.filter(text))
         
-        for i in range(self.material_list.count()):
-            item = self.material_list.item(i)
-            material_name = item.text().lower()
-            
-            # Show/hide based on search
-            if text in material_name:
-                item.setHidden(False)
-            else:
-                item.setHidden(True)
+        # Only touch items whose visibility changed
+        for i in shown ^ self._shown_rows:
+            self.material_list.item(i).setHidden(i not in shown)
+        self._shown_rows = shown
     
     def _on_item_changed(self, item):
         """Handle item checkbox state change."""
@@ -413,6 +416,9 @@ class PropertySelectorWidget(QWidget):
         self.all_properties = []  # List of available properties
         self.selected_properties = []  # Currently selected property names
         self.properties_by_category = {}  # Grouped properties
+        self._filter = IncrementalFilter()  # Search over list item texts
+        self._header_rows = set()  # Category header rows (always shown)
+        self._shown_rows = set()  # Rows not hidden by the search
         
         # Setup UI
         self._init_ui()
@@ -583,6 +589,9 @@ class PropertySelectorWidget(QWidget):
             self.info_label.setText("Select materials first")
             self.property_list.clear()
             self.all_properties = []
+            self._filter.set_items([])
+            self._header_rows = set()
+            self._shown_rows = set()
             self._update_count()
             return
         
@@ -612,8 +621,9 @@ class PropertySelectorWidget(QWidget):
             # Connect to database
             self.viz_service.connect()
             
-            # Get available properties for these materials
-            properties = self.viz_service.get_available_properties(self.selected_material_ids)
+            # Selection changes are answered from the in-memory catalogue
+            catalogue = self.viz_service.get_catalogue(refresh=False)
+            properties = catalogue.available_properties(self.selected_material_ids)
             
             # Group by category
             self.properties_by_category = {}
@@ -673,29 +683,25 @@ class PropertySelectorWidget(QWidget):
                 
                 self.property_list.addItem(item)
         
+        texts = [self.property_list.item(i).text() for i in range(self.property_list.count())]
+        self._filter.set_items(texts)
+        # Category headers start with 📁
+        self._header_rows = {i for i, text in enumerate(texts) if text.startswith("📁")}
+        self._shown_rows = set(range(len(texts)))
+        self._filter_properties(self.search_box.text())
+        
         # Update count
         self._update_count()
     
     def _filter_properties(self, text: str):
         """Filter properties based on search text."""
-        text = text.lower()
+        # Always show category headers
+        shown = set(self._filter.filter(text)) | self._header_rows
         
-        for i in range(self.property_list.count()):
-            item = self.property_list.item(i)
-            item_text = item.text().lower()
-            
-            # Check if it's a category header (starts with 📁)
-            is_header = item_text.startswith("📁")
-            
-            if is_header:
-                # Always show category headers
-                item.setHidden(False)
-            else:
-                # Show/hide based on search
-                if text in item_text:
-                    item.setHidden(False)
-                else:
-                    item.setHidden(True)
+        # Only touch items whose visibility changed
+        for i in shown ^ self._shown_rows:
+            self.property_list.item(i).setHidden(i not in shown)
+        self._shown_rows = shown
     
     def _on_item_changed(self, item):
         """Handle item checkbox state change."""
@@ -2043,6 +2049,12 @@ class ModelPlotWidget(QWidget):
         self.canvas = FigureCanvas(self.figure)
         self.canvas.setStyleSheet("background-color: white;")
         
+        # Hover tooltips for experimental points
+        self.inspector = PointInspector(
+            self.canvas,
+            show=lambda text, event: QToolTip.showText(QCursor.pos(), text, self.canvas),
+            hide=QToolTip.hideText)
+        
         # Add navigation toolbar
         self.toolbar = NavigationToolbar(self.canvas, self)
         
@@ -2122,6 +2134,7 @@ class ModelPlotWidget(QWidget):
             
             # Clear and create plot
             self.figure.clear()
+            self.inspector.clear()
             ax = self.figure.add_subplot(111)
             
             # Plot based on model type
@@ -2179,6 +2192,22 @@ class ModelPlotWidget(QWidget):
         info_text = f"<b>{model_name}</b> ({model_type}) | {params_str}<br>{exp_status}"
         self.info_panel.setText(info_text)
     
+    def _inspect_points(self, ax, x, y, x_name: str, y_name: str, exp_data: dict, material_name: str):
+        """Register experimental points for hover tooltips."""
+        import numpy as np
+        
+        x = np.asarray(x, dtype=float)
+        y = np.asarray(y, dtype=float)
+        if len(x) != len(y):
+            return
+        reference = exp_data.get('reference') or exp_data.get('source', '')
+        
+        def describe(i):
+            text = f"{x_name} = {x[i]:.4g}, {y_name} = {y[i]:.4g}"
+            return f"Reference: {reference}\n{text}" if reference else text
+        
+        self.inspector.add_points(ax, x, y, describe, name=material_name)
+    
     def _plot_usup_model(self, ax, model_data: dict, exp_data: dict):
         """
         Plot US-Up model.
@@ -2211,6 +2240,7 @@ class ModelPlotWidget(QWidget):
             if Up_exp and Us_exp:
                 ax.scatter(Up_exp, Us_exp, c='red', s=50, alpha=0.6, 
                           label='Experimental Data', zorder=5)
+                self._inspect_points(ax, Up_exp, Us_exp, 'Up', 'Us', exp_data, material_name)
                 print(f"  ✓ Plotted {len(Up_exp)} experimental points")
         
         # Labels and styling
@@ -2256,6 +2286,7 @@ class ModelPlotWidget(QWidget):
             if V_V0_exp and P_exp:
                 ax.scatter(V_V0_exp, P_exp, c='red', s=50, alpha=0.6, 
                           label='Experimental Data', zorder=5)
+                self._inspect_points(ax, V_V0_exp, P_exp, 'V/V₀', 'P', exp_data, material_name)
                 print(f"  ✓ Plotted {len(V_V0_exp)} experimental points")
         
         # Labels and styling
@@ -2301,6 +2332,7 @@ class ModelPlotWidget(QWidget):
             if strain_exp and stress_exp:
                 ax.scatter(strain_exp, stress_exp, c='red', s=50, alpha=0.6, 
                           label='Experimental Data', zorder=5)
+                self._inspect_points(ax, strain_exp, stress_exp, 'Strain', 'Stress', exp_data, material_name)
                 print(f"  ✓ Plotted {len(strain_exp)} experimental points")
         
         # Labels and styling
@@ -3927,7 +3959,7 @@ class UnifiedVisualizationTab(QWidget):
     
     def _update_comparison_display(self, view_type: str, options: dict):
         """
-        Update comparison display using batch API queries.
+        Update comparison display from the columnar property catalogue.
         """
         if not self.selected_materials or not self.selected_properties:
             if hasattr(self, 'comparison_display'):
@@ -3938,17 +3970,10 @@ class UnifiedVisualizationTab(QWidget):
             if not hasattr(self, 'comparison_display'):
                 return
 
-            self.viz_service.connect()
-
-            # Batch fetch material names
-            materials_info = self.viz_service.get_materials_by_ids(self.selected_materials)
-            id_to_name = {m['material_id']: m['name'] for m in materials_info}
-
-            # Batch fetch properties
-            raw = self.viz_service.get_material_properties(
-                self.selected_materials, self.selected_properties
-            )
-            self.viz_service.disconnect()
+            # Selection changes are answered from the in-memory catalogue
+            catalogue = self.viz_service.get_catalogue(refresh=False)
+            raw = catalogue.lookup(self.selected_materials, self.selected_properties)
+            id_to_name = {mat_id: raw[mat_id]['_material_name'] for mat_id in raw}
 
             # Reorganise into {material_name: {prop_name: {value, unit}}}
             data = {}
@@ -4188,6 +4213,9 @@ class UnifiedVisualizationTab(QWidget):
         Refresh the property comparison plot (Task 4.6).
         """
         print("🔄 Refresh comparison plot")
+        if self.viz_service:
+            # Explicit reload: pick up materials changed in the database
+            self.viz_service.get_catalogue(refresh=True)
 
 
 # =============================================================================
@@ -27,6 +27,37 @@ from pathlib import Path
 # Add project root to path
 sys.path.insert(0, str(Path(__file__).parent.parent))
 from config import DB_CONFIG
+from db.dataset_statistics_storage import DatasetStatisticsStorage, STAT_COLUMNS
+from db.search_index_storage import SearchIndexStorage
+from db.table_version_storage import TableVersionStorage
+from db.database import stream_query
+
+try:
+    from services.property_catalogue import PropertyCatalogue
+    from services.experimental_points import ExperimentalPoints
+except ImportError:
+    from Visualization.property_catalogue import PropertyCatalogue
+    from Visualization.experimental_points import ExperimentalPoints
+
+
+# Material listing columns (get_all_materials, iter_materials, get_materials_page)
+MATERIAL_COLUMNS = """
+            material_id,
+            xml_id,
+            name,
+            common_name,
+            author,
+            date,
+            version,
+            last_modified,
+            status,
+            material_class,
+            xml_file_path"""
+
+# Index behind the (name, material_id) order of iter_materials and keyset pages
+MATERIAL_ORDER_INDEX = 'idx_xml_finalized_materials_name'
+MATERIAL_ORDER_INDEX_SQL = (f"CREATE INDEX IF NOT EXISTS {MATERIAL_ORDER_INDEX} "
+                            f"ON xml_finalized_materials(name, material_id)")
 
 
 class DatabaseError(Exception):
@@ -84,6 +115,11 @@ class VisualizationDataService:
         self.db_config = db_config or DB_CONFIG
         self._connection = None
         self._cursor = None
+        self._catalogue = None
+        self._statistics_ready = None  # Unknown until first use
+        self._order_index_ready = None
+        self._table_versions_ready = None
+        self._search = None
         
         print("✓ VisualizationDataService initialized")
     
@@ -136,6 +172,108 @@ class VisualizationDataService:
             self._cursor = conn.cursor()
         return self._cursor
     
+    def _ensure_statistics(self) -> bool:
+        """
+        Install the trigger-maintained dataset statistics on first use.
+        
+        Dataset listings and statistics read experimental_dataset_statistics
+        instead of aggregating experimental_points on every call. When it
+        cannot be installed (e.g. a role without DDL rights), they aggregate
+        the raw points as before.
+        
+        Returns:
+            True if the statistics table is available
+        """
+        if self._statistics_ready is None:
+            self._statistics_ready = DatasetStatisticsStorage(self.connect()).available
+        return self._statistics_ready
+    
+    def _point_counts_join(self) -> str:
+        """Join giving s.point_count per dataset d."""
+        if self._ensure_statistics():
+            return "LEFT JOIN experimental_dataset_statistics s ON d.dataset_id = s.dataset_id"
+        return """LEFT JOIN LATERAL (
+                SELECT COUNT(*) AS point_count
+                FROM experimental_points p
+                WHERE p.dataset_id = d.dataset_id
+            ) s ON TRUE"""
+    
+    def _statistics_source(self) -> str:
+        """Relation with one statistics row per dataset (the summary view when installed)."""
+        if self._ensure_statistics():
+            return "experimental_dataset_statistics_summary"
+        aggregates = ",\n                ".join(
+            f"MIN(p.{col}) AS {col}_min, MAX(p.{col}) AS {col}_max, AVG(p.{col}) AS {col}_mean"
+            for col in STAT_COLUMNS)
+        return f"""(
+            SELECT
+                d.dataset_id,
+                d.material_name,
+                d.experiment_type,
+                COUNT(p.point_id) AS point_count,
+                {aggregates}
+            FROM experimental_datasets d
+            LEFT JOIN experimental_points p ON p.dataset_id = d.dataset_id
+            GROUP BY d.dataset_id, d.material_name, d.experiment_type
+        ) summary"""
+    
+    def _ensure_table_versions(self) -> bool:
+        """
+        Install the change counters of the catalogue tables on first use.
+        
+        The property catalogue polls them to decide whether to refresh.
+        When they cannot be installed it falls back to index and
+        statistics lookups.
+        
+        Returns:
+            True if the counters are available
+        """
+        if self._table_versions_ready is None:
+            self._table_versions_ready = TableVersionStorage(self.connect()).available
+        return self._table_versions_ready
+    
+    def _ensure_material_order_index(self) -> bool:
+        """
+        Create the (name, material_id) index on first use.
+        
+        Material listings and keyset pages are ordered by name, material_id;
+        without the index every page sorts the whole table. Only checked
+        once per service, and a failure (e.g. no DDL rights) just leaves
+        the listings unindexed.
+        
+        Returns:
+            True if the index exists
+        """
+        if self._order_index_ready is None:
+            conn = self.connect()
+            try:
+                with conn.cursor() as cur:
+                    cur.execute("SELECT to_regclass(%s) IS NOT NULL AS present", (MATERIAL_ORDER_INDEX,))
+                    row = cur.fetchone()
+                    present = row['present'] if isinstance(row, dict) else row[0]
+                    if not present:
+                        cur.execute(MATERIAL_ORDER_INDEX_SQL)
+                conn.commit()
+                self._order_index_ready = True
+            except psycopg2.Error as e:
+                conn.rollback()
+                print(f"⚠ Material name index unavailable: {e}")
+                self._order_index_ready = False
+        return self._order_index_ready
+    
+    def _ensure_search(self) -> SearchIndexStorage:
+        """
+        Install the trigram search indexes on first use.
+        
+        Searches are ranked fuzzy matches answered from GIN trigram indexes
+        (plain ILIKE when pg_trgm is not available).
+        """
+        if self._search is None:
+            self._search = SearchIndexStorage(self.connect())
+        else:
+            self._search.conn = self.connect()  # Indexes persist across reconnects
+        return self._search
+    
     def _execute_query(self, query: str, params: Optional[Tuple] = None) -> List[Dict]:
         """
         Execute a SQL query and return results as list of dictionaries.
@@ -306,30 +444,70 @@ class VisualizationDataService:
                 ...
             ]
         """
+        results = list(self.iter_materials(order_by))
+        print(f"✓ Retrieved {len(results)} materials")
+        return results
+    
+    def iter_materials(self, order_by: str = 'name'):
+        """
+        Stream all materials through a server-side cursor.
+        
+        Memory stays bounded and the first row arrives without waiting for
+        the whole table, so large catalogues can be listed or exported.
+        
+        Args:
+            order_by: Field to order results by ('name', 'material_id', 'material_class', 'xml_id')
+        
+        Yields:
+            Material dictionaries (same fields as get_all_materials)
+        """
         valid_order_fields = ['name', 'material_id', 'material_class', 'xml_id']
         if order_by not in valid_order_fields:
             order_by = 'name'
         
         query = f"""
-        SELECT 
-            material_id,
-            xml_id,
-            name,
-            common_name,
-            author,
-            date,
-            version,
-            last_modified,
-            status,
-            material_class,
-            xml_file_path
+        SELECT {MATERIAL_COLUMNS}
         FROM xml_finalized_materials
-        ORDER BY {order_by};
+        ORDER BY {order_by}, material_id;
         """
         
-        results = self._execute_query(query)
-        print(f"✓ Retrieved {len(results)} materials")
-        return results
+        self._ensure_material_order_index()
+        yield from stream_query(self.connect(), query)
+    
+    @handle_db_errors
+    def get_materials_page(self, limit: int = 100, after: Optional[Dict] = None) -> List[Dict]:
+        """
+        Get one page of materials in name order (keyset pagination).
+        
+        Args:
+            limit: Page size
+            after: Last material of the previous page (first page if None)
+        
+        Returns:
+            Up to `limit` material dictionaries
+        
+        Example:
+            >>> page = service.get_materials_page(50)
+            >>> next_page = service.get_materials_page(50, after=page[-1])
+        """
+        self._ensure_material_order_index()
+        if after is None:
+            query = f"""
+            SELECT {MATERIAL_COLUMNS}
+            FROM xml_finalized_materials
+            ORDER BY name, material_id
+            LIMIT %s;
+            """
+            return self._execute_query(query, (limit,))
+        
+        query = f"""
+        SELECT {MATERIAL_COLUMNS}
+        FROM xml_finalized_materials
+        WHERE (name, material_id) > (%s, %s)
+        ORDER BY name, material_id
+        LIMIT %s;
+        """
+        return self._execute_query(query, (after['name'], after['material_id'], limit))
     
     @handle_db_errors
     def get_material_by_id(self, material_id: int) -> Optional[Dict]:
@@ -438,44 +616,51 @@ class VisualizationDataService:
         return result
     
     @handle_db_errors
-    def search_materials(self, search_term: str) -> List[Dict]:
+    def search_materials(self, search_term: str, limit: Optional[int] = None, offset: int = 0) -> List[Dict]:
         """
         Search for materials by name (fuzzy search).
-        Case-insensitive partial match on name or common_name.
+        Typo-tolerant, ranked match on name, common_name or xml_id.
         
         Args:
-            search_term: Search string (partial match allowed)
+            search_term: Search string (partial or misspelled match allowed)
+            limit: Page size (None returns every match)
+            offset: Number of matches to skip (for paging)
         
         Returns:
-            List of matching materials
+            List of matching materials, best match first, each with a 'score'
         
         Example:
             >>> service.search_materials('copper')
-            [{'material_id': 3, 'name': 'Copper', ...}]
+            [{'material_id': 3, 'name': 'Copper', 'score': 1.0, ...}]
             
-            >>> service.search_materials('mag')
-            [{'material_id': 7, 'name': 'MAGNESIUM', ...}]
+            >>> service.search_materials('magnesuim', limit=20)
+            [{'material_id': 7, 'name': 'MAGNESIUM', 'score': 0.5, ...}]
         """
-        query = """
-        SELECT 
-            material_id,
-            xml_id,
-            name,
-            common_name,
-            material_class,
-            status
-        FROM xml_finalized_materials
-        WHERE 
-            name ILIKE %s 
-            OR common_name ILIKE %s
-            OR xml_id ILIKE %s
-        ORDER BY name;
+        results = self._ensure_search().search_materials(search_term, limit=limit, offset=offset)
+        
+        print(f"✓ Found {len(results)} materials matching '{search_term}'")
+        return results
+    
+    @handle_db_errors
+    def search_properties(self, search_term: str, material_ids: Optional[List[int]] = None,
+                          limit: Optional[int] = None, offset: int = 0) -> List[Dict]:
         """
+        Search property names (fuzzy, ranked like search_materials).
         
-        search_pattern = f'%{search_term}%'
-        results = self._execute_query(query, (search_pattern, search_pattern, search_pattern))
+        Args:
+            search_term: Search string
+            material_ids: Optional list of material IDs to filter by
+            limit: Page size (None returns every match)
+            offset: Number of matches to skip (for paging)
         
-        print(f"✓ Found {len(results)} materials matching '{search_term}'")
+        Returns:
+            List of dictionaries with parameter_name, category_name,
+            category_number, material_count and score
+        """
+        results = self._ensure_search().search_properties(
+            search_term, material_ids=material_ids, limit=limit, offset=offset)
+        
+        print(f"✓ Found {len(results)} properties matching '{search_term}'")
         return results
     
     @handle_db_errors
@@ -642,6 +827,28 @@ class VisualizationDataService:
         print(f"✓ Found {len(results)} available properties")
         return results
     
+    @handle_db_errors
+    def get_catalogue(self, refresh: bool = True) -> PropertyCatalogue:
+        """
+        Get the columnar property catalogue, loading it on first use.
+        
+        The catalogue holds every material property in memory, so property
+        comparisons index arrays instead of re-querying on each selection.
+        
+        Args:
+            refresh: Reload materials whose rows changed since the last call
+                     (one change-signal query when nothing changed); selection
+                     handlers pass False and explicit reloads True
+        
+        Returns:
+            PropertyCatalogue instance shared by all callers of this service
+        """
+        if self._catalogue is None:
+            self._catalogue = PropertyCatalogue().load(self)
+        elif refresh:
+            self._catalogue.refresh(self)
+        return self._catalogue
+    
     @handle_db_errors
     def get_properties_by_category(self, category_name: str, material_ids: Optional[List[int]] = None) -> List[str]:
         """
@@ -1180,7 +1387,72 @@ class VisualizationDataService:
             print(f"✓ No US-Up parameters found for material {material_id}")
             return {}
         
-        # Build parameter dictionary
+        usup_data = self._usup_from_rows(material_id, results)
+        
+        print(f"✓ Retrieved US-Up parameters from '{usup_data['model_name']}' model")
+        return usup_data
+    
+    @handle_db_errors
+    def get_usup_parameters_batch(self, material_ids: Optional[List[int]] = None) -> Dict[int, Dict[str, any]]:
+        """
+        Get US-Up parameters for many materials with a single query.
+        Same per-material layout as get_usup_parameters().
+        
+        Args:
+            material_ids: Material IDs to fetch (all materials if None)
+        
+        Returns:
+            Dictionary {material_id: US-Up parameters}; materials without
+            US-Up parameters are omitted
+        
+        Example:
+            >>> params = service.get_usup_parameters_batch([1, 3])
+            >>> c0 = float(params[3]['C0']['value'])
+        """
+        if material_ids is not None and not material_ids:
+            return {}
+        
+        material_filter = ""
+        if material_ids is not None:
+            material_filter = f"material_id IN ({','.join(['%s'] * len(material_ids))}) AND"
+        
+        query = f"""
+        SELECT 
+            material_id,
+            model_name,
+            parameter_name,
+            parameter_symbol,
+            parameter_value,
+            parameter_unit,
+            value_ref,
+            value_usup_ref
+        FROM xml_finalized_models
+        WHERE {material_filter}
+          (model_name = 'USUP' OR model_name = 'Mie-Gruneisen' OR model_name LIKE '%%US-Up%%')
+          AND (parameter_name IN ('C0', 's', 'Gamma', 'Reference Density', 'Cs', 'Rho'))
+        ORDER BY 
+            material_id,
+            CASE 
+                WHEN model_name LIKE '%%US-Up%%' THEN 1
+                WHEN model_name = 'USUP' THEN 2 
+                WHEN model_name = 'Mie-Gruneisen' THEN 3
+            END,
+            parameter_name;
+        """
+        
+        results = self._execute_query(query, tuple(material_ids or ()))
+        
+        by_material = {}
+        for row in results:
+            by_material.setdefault(row['material_id'], []).append(row)
+        
+        usup = {mat_id: self._usup_from_rows(mat_id, rows) for mat_id, rows in by_material.items()}
+        print(f"✓ Retrieved US-Up parameters for {len(usup)} materials")
+        return usup
+    
+    @staticmethod
+    def _usup_from_rows(material_id: int, results: List[Dict]) -> Dict[str, any]:
+        """Build the get_usup_parameters() dictionary from one material's ordered rows."""
         usup_data = {
             'model_name': results[0]['model_name'],
             'material_id': material_id
@@ -1222,7 +1494,6 @@ class VisualizationDataService:
                     'symbol': row['parameter_symbol']
                 }
         
-        print(f"✓ Retrieved US-Up parameters from '{usup_data['model_name']}' model")
         return usup_data
     
     @handle_db_errors
@@ -1396,9 +1667,11 @@ class VisualizationDataService:
                 ...
             ]
         """
+        counts = self._point_counts_join()
+        
         if material_name:
             # Fuzzy search on material name
-            query = """
+            query = f"""
             SELECT 
                 d.dataset_id,
                 d.material_name,
@@ -1408,18 +1681,16 @@ class VisualizationDataService:
                 d.description,
                 d.notes,
                 d.created_at,
-                COUNT(p.point_id) as point_count
+                COALESCE(s.point_count, 0) as point_count
             FROM experimental_datasets d
-            LEFT JOIN experimental_points p ON d.dataset_id = p.dataset_id
+            {counts}
             WHERE LOWER(d.material_name) LIKE LOWER(%s)
-            GROUP BY d.dataset_id, d.material_name, d.experiment_type, d.source_file, 
-                     d.yaml_filename, d.description, d.notes, d.created_at
             ORDER BY d.material_name, d.experiment_type;
             """
             search_pattern = f"%{material_name}%"
             results = self._execute_query(query, (search_pattern,))
         else:
-            query = """
+            query = f"""
             SELECT 
                 d.dataset_id,
                 d.material_name,
@@ -1429,11 +1700,9 @@ class VisualizationDataService:
                 d.description,
                 d.notes,
                 d.created_at,
-                COUNT(p.point_id) as point_count
+                COALESCE(s.point_count, 0) as point_count
             FROM experimental_datasets d
-            LEFT JOIN experimental_points p ON d.dataset_id = p.dataset_id
-            GROUP BY d.dataset_id, d.material_name, d.experiment_type, d.source_file, 
-                     d.yaml_filename, d.description, d.notes, d.created_at
+            {counts}
             ORDER BY d.material_name, d.experiment_type;
             """
             results = self._execute_query(query)
@@ -1460,8 +1729,10 @@ class VisualizationDataService:
                 ...
             ]
         """
+        counts = self._point_counts_join()
+        
         if material_name:
-            query = """
+            query = f"""
             SELECT 
                 d.dataset_id,
                 d.material_name,
@@ -1470,19 +1741,17 @@ class VisualizationDataService:
                 d.yaml_filename,
                 d.description,
                 d.notes,
-                COUNT(p.point_id) as point_count
+                COALESCE(s.point_count, 0) as point_count
             FROM experimental_datasets d
-            LEFT JOIN experimental_points p ON d.dataset_id = p.dataset_id
+            {counts}
             WHERE d.experiment_type = %s
               AND LOWER(d.material_name) LIKE LOWER(%s)
-            GROUP BY d.dataset_id, d.material_name, d.experiment_type, d.source_file, 
-                     d.yaml_filename, d.description, d.notes
             ORDER BY d.material_name;
             """
             search_pattern = f"%{material_name}%"
             results = self._execute_query(query, (experiment_type, search_pattern))
         else:
-            query = """
+            query = f"""
             SELECT 
                 d.dataset_id,
                 d.material_name,
@@ -1491,12 +1760,10 @@ class VisualizationDataService:
                 d.yaml_filename,
                 d.description,
                 d.notes,
-                COUNT(p.point_id) as point_count
+                COALESCE(s.point_count, 0) as point_count
             FROM experimental_datasets d
-            LEFT JOIN experimental_points p ON d.dataset_id = p.dataset_id
+            {counts}
             WHERE d.experiment_type = %s
-            GROUP BY d.dataset_id, d.material_name, d.experiment_type, d.source_file, 
-                     d.yaml_filename, d.description, d.notes
             ORDER BY d.material_name;
             """
             results = self._execute_query(query, (experiment_type,))
@@ -1593,12 +1860,83 @@ class VisualizationDataService:
         print(f"✓ Retrieved {len(results)} data points for dataset {dataset_id}")
         return results
     
+    @handle_db_errors
+    def get_experimental_arrays(self, material_names=None,
+                                experiment_type: Optional[str] = None) -> ExperimentalPoints:
+        """
+        Get experimental datasets and all their points in a single query.
+        
+        Points are aggregated per dataset server-side (ordered by point_order)
+        and decoded into contiguous NumPy columns with dataset offsets, so
+        plotting code works on arrays instead of one dict per point.
+        
+        Args:
+            material_names: Material name or list of names (case-insensitive,
+                            fuzzy match); None for all materials
+            experiment_type: Optional experiment type filter
+        
+        Returns:
+            ExperimentalPoints (datasets ordered by material, type, dataset_id)
+        
+        Example:
+            >>> exp = service.get_experimental_arrays('Copper', 'Shock Hugoniot')
+            >>> up, us = exp.pair('up', 'us')
+            >>> plt.scatter(up, us)
+        """
+        if isinstance(material_names, str):
+            material_names = [material_names]
+        
+        conditions = []
+        params = []
+        if material_names:
+            conditions.append("LOWER(d.material_name) LIKE ANY(%s)")
+            params.append([f"%{name.lower()}%" for name in material_names])
+        if experiment_type:
+            conditions.append("d.experiment_type = %s")
+            params.append(experiment_type)
+        where = f"WHERE {' AND '.join(conditions)}" if conditions else ""
+        
+        point_columns = ",\n            ".join(
+            f"array_agg(p.{col}::float8 ORDER BY p.point_order) "
+            f"FILTER (WHERE p.point_id IS NOT NULL) AS {col}"
+            for col in ExperimentalPoints.COLUMNS
+        )
+        query = f"""
+        SELECT 
+            d.dataset_id,
+            d.material_name,
+            d.experiment_type,
+            d.source_file,
+            d.yaml_filename,
+            d.description,
+            d.notes,
+            d.created_at,
+            COUNT(p.point_id) as point_count,
+            {point_columns},
+            array_agg(p.experiment_label ORDER BY p.point_order)
+                FILTER (WHERE p.point_id IS NOT NULL) AS experiment_label
+        FROM experimental_datasets d
+        LEFT JOIN experimental_points p ON d.dataset_id = p.dataset_id
+        {where}
+        GROUP BY d.dataset_id, d.material_name, d.experiment_type, d.source_file, 
+                 d.yaml_filename, d.description, d.notes, d.created_at
+        ORDER BY d.material_name, d.experiment_type, d.dataset_id;
+        """
+        
+        results = self._execute_query(query, tuple(params) if params else None)
+        points = ExperimentalPoints.from_aggregated_rows(results)
+        print(f"✓ Retrieved {points.n_datasets} datasets with {len(points)} points")
+        return points
+    
     @handle_db_errors
     def get_experimental_data_with_points(self, material_name: str) -> Dict[str, List[Dict]]:
         """
         Get experimental datasets with their data points for a material.
         Returns complete data ready for plotting.
         
+        Uses get_experimental_arrays() (one query for all datasets); prefer
+        that method directly when the points are plotted as arrays.
+        
         Args:
             material_name: Material name to fetch data for
         
@@ -1624,34 +1962,20 @@ class VisualizationDataService:
             >>> y_vals = [p['y_value'] for p in first_dataset['points']]
             >>> plt.plot(x_vals, y_vals)
         """
-        # Get all datasets for the material
-        datasets = self.get_experimental_datasets(material_name)
+        points = self.get_experimental_arrays(material_name)
         
-        if not datasets:
+        if not points.n_datasets:
             print(f"✓ No experimental data found for '{material_name}'")
             return {}
         
-        # Group by experiment type and fetch points
+        # Group by experiment type
         grouped = {}
+        for exp_type, indices in points.by_type().items():
+            grouped[exp_type] = [
+                {'dataset_info': points.datasets[i], 'points': points.records(i)}
+                for i in indices
+            ]
         
-        for dataset in datasets:
-            exp_type = dataset['experiment_type']
-            dataset_id = dataset['dataset_id']
-            
-            # Get points for this dataset
-            points = self.get_experimental_points(dataset_id)
-            
-            if exp_type not in grouped:
-                grouped[exp_type] = []
-            
-            grouped[exp_type].append({
-                'dataset_info': dataset,
-                'points': points
-            })
-        
-        total_datasets = len(datasets)
-        total_points = sum(d['point_count'] for d in datasets)
-        print(f"✓ Retrieved {total_datasets} datasets with {total_points} total points")
         return grouped
     
     @handle_db_errors
@@ -1659,55 +1983,94 @@ class VisualizationDataService:
         """
         Get statistical summary of a dataset's data points (US-Up data).
         
+        Read from the trigger-maintained statistics table; the raw points
+        are not scanned. Without that table the points are aggregated and
+        only the min/max/mean keys are returned.
+        
         Args:
             dataset_id: Dataset ID to analyze
         
         Returns:
-            Dictionary with statistics:
+            Dictionary with statistics (min/max/mean/variance of us, up, p
+            and rho, plus the fitted Us = C0 + s*Up line):
             {
                 'dataset_id': 15,
                 'point_count': 45,
                 'us_min': 3500.0,
                 'us_max': 8000.5,
                 'us_mean': 5500.2,
+                'us_variance': 1.2e6,
                 'up_min': 500.1,
                 'up_max': 2500.3,
-                'up_mean': 1500.4
+                'up_mean': 1500.4,
+                ...
+                'fit_c0': 3940.0,
+                'fit_s': 1.49,
+                'fit_r_squared': 0.998
             }
         
         Example:
             >>> stats = service.get_dataset_statistics(15)
             >>> print(f"Us range: {stats['us_min']} to {stats['us_max']}")
         """
-        query = """
-        SELECT 
-            dataset_id,
-            COUNT(*) as point_count,
-            MIN(us) as us_min,
-            MAX(us) as us_max,
-            AVG(us) as us_mean,
-            MIN(up) as up_min,
-            MAX(up) as up_max,
-            AVG(up) as up_mean,
-            MIN(p) as p_min,
-            MAX(p) as p_max,
-            AVG(p) as p_mean,
-            MIN(rho) as rho_min,
-            MAX(rho) as rho_max,
-            AVG(rho) as rho_mean
-        FROM experimental_points
-        WHERE dataset_id = %s
-        GROUP BY dataset_id;
+        query = f"""
+        SELECT *
+        FROM {self._statistics_source()}
+        WHERE dataset_id = %s;
         """
         
         result = self._execute_query_one(query, (dataset_id,))
         
-        if not result:
+        if not result or not result['point_count']:
             raise DataNotFoundError(f"No data points found for dataset {dataset_id}")
         
         print(f"✓ Retrieved statistics for dataset {dataset_id}: {result['point_count']} points")
         return result
     
+    @handle_db_errors
+    def get_dataset_statistics_batch(self, material_names=None,
+                                     experiment_type: Optional[str] = None) -> List[Dict]:
+        """
+        Get statistics for all datasets of one or more materials in one call.
+        
+        Args:
+            material_names: Material name or list of names (case-insensitive,
+                            fuzzy match); None for all materials
+            experiment_type: Optional experiment type filter
+        
+        Returns:
+            List of statistics dictionaries (same keys as
+            get_dataset_statistics()), ordered by material, type, dataset_id.
+            Datasets without points are included with point_count 0.
+        
+        Example:
+            >>> for stats in service.get_dataset_statistics_batch(['Copper', 'Nickel']):
+            ...     print(stats['dataset_id'], stats['fit_c0'], stats['fit_s'])
+        """
+        if isinstance(material_names, str):
+            material_names = [material_names]
+        
+        conditions = []
+        params = []
+        if material_names:
+            conditions.append("LOWER(material_name) LIKE ANY(%s)")
+            params.append([f"%{name.lower()}%" for name in material_names])
+        if experiment_type:
+            conditions.append("experiment_type = %s")
+            params.append(experiment_type)
+        where = f"WHERE {' AND '.join(conditions)}" if conditions else ""
+        
+        query = f"""
+        SELECT *
+        FROM {self._statistics_source()}
+        {where}
+        ORDER BY material_name, experiment_type, dataset_id;
+        """
+        
+        results = self._execute_query(query, tuple(params) if params else None)
+        print(f"✓ Retrieved statistics for {len(results)} datasets")
+        return results
+    
     @handle_db_errors
     def get_all_experimental_materials(self) -> List[Dict]:
         """
@@ -1724,13 +2087,15 @@ class VisualizationDataService:
                 ...
             ]
         """
-        query = """
+        counts = self._point_counts_join()
+        
+        query = f"""
         SELECT 
             d.material_name,
-            COUNT(DISTINCT d.dataset_id) as dataset_count,
-            COUNT(p.point_id) as total_points
+            COUNT(d.dataset_id) as dataset_count,
+            COALESCE(SUM(s.point_count), 0)::int as total_points
         FROM experimental_datasets d
-        LEFT JOIN experimental_points p ON d.dataset_id = p.dataset_id
+        {counts}
         GROUP BY d.material_name
         ORDER BY d.material_name;
         """
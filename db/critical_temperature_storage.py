@@ -0,0 +1,133 @@
+"""
+Critical Temperature Storage for Material Database Engine.
+Persists Frank-Kamenetskii critical temperature tables per material.
+
+Tables are derived data: they are replaced wholesale per material and
+carry a hash of the inputs they were computed from, so a regeneration
+can report which materials changed since the last run.
+"""
+import weakref
+from typing import Dict, List, Any, Optional
+
+from psycopg2.extras import execute_values
+
+
+class CriticalTemperatureStorage:
+    """
+    Manages the critical_temperature_tables table.
+    Does NOT touch core material tables.
+    """
+
+    # Connections whose table has been checked
+    _checked = weakref.WeakSet()
+
+    def __init__(self, connection):
+        """
+        Initialize critical temperature storage.
+
+        The table is checked once per connection.
+
+        Args:
+            connection: psycopg2 connection object
+        """
+        self.conn = connection
+        if connection not in CriticalTemperatureStorage._checked:
+            self._ensure_table()
+            CriticalTemperatureStorage._checked.add(connection)
+
+    def _ensure_table(self):
+        """Create storage table if it doesn't exist."""
+        with self.conn.cursor() as cur:
+            cur.execute("SELECT to_regclass('critical_temperature_tables') IS NOT NULL AS present")
+            row = cur.fetchone()
+            if not (row['present'] if isinstance(row, dict) else row[0]):
+                cur.execute("""
+                    CREATE TABLE IF NOT EXISTS critical_temperature_tables (
+                        table_id SERIAL PRIMARY KEY,
+                        material_id INTEGER NOT NULL REFERENCES materials(material_id) ON DELETE CASCADE,
+                        geometry TEXT NOT NULL CHECK (geometry IN ('slab', 'cylinder', 'sphere')),
+                        size_m DOUBLE PRECISION NOT NULL,
+                        critical_temperature_k DOUBLE PRECISION,
+                        induction_time_s DOUBLE PRECISION,
+                        kinetics_source TEXT,
+                        thermal_source TEXT,
+                        input_hash TEXT NOT NULL,
+                        computed_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP,
+                        UNIQUE(material_id, geometry, size_m)
+                    );
+
+                    CREATE INDEX IF NOT EXISTS idx_critical_temperature_material
+                    ON critical_temperature_tables(material_id);
+                """)
+            self.conn.commit()
+
+    def get_input_hash(self, material_id: int) -> Optional[str]:
+        """
+        Get the input hash of the stored table for a material.
+
+        Args:
+            material_id: Material ID
+
+        Returns:
+            Input hash, or None if no table is stored
+        """
+        with self.conn.cursor() as cur:
+            cur.execute("""
+                SELECT input_hash FROM critical_temperature_tables
+                WHERE material_id = %s
+                LIMIT 1
+            """, (material_id,))
+            row = cur.fetchone()
+        return row[0] if row else None
+
+    def replace_table(self, material_id: int, rows: List[tuple], input_hash: str):
+        """
+        Replace the stored table for a material in one transaction.
+
+        Args:
+            material_id: Material ID
+            rows: (geometry, size_m, Tc_K, induction_s, kinetics_source, thermal_source) tuples
+            input_hash: Hash of the inputs the rows were computed from
+        """
+        try:
+            with self.conn.cursor() as cur:
+                cur.execute("DELETE FROM critical_temperature_tables WHERE material_id = %s",
+                            (material_id,))
+                execute_values(cur, """
+                    INSERT INTO critical_temperature_tables
+                    (material_id, geometry, size_m, critical_temperature_k, induction_time_s,
+                     kinetics_source, thermal_source, input_hash)
+                    VALUES %s
+                """, [(material_id,) + tuple(row) + (input_hash,) for row in rows])
+            self.conn.commit()
+        except Exception:
+            self.conn.rollback()
+            raise
+
+    def get_table(self, material_id: int, geometry: Optional[str] = None) -> List[Dict[str, Any]]:
+        """
+        Get the stored table for a material.
+
+        Args:
+            material_id: Material ID
+            geometry: Restrict to one geometry (all if None)
+
+        Returns:
+            List of row dictionaries ordered by geometry and size
+        """
+        sql = """
+            SELECT geometry, size_m, critical_temperature_k, induction_time_s,
+                   kinetics_source, thermal_source, input_hash, computed_at
+            FROM critical_temperature_tables
+            WHERE material_id = %s
+        """
+        params = [material_id]
+        if geometry:
+            sql += " AND geometry = %s"
+            params.append(geometry)
+        sql += " ORDER BY geometry, size_m"
+
+        with self.conn.cursor() as cur:
+            cur.execute(sql, params)
+            columns = [desc[0] for desc in cur.description]
+            return [dict(zip(columns, row)) for row in cur.fetchall()]
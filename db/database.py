@@ -5,6 +5,8 @@ Handles PostgreSQL connections and schema initialization.
 import psycopg2
 from psycopg2.extensions import connection as Connection
 from psycopg2 import sql
+from typing import Iterator
+import itertools
 import sys
 import os
 
@@ -13,6 +15,38 @@ sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
 
 from config import DB_CONFIG
 from db.schema import get_create_schema_sql, get_drop_schema_sql
+from db.property_path_storage import PropertyPathStorage
+
+
+# Rows fetched per round trip when streaming
+STREAM_BATCH_SIZE = 2000
+
+_cursor_ids = itertools.count(1)
+
+
+def stream_query(conn: Connection, query: str, params=None,
+                 batch_size: int = STREAM_BATCH_SIZE) -> Iterator:
+    """
+    Iterate over a query's rows through a server-side (named) cursor.
+    
+    Rows are fetched batch_size at a time, so memory stays bounded and the
+    first row arrives without waiting for the whole result. The cursor is
+    declared WITH HOLD, so commits made while iterating (e.g. by code
+    processing each row) do not close it.
+    
+    Args:
+        conn: psycopg2 connection (rows use its cursor_factory)
+        query: SQL query string
+        params: Query parameters (optional)
+        batch_size: Rows per network round trip
+    
+    Yields:
+        One row per result row
+    """
+    with conn.cursor(name=f"stream_{next(_cursor_ids)}", withhold=True) as cursor:
+        cursor.itersize = batch_size
+        cursor.execute(query, params)
+        yield from cursor
 
 
 class DatabaseManager:
@@ -74,6 +108,10 @@ class DatabaseManager:
             raise
         finally:
             cursor.close()
+        
+        # Property paths need the ltree extension; the schema works without them
+        if PropertyPathStorage(conn).available:
+            print("✓ Property paths installed")
     
     def drop_schema(self):
         """
@@ -0,0 +1,305 @@
+"""
+Dataset Statistics Storage for Material Database Engine.
+Keeps per-dataset statistics of experimental points up to date.
+
+The table stores sufficient statistics (counts, sums, sums of squares,
+bounds and the Us-Up regression sums) so inserts and deletes are folded
+in by statement-level triggers without rescanning the dataset. Means,
+variances and the fitted Us = C0 + s*Up line are derived in the
+experimental_dataset_statistics_summary view. A delete that removes a
+dataset's current minimum or maximum recomputes that dataset only.
+"""
+import weakref
+from typing import List, Optional
+
+
+# Point columns summarised per dataset
+STAT_COLUMNS = ('us', 'up', 'p', 'rho')
+
+# Trigger events on experimental_points
+TRIGGER_EVENTS = ('insert', 'delete', 'update')
+
+# Regression sums for Us = C0 + s*Up over points with both values
+FIT_SUMS = {
+    'fit_n': "COUNT(p.point_id) FILTER (WHERE p.up IS NOT NULL AND p.us IS NOT NULL)",
+    'fit_sx': "COALESCE(SUM(p.up::float8) FILTER (WHERE p.us IS NOT NULL), 0)",
+    'fit_sy': "COALESCE(SUM(p.us::float8) FILTER (WHERE p.up IS NOT NULL), 0)",
+    'fit_sxx': "COALESCE(SUM(p.up::float8 * p.up::float8) FILTER (WHERE p.us IS NOT NULL), 0)",
+    'fit_syy': "COALESCE(SUM(p.us::float8 * p.us::float8) FILTER (WHERE p.up IS NOT NULL), 0)",
+    'fit_sxy': "COALESCE(SUM(p.up::float8 * p.us::float8), 0)",
+}
+
+
+def _additive_columns() -> List[str]:
+    """Stored columns that combine by addition."""
+    names = ['point_count']
+    for col in STAT_COLUMNS:
+        names += [f"{col}_n", f"{col}_sum", f"{col}_sumsq"]
+    return names + list(FIT_SUMS)
+
+
+def _bound_columns() -> List[str]:
+    return [f"{col}_{bound}" for col in STAT_COLUMNS for bound in ('min', 'max')]
+
+
+def _aggregates() -> str:
+    """Aggregate expressions over points aliased p, named like the stored columns."""
+    parts = ["COUNT(p.point_id) AS point_count"]
+    for col in STAT_COLUMNS:
+        parts += [
+            f"COUNT(p.{col}) AS {col}_n",
+            f"COALESCE(SUM(p.{col}::float8), 0) AS {col}_sum",
+            f"COALESCE(SUM(p.{col}::float8 * p.{col}::float8), 0) AS {col}_sumsq",
+        ]
+    parts += [f"{expr} AS {name}" for name, expr in FIT_SUMS.items()]
+    for col in STAT_COLUMNS:
+        parts += [f"MIN(p.{col}::float8) AS {col}_min", f"MAX(p.{col}::float8) AS {col}_max"]
+    return ",\n                       ".join(parts)
+
+
+def get_table_sql() -> str:
+    """DDL for the statistics table."""
+    columns = ["dataset_id INTEGER PRIMARY KEY REFERENCES experimental_datasets(dataset_id) ON DELETE CASCADE",
+               "point_count INTEGER NOT NULL DEFAULT 0"]
+    for col in STAT_COLUMNS:
+        columns += [f"{col}_n INTEGER NOT NULL DEFAULT 0",
+                    f"{col}_sum DOUBLE PRECISION NOT NULL DEFAULT 0",
+                    f"{col}_sumsq DOUBLE PRECISION NOT NULL DEFAULT 0"]
+    columns.append("fit_n INTEGER NOT NULL DEFAULT 0")
+    columns += [f"{name} DOUBLE PRECISION NOT NULL DEFAULT 0" for name in FIT_SUMS if name != 'fit_n']
+    columns += [f"{name} DOUBLE PRECISION" for name in _bound_columns()]
+    columns.append("updated_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP")
+    return ("CREATE TABLE IF NOT EXISTS experimental_dataset_statistics (\n    "
+            + ",\n    ".join(columns) + "\n);")
+
+
+def get_functions_sql() -> str:
+    """Refresh function and trigger functions."""
+    aggregates = _aggregates()
+    stored = ", ".join(['dataset_id'] + _additive_columns() + _bound_columns())
+    add = ",\n                ".join(
+        [f"{name} = s.{name} + EXCLUDED.{name}" for name in _additive_columns()]
+        + [f"{col}_min = LEAST(s.{col}_min, EXCLUDED.{col}_min)" for col in STAT_COLUMNS]
+        + [f"{col}_max = GREATEST(s.{col}_max, EXCLUDED.{col}_max)" for col in STAT_COLUMNS]
+        + ["updated_at = CURRENT_TIMESTAMP"])
+    subtract = ",\n                ".join(
+        [f"{name} = s.{name} - d.{name}" for name in _additive_columns()]
+        + ["updated_at = CURRENT_TIMESTAMP"])
+    on_bound = "\n                   OR ".join(
+        f"p.{col}::float8 <= s.{col}_min OR p.{col}::float8 >= s.{col}_max" for col in STAT_COLUMNS)
+
+    return f"""
+        CREATE OR REPLACE FUNCTION experimental_statistics_refresh(ids INTEGER[])
+        RETURNS VOID AS $$
+        BEGIN
+            DELETE FROM experimental_dataset_statistics
+            WHERE ids IS NULL OR dataset_id = ANY(ids);
+
+            INSERT INTO experimental_dataset_statistics ({stored})
+            SELECT d.dataset_id,
+                       {aggregates}
+            FROM experimental_datasets d
+            LEFT JOIN experimental_points p ON p.dataset_id = d.dataset_id
+            WHERE ids IS NULL OR d.dataset_id = ANY(ids)
+            GROUP BY d.dataset_id;
+        END;
+        $$ LANGUAGE plpgsql;
+
+        CREATE OR REPLACE FUNCTION experimental_statistics_on_insert()
+        RETURNS TRIGGER AS $$
+        BEGIN
+            INSERT INTO experimental_dataset_statistics AS s ({stored})
+            SELECT p.dataset_id,
+                       {aggregates}
+            FROM new_points p
+            GROUP BY p.dataset_id
+            ON CONFLICT (dataset_id) DO UPDATE SET
+                {add};
+            RETURN NULL;
+        END;
+        $$ LANGUAGE plpgsql;
+
+        CREATE OR REPLACE FUNCTION experimental_statistics_on_delete()
+        RETURNS TRIGGER AS $$
+        DECLARE
+            stale INTEGER[];
+        BEGIN
+            -- Datasets that lost a current bound cannot be updated from sums
+            stale := ARRAY(
+                SELECT DISTINCT p.dataset_id
+                FROM old_points p
+                JOIN experimental_dataset_statistics s ON s.dataset_id = p.dataset_id
+                WHERE {on_bound}
+            );
+
+            UPDATE experimental_dataset_statistics s SET
+                {subtract}
+            FROM (
+                SELECT p.dataset_id,
+                       {aggregates}
+                FROM old_points p
+                WHERE NOT (p.dataset_id = ANY(stale))
+                GROUP BY p.dataset_id
+            ) d
+            WHERE s.dataset_id = d.dataset_id;
+
+            PERFORM experimental_statistics_refresh(stale);
+            RETURN NULL;
+        END;
+        $$ LANGUAGE plpgsql;
+
+        CREATE OR REPLACE FUNCTION experimental_statistics_on_update()
+        RETURNS TRIGGER AS $$
+        BEGIN
+            PERFORM experimental_statistics_refresh(ARRAY(
+                SELECT dataset_id FROM old_points
+                UNION
+                SELECT dataset_id FROM new_points
+            ));
+            RETURN NULL;
+        END;
+        $$ LANGUAGE plpgsql;
+    """
+
+
+def get_triggers_sql() -> str:
+    """Statement-level triggers on experimental_points (transition tables)."""
+    triggers = {
+        'INSERT': "REFERENCING NEW TABLE AS new_points",
+        'DELETE': "REFERENCING OLD TABLE AS old_points",
+        'UPDATE': "REFERENCING OLD TABLE AS old_points NEW TABLE AS new_points",
+    }
+    sql = []
+    for event, referencing in triggers.items():
+        name = f"experimental_points_statistics_{event.lower()}"
+        sql.append(f"""
+        DROP TRIGGER IF EXISTS {name} ON experimental_points;
+        CREATE TRIGGER {name}
+            AFTER {event} ON experimental_points
+            {referencing}
+            FOR EACH STATEMENT
+            EXECUTE PROCEDURE experimental_statistics_on_{event.lower()}();""")
+    return "\n".join(sql)
+
+
+def get_summary_view_sql() -> str:
+    """View with means, sample variances and the Us-Up fit for every dataset."""
+    derived = []
+    for col in STAT_COLUMNS:
+        derived += [
+            f"s.{col}_min", f"s.{col}_max",
+            f"s.{col}_sum / NULLIF(s.{col}_n, 0) AS {col}_mean",
+            f"CASE WHEN s.{col}_n > 1 THEN GREATEST((s.{col}_sumsq - s.{col}_sum * s.{col}_sum / s.{col}_n)"
+            f" / (s.{col}_n - 1), 0) END AS {col}_variance",
+        ]
+    derived = ",\n            ".join(derived)
+    return f"""
+        CREATE OR REPLACE VIEW experimental_dataset_statistics_summary AS
+        SELECT
+            d.dataset_id,
+            d.material_name,
+            d.experiment_type,
+            COALESCE(s.point_count, 0) AS point_count,
+            {derived},
+            COALESCE(s.fit_n, 0) AS fit_point_count,
+            (s.fit_sy - f.slope * s.fit_sx) / s.fit_n AS fit_c0,
+            f.slope AS fit_s,
+            (s.fit_n * s.fit_sxy - s.fit_sx * s.fit_sy) ^ 2
+                / NULLIF((s.fit_n * s.fit_sxx - s.fit_sx ^ 2) * (s.fit_n * s.fit_syy - s.fit_sy ^ 2), 0)
+                AS fit_r_squared,
+            s.updated_at
+        FROM experimental_datasets d
+        LEFT JOIN experimental_dataset_statistics s ON s.dataset_id = d.dataset_id
+        LEFT JOIN LATERAL (
+            SELECT CASE WHEN s.fit_n > 1
+                        THEN (s.fit_n * s.fit_sxy - s.fit_sx * s.fit_sy)
+                             / NULLIF(s.fit_n * s.fit_sxx - s.fit_sx ^ 2, 0)
+                   END AS slope
+        ) f ON TRUE;
+    """
+
+
+class DatasetStatisticsStorage:
+    """
+    Manages the experimental_dataset_statistics table and its triggers.
+    Does NOT touch experimental_datasets or experimental_points rows.
+    """
+
+    # Connections on which everything is known to be installed
+    _installed = weakref.WeakSet()
+
+    def __init__(self, connection):
+        """
+        Initialize dataset statistics storage.
+
+        Installs the table, functions, triggers and summary view only when
+        something is missing (checked once per connection), and backfills the
+        table when it is created or its triggers were missing.
+
+        Args:
+            connection: psycopg2 connection object
+        """
+        self.conn = connection
+        self.available = self._ensure_table()
+
+    def _ensure_table(self) -> bool:
+        """Install what is missing; False if the experimental tables are missing or install fails."""
+        if self.conn in DatasetStatisticsStorage._installed:
+            return True
+        triggers = [f"experimental_points_statistics_{event}" for event in TRIGGER_EVENTS]
+        with self.conn.cursor() as cur:
+            try:
+                cur.execute("""
+                    SELECT to_regclass('experimental_points') IS NOT NULL AS has_points,
+                           to_regclass('experimental_dataset_statistics') IS NOT NULL AS has_statistics,
+                           (SELECT COUNT(*) FROM pg_trigger
+                            WHERE tgname = ANY(%s)
+                              AND tgrelid = to_regclass('experimental_points')) = %s AS has_triggers,
+                           to_regclass('experimental_dataset_statistics_summary') IS NOT NULL AS has_view
+                """, (triggers, len(triggers)))
+                has_points, has_statistics, has_triggers, has_view = self._row_values(cur.fetchone())
+                if not has_points:
+                    self.conn.commit()
+                    print("⚠ experimental_points table not found, dataset statistics disabled")
+                    return False
+
+                # Without its triggers the table may have missed changes
+                backfill = not (has_statistics and has_triggers)
+                if backfill or not has_view:
+                    cur.execute(get_table_sql())
+                    cur.execute(get_functions_sql())
+                    cur.execute(get_triggers_sql())
+                    cur.execute(get_summary_view_sql())
+                    if backfill:
+                        cur.execute("SELECT experimental_statistics_refresh(NULL)")
+                self.conn.commit()
+            except Exception as e:
+                self.conn.rollback()
+                print(f"⚠ Dataset statistics unavailable: {e}")
+                return False
+
+        if backfill:
+            print("✓ Built experimental dataset statistics")
+        DatasetStatisticsStorage._installed.add(self.conn)
+        return True
+
+    @staticmethod
+    def _row_values(row):
+        """Row values for tuple and dict cursors alike."""
+        return tuple(row.values()) if isinstance(row, dict) else tuple(row)
+
+    def rebuild(self, dataset_ids: Optional[List[int]] = None):
+        """
+        Recompute statistics from the raw points.
+
+        Args:
+            dataset_ids: Datasets to recompute (all if None)
+        """
+        with self.conn.cursor() as cur:
+            try:
+                cur.execute("SELECT experimental_statistics_refresh(%s)",
+                            (list(dataset_ids) if dataset_ids is not None else None,))
+                self.conn.commit()
+            except Exception:
+                self.conn.rollback()
+                raise
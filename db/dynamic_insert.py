@@ -19,6 +19,7 @@ import os
 sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
 
 from db.database import DatabaseManager
+from db.query import MaterialQuerier
 import logging
 
 logging.basicConfig(level=logging.INFO)
@@ -40,6 +41,7 @@ class DynamicMaterialInserter:
         """
         self.db = db_manager
         self.conn = db_manager.connect()
+        self.querier = MaterialQuerier(db_manager)  # Rebuilds cached documents
     
     def insert_material(self, material_data: Dict[str, Any]) -> int:
         """
@@ -72,6 +74,10 @@ class DynamicMaterialInserter:
                 )
                 logger.info(f"  ✓ Inserted {model_count} model types")
             
+            # 4. Cache the assembled document (same transaction as the rows)
+            self.querier.refresh_document(material_id)
+            logger.info(f"  ✓ Cached material document")
+            
             self.conn.commit()
             logger.info(
                 f"✓ Material '{material_data['metadata'].get('name')}' "
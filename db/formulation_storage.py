@@ -0,0 +1,136 @@
+"""
+Formulation Storage for Material Database Engine.
+Links formulated materials (COMP-B, PBX-9404, ...) to their constituents.
+
+Compositions are mass fractions. They may sum to less than one when a
+constituent (typically a binder) is not in the database; the remainder is
+reported as uncovered by the mixture engine.
+"""
+import weakref
+from typing import Dict, List, Any
+
+from psycopg2.extras import execute_values
+
+
+class FormulationStorage:
+    """
+    Manages the formulation_components table.
+    Does NOT touch core material tables.
+    """
+
+    # Connections whose table has been checked
+    _checked = weakref.WeakSet()
+
+    def __init__(self, connection):
+        """
+        Initialize formulation storage.
+
+        The table is checked once per connection.
+
+        Args:
+            connection: psycopg2 connection object
+        """
+        self.conn = connection
+        if connection not in FormulationStorage._checked:
+            self._ensure_table()
+            FormulationStorage._checked.add(connection)
+
+    def _ensure_table(self):
+        """Create storage table if it doesn't exist."""
+        with self.conn.cursor() as cur:
+            cur.execute("SELECT to_regclass('formulation_components') IS NOT NULL AS present")
+            row = cur.fetchone()
+            if not (row['present'] if isinstance(row, dict) else row[0]):
+                cur.execute("""
+                    CREATE TABLE IF NOT EXISTS formulation_components (
+                        component_id SERIAL PRIMARY KEY,
+                        formulation_material_id INTEGER NOT NULL REFERENCES materials(material_id) ON DELETE CASCADE,
+                        constituent_material_id INTEGER NOT NULL REFERENCES materials(material_id) ON DELETE CASCADE,
+                        mass_fraction DOUBLE PRECISION NOT NULL CHECK (mass_fraction > 0 AND mass_fraction <= 1),
+                        created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP,
+                        UNIQUE(formulation_material_id, constituent_material_id),
+                        CHECK (formulation_material_id <> constituent_material_id)
+                    );
+
+                    CREATE INDEX IF NOT EXISTS idx_formulation_components_formulation
+                    ON formulation_components(formulation_material_id);
+                """)
+            self.conn.commit()
+
+    def set_composition(self, formulation_id: int, fractions: Dict[int, float]):
+        """
+        Replace the composition of a formulation in one transaction.
+
+        Args:
+            formulation_id: Material ID of the formulation
+            fractions: {constituent material ID: mass fraction}
+
+        Raises:
+            ValueError: If a fraction is out of range or the total exceeds one
+        """
+        if any(not 0.0 < w <= 1.0 for w in fractions.values()):
+            raise ValueError("Mass fractions must be in (0, 1]")
+        if sum(fractions.values()) > 1.0 + 1.0e-9:
+            raise ValueError(f"Mass fractions sum to {sum(fractions.values()):.4f} (> 1)")
+
+        try:
+            with self.conn.cursor() as cur:
+                cur.execute("DELETE FROM formulation_components WHERE formulation_material_id = %s",
+                            (formulation_id,))
+                if fractions:
+                    execute_values(cur, """
+                        INSERT INTO formulation_components
+                        (formulation_material_id, constituent_material_id, mass_fraction)
+                        VALUES %s
+                    """, [(formulation_id, cid, w) for cid, w in fractions.items()])
+            self.conn.commit()
+        except Exception:
+            self.conn.rollback()
+            raise
+
+    def get_compositions(self, formulation_names: List[str] = None) -> Dict[str, Dict[str, float]]:
+        """
+        Get stored compositions by material name.
+
+        Args:
+            formulation_names: Formulations to load (all stored formulations if None)
+
+        Returns:
+            {formulation name: {constituent name: mass fraction}}
+        """
+        sql = """
+            SELECT f.name, c.name, fc.mass_fraction
+            FROM formulation_components fc
+            JOIN materials f ON f.material_id = fc.formulation_material_id
+            JOIN materials c ON c.material_id = fc.constituent_material_id
+        """
+        params = []
+        if formulation_names is not None:
+            sql += " WHERE f.name = ANY(%s)"
+            params.append(list(formulation_names))
+        sql += " ORDER BY f.name, fc.mass_fraction DESC"
+
+        compositions = {}
+        with self.conn.cursor() as cur:
+            cur.execute(sql, params)
+            for formulation, constituent, fraction in cur.fetchall():
+                compositions.setdefault(formulation, {})[constituent] = fraction
+        return compositions
+
+    def list_formulations(self) -> List[Dict[str, Any]]:
+        """
+        List formulations with their constituent count and covered mass fraction.
+
+        Returns:
+            List of {'name', 'n_constituents', 'coverage'} dictionaries
+        """
+        with self.conn.cursor() as cur:
+            cur.execute("""
+                SELECT f.name, COUNT(*), SUM(fc.mass_fraction)
+                FROM formulation_components fc
+                JOIN materials f ON f.material_id = fc.formulation_material_id
+                GROUP BY f.name
+                ORDER BY f.name
+            """)
+            return [{'name': name, 'n_constituents': n, 'coverage': coverage}
+                    for name, n, coverage in cur.fetchall()]
@@ -15,6 +15,7 @@ import os
 sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
 
 from db.database import DatabaseManager
+from db.query import MaterialQuerier
 
 
 class MaterialInserter:
@@ -29,6 +30,7 @@ class MaterialInserter:
         """
         self.db = db_manager
         self.conn = db_manager.connect()
+        self.querier = MaterialQuerier(db_manager)  # Rebuilds cached documents
     
     def insert_material(self, material_data: Dict[str, Any]) -> int:
         """
@@ -57,6 +59,10 @@ class MaterialInserter:
                 self._insert_models(cursor, material_id, material_data['models'])
                 print(f"  ✓ Inserted models")
             
+            # 4. Cache the assembled document (same transaction as the rows)
+            self.querier.refresh_document(material_id)
+            print(f"  ✓ Cached material document")
+            
             self.conn.commit()
             print(f"✓ Material '{material_data['metadata'].get('name')}' inserted successfully")
             
@@ -0,0 +1,226 @@
+"""
+Material Document Storage for Material Database Engine.
+Per-material cache of the fully assembled material dictionary.
+
+MaterialQuerier builds a material from six normalized tables. This module
+keeps the result (before overrides) in material_documents, one row per
+material, so a material loads with a single indexed fetch.
+
+Freshness:
+- Statement triggers on the normalized tables bump the material's version
+  in the same transaction as the change, whoever makes it.
+- A document records the version it was built from (built_version) and the
+  md5 of its text (content_hash).
+- A document is used only when built_version = version and the hash
+  matches; otherwise the caller rebuilds it from the normalized tables.
+
+The document column is JSON rather than JSONB: JSONB reorders object keys,
+and the viewer and XML exporters rely on the stored order.
+"""
+import json
+from typing import Any, Dict, List, Optional, Tuple
+
+
+# Tables whose changes invalidate documents: (material expression, join from alias e)
+SOURCE_TABLES = {
+    'materials': ('e.material_id', ''),
+    'property_categories': ('e.material_id', ''),
+    'properties': (
+        'pc.material_id',
+        "JOIN property_categories pc ON pc.category_id = e.category_id",
+    ),
+    'property_entries': (
+        'pc.material_id',
+        "JOIN properties p ON p.property_id = e.property_id "
+        "JOIN property_categories pc ON pc.category_id = p.category_id",
+    ),
+    'models': ('e.material_id', ''),
+    'sub_models': (
+        'mo.material_id',
+        "JOIN models mo ON mo.model_id = e.model_id",
+    ),
+    'model_parameters': (
+        'mo.material_id',
+        "JOIN sub_models sm ON sm.sub_model_id = e.sub_model_id "
+        "JOIN models mo ON mo.model_id = sm.model_id",
+    ),
+}
+
+# Trigger suffix -> (event, transition table clause)
+_EVENTS = {
+    'insert': ('INSERT', 'NEW TABLE AS changed_rows'),
+    'update_old': ('UPDATE', 'OLD TABLE AS changed_rows'),  # Rows moved away from a material
+    'update_new': ('UPDATE', 'NEW TABLE AS changed_rows'),
+    'delete': ('DELETE', 'OLD TABLE AS changed_rows'),
+}
+
+
+def get_table_sql() -> str:
+    return """
+        CREATE TABLE IF NOT EXISTS material_documents (
+            material_id INTEGER PRIMARY KEY REFERENCES materials(material_id) ON DELETE CASCADE,
+            document JSON,
+            content_hash CHAR(32),
+            version BIGINT NOT NULL DEFAULT 1,
+            built_version BIGINT NOT NULL DEFAULT 0,
+            updated_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP
+        );
+    """
+
+
+def get_functions_sql() -> str:
+    """Version bump function and one trigger function per source table."""
+    functions = ["""
+        CREATE OR REPLACE FUNCTION material_documents_touch(ids INTEGER[])
+        RETURNS VOID AS $$
+            -- Materials being deleted are skipped (their documents cascade)
+            INSERT INTO material_documents (material_id)
+            SELECT material_id FROM materials WHERE material_id = ANY(ids)
+            ON CONFLICT (material_id) DO UPDATE
+                SET version = material_documents.version + 1;
+        $$ LANGUAGE sql;"""]
+    for table, (material, join) in SOURCE_TABLES.items():
+        functions.append(f"""
+        CREATE OR REPLACE FUNCTION {table}_touch_documents()
+        RETURNS TRIGGER AS $$
+        BEGIN
+            PERFORM material_documents_touch(ARRAY(
+                SELECT DISTINCT {material} FROM changed_rows e {join}
+            ));
+            RETURN NULL;
+        END;
+        $$ LANGUAGE plpgsql;""")
+    return "\n".join(functions)
+
+
+def get_triggers_sql() -> str:
+    """Statement-level triggers (transition tables allow one event each)."""
+    sql = []
+    for table in SOURCE_TABLES:
+        for suffix, (event, transition) in _EVENTS.items():
+            sql.append(f"""
+        DROP TRIGGER IF EXISTS {table}_documents_{suffix} ON {table};
+        CREATE TRIGGER {table}_documents_{suffix}
+            AFTER {event} ON {table}
+            REFERENCING {transition}
+            FOR EACH STATEMENT
+            EXECUTE PROCEDURE {table}_touch_documents();""")
+    return "\n".join(sql)
+
+
+def get_create_sql() -> str:
+    """Table, functions and triggers."""
+    return "\n".join([get_table_sql(), get_functions_sql(), get_triggers_sql()])
+
+
+class MaterialDocumentStorage:
+    """
+    Reads and writes cached material documents.
+    Does NOT modify core material tables.
+    """
+
+    # Document, version and whether the document is current
+    _COLUMNS = ("document, version, "
+                "built_version = version AND md5(document::text) = content_hash AS fresh")
+
+    def __init__(self, connection):
+        """
+        Initialize material document storage.
+
+        Installs the table and triggers on databases created before them.
+
+        Args:
+            connection: psycopg2 connection object
+        """
+        self.conn = connection
+        self.available = self._ensure_documents()
+
+    def _ensure_documents(self) -> bool:
+        """Create table and triggers if missing; False if that fails."""
+        with self.conn.cursor() as cur:
+            try:
+                cur.execute("SELECT to_regclass('material_documents') IS NOT NULL AS present")
+                row = cur.fetchone()
+                if not (row['present'] if isinstance(row, dict) else row[0]):
+                    cur.execute(get_create_sql())
+                self.conn.commit()
+            except Exception as e:
+                self.conn.rollback()
+                print(f"⚠ Material document cache unavailable: {e}")
+                return False
+        return True
+
+    def load(self, material_id: int) -> Tuple[Optional[Dict[str, Any]], int]:
+        """
+        Cached document of a material.
+
+        Args:
+            material_id: Material ID
+
+        Returns:
+            (document, version): document is None when missing, out of date
+            or failing its hash check; pass version to store() after rebuilding
+        """
+        with self.conn.cursor() as cur:
+            cur.execute(f"""
+                SELECT {self._COLUMNS}
+                FROM material_documents
+                WHERE material_id = %s
+            """, (material_id,))
+            row = cur.fetchone()
+
+        if row is None:
+            return None, 0
+        document, version, fresh = (row['document'], row['version'], row['fresh']) \
+            if isinstance(row, dict) else row
+        return (document if fresh else None), version
+
+    def load_many(self, material_ids: List[int]) -> Dict[int, Tuple[Optional[Dict[str, Any]], int]]:
+        """
+        Cached documents of many materials in one query.
+
+        Args:
+            material_ids: Material IDs
+
+        Returns:
+            {material_id: (document, version)} as for load(); materials
+            without a row are absent
+        """
+        with self.conn.cursor() as cur:
+            cur.execute(f"""
+                SELECT material_id, {self._COLUMNS}
+                FROM material_documents
+                WHERE material_id = ANY(%s)
+            """, (list(material_ids),))
+            rows = cur.fetchall()
+
+        result = {}
+        for row in rows:
+            if isinstance(row, dict):
+                row = (row['material_id'], row['document'], row['version'], row['fresh'])
+            material_id, document, version, fresh = row
+            result[material_id] = (document if fresh else None), version
+        return result
+
+    def store(self, material_id: int, document: Dict[str, Any], version: int):
+        """
+        Save a rebuilt document (caller commits).
+
+        Args:
+            material_id: Material ID
+            document: Assembled material dictionary (without overrides)
+            version: Version returned by load() before the document was built;
+                     if the material changed since, the document stays stale
+        """
+        text = json.dumps(document)
+        with self.conn.cursor() as cur:
+            cur.execute("""
+                INSERT INTO material_documents
+                    (material_id, document, content_hash, version, built_version)
+                VALUES (%(id)s, %(doc)s::json, md5(%(doc)s), %(version)s, %(version)s)
+                ON CONFLICT (material_id) DO UPDATE
+                    SET document = EXCLUDED.document,
+                        content_hash = EXCLUDED.content_hash,
+                        built_version = EXCLUDED.built_version,
+                        updated_at = CURRENT_TIMESTAMP
+            """, {'id': material_id, 'doc': text, 'version': version})
@@ -0,0 +1,266 @@
+"""
+Override Resolution Storage for Material Database Engine.
+Resolves material_overrides against stored values in SQL.
+
+Overrides are matched to property entries and model parameters through
+their stored paths (see db.property_path_storage) and resolved with the
+same rules as OverrideManager:
+
+- reference_preference: keep only the first entry citing the preferred
+  reference (all entries are kept when none cites it)
+- value_override: replace all entries with one USER_OVERRIDE entry; the
+  unit falls back to the stored unit
+
+effective_material_values(ids) returns every value of the given materials
+after resolution. material_override_values(ids) returns only the values
+that overrides changed; it starts from the override rows, so materials
+without overrides cost nothing. Stored rows are never modified.
+"""
+import hashlib
+import weakref
+from itertools import groupby
+from typing import Any, Dict, List, Sequence
+
+from db.property_path_storage import PropertyPathStorage, path_label
+
+
+# Override rows grouped per (material, path)
+_OVERRIDES = """
+    SELECT material_id,
+           text2ltree(path_labels(property_path)) AS path,
+           MAX(override_data->>'preferred_ref')
+               FILTER (WHERE override_type = 'reference_preference') AS preferred_ref,
+           bool_or(override_type = 'value_override') AS has_value,
+           MAX(override_data->>'value') FILTER (WHERE override_type = 'value_override') AS value,
+           MAX(override_data->>'unit') FILTER (WHERE override_type = 'value_override') AS unit
+    FROM material_overrides
+    WHERE material_id = ANY(ids)
+    GROUP BY material_id, property_path"""
+
+# Every stored value of the materials
+_ALL_VALUES = """
+    SELECT pc.material_id, e.path, e.value, p.unit, e.ref_id, e.entry_index, e.entry_id AS row_id
+    FROM property_categories pc
+    JOIN properties p ON p.category_id = pc.category_id
+    JOIN property_entries e ON e.property_id = p.property_id
+    WHERE pc.material_id = ANY(ids)
+    UNION ALL
+    SELECT mo.material_id, e.path, e.value, e.unit, e.ref_id, e.entry_index, e.param_id
+    FROM models mo
+    JOIN sub_models sm ON sm.model_id = mo.model_id
+    JOIN model_parameters e ON e.sub_model_id = sm.sub_model_id
+    WHERE mo.material_id = ANY(ids)"""
+
+# Stored values at overridden paths only (path index lookups)
+_OVERRIDDEN_VALUES = """
+    SELECT o.material_id, e.path, e.value, p.unit, e.ref_id, e.entry_index, e.entry_id AS row_id
+    FROM o
+    JOIN property_entries e ON e.path = o.path
+    JOIN properties p ON p.property_id = e.property_id
+    JOIN property_categories pc ON pc.category_id = p.category_id AND pc.material_id = o.material_id
+    UNION ALL
+    SELECT o.material_id, e.path, e.value, e.unit, e.ref_id, e.entry_index, e.param_id
+    FROM o
+    JOIN model_parameters e ON e.path = o.path
+    JOIN sub_models sm ON sm.sub_model_id = e.sub_model_id
+    JOIN models mo ON mo.model_id = sm.model_id AND mo.material_id = o.material_id"""
+
+
+def _resolution_sql(name: str, values: str, changed_only: bool) -> str:
+    changed = "AND source <> 'stored'" if changed_only else ""
+    return f"""
+        CREATE OR REPLACE FUNCTION {name}(ids INTEGER[])
+        RETURNS TABLE (material_id INTEGER, path TEXT, value TEXT, unit TEXT,
+                       ref_id TEXT, entry_index INTEGER, source TEXT) AS $$
+            WITH o AS ({_OVERRIDES}
+            ),
+            s AS ({values}
+            ),
+            ranked AS (
+                SELECT s.*, o.preferred_ref,
+                       COALESCE(o.has_value, FALSE) AS has_value,
+                       o.value AS override_value, o.unit AS override_unit,
+                       COALESCE(bool_or(s.ref_id = o.preferred_ref) OVER w, FALSE) AS has_preferred,
+                       row_number() OVER (w ORDER BY s.entry_index, s.row_id) AS n,
+                       row_number() OVER (PARTITION BY s.material_id, s.path,
+                                                       s.ref_id IS NOT DISTINCT FROM o.preferred_ref
+                                          ORDER BY s.entry_index, s.row_id) AS n_ref
+                FROM s
+                LEFT JOIN o ON o.material_id = s.material_id AND o.path = s.path
+                WINDOW w AS (PARTITION BY s.material_id, s.path)
+            ),
+            resolved AS (
+                SELECT r.material_id,
+                       r.path::text AS path,
+                       (CASE WHEN r.has_value THEN r.override_value ELSE r.value END)::text AS value,
+                       (CASE WHEN r.has_value THEN COALESCE(r.override_unit, r.unit) ELSE r.unit END)::text AS unit,
+                       (CASE WHEN r.has_value THEN 'USER_OVERRIDE' ELSE r.ref_id END)::text AS ref_id,
+                       (CASE WHEN r.has_value THEN 1 ELSE r.entry_index END)::integer AS entry_index,
+                       CASE WHEN r.has_value THEN 'override'
+                            WHEN r.has_preferred THEN 'preferred'
+                            ELSE 'stored' END AS source
+                FROM ranked r
+                WHERE CASE WHEN r.has_value THEN r.n = 1
+                           WHEN r.has_preferred THEN r.ref_id = r.preferred_ref AND r.n_ref = 1
+                           ELSE TRUE END
+            )
+            SELECT * FROM resolved
+            WHERE TRUE {changed}
+            ORDER BY material_id, path, entry_index
+        $$ LANGUAGE sql STABLE;
+    """
+
+
+def get_functions_sql() -> str:
+    """Resolution functions (need the path columns and material_overrides)."""
+    return (_resolution_sql('effective_material_values', _ALL_VALUES, changed_only=False)
+            + _resolution_sql('material_override_values', _OVERRIDDEN_VALUES, changed_only=True))
+
+
+# Stored as the function comment; the functions are replaced only when it differs
+FUNCTIONS_VERSION = hashlib.md5(get_functions_sql().encode()).hexdigest()
+
+# Serializes installs (concurrent CREATE OR REPLACE on one function fails)
+_INSTALL_LOCK = 0x6F766572
+
+
+def _resolve(node: Any, labels: List[str]):
+    """(container, key) of the value a stored path addresses, or None."""
+    parent, key = None, None
+    i = 0
+    while i < len(labels):
+        label = labels[i]
+        if not isinstance(node, dict):
+            return None
+        if label == 'Row' and isinstance(node.get('rows'), list) and i + 1 < len(labels):
+            # EOS rows: models.EOSModel.Row.<index>.<parameter>
+            row = next((r for r in node['rows'] if path_label(str(r.get('index'))) == labels[i + 1]), None)
+            if row is None:
+                return None
+            node = row.get('parameters', {})
+            i += 2
+            continue
+        key = next((k for k in node if path_label(str(k)) == label), None)
+        if key is None:
+            return None
+        parent, node = node, node[key]
+        i += 1
+    return (parent, key) if parent is not None else None
+
+
+def apply_effective_values(material_data: Dict[str, Any], rows: Sequence[Dict[str, Any]]) -> int:
+    """
+    Write resolved values into an assembled material dictionary (in place).
+
+    Args:
+        material_data: Material dictionary as built by MaterialQuerier
+        rows: Rows of one material from material_override_values()
+
+    Returns:
+        Number of paths updated (paths missing from the dictionary are skipped)
+    """
+    updated = 0
+    for path, group in groupby(rows, key=lambda row: row['path']):
+        group = list(group)
+        labels = path.split('.')
+        target = _resolve(material_data.get(labels[0]), labels[1:])
+        if target is None:
+            continue
+        parent, key = target
+        node = parent[key]
+        entries = [{'value': row['value'], 'unit': row['unit'], 'ref': row['ref_id'],
+                    'index': row['entry_index']} for row in group]
+
+        if node is None or isinstance(node, str):
+            # Phase.State is stored as a plain string
+            parent[key] = entries[0]['value']
+        elif isinstance(node, dict) and 'entries' in node:
+            # Property entries carry no unit unless overridden
+            for entry, row in zip(entries, group):
+                if row['source'] != 'override':
+                    del entry['unit']
+            node['entries'] = entries
+        elif isinstance(node, list):
+            parent[key] = entries
+        else:
+            parent[key] = entries[0] if len(entries) == 1 else entries
+        updated += 1
+    return updated
+
+
+class OverrideResolutionStorage:
+    """
+    Installs the resolution functions and fetches resolved values.
+    Does NOT modify core material tables or material_overrides.
+    """
+
+    # Connections whose functions are known to be current
+    _installed = weakref.WeakSet()
+
+    def __init__(self, connection, paths: PropertyPathStorage):
+        """
+        Initialize override resolution storage.
+
+        Resolution is available once the property paths are installed and
+        backfilled; callers fall back to OverrideManager otherwise. The
+        functions are checked once per connection.
+
+        Args:
+            connection: psycopg2 connection object (material_overrides must exist)
+            paths: Property path storage of the same connection
+        """
+        self.conn = connection
+        self.available = paths.available and paths.complete() and self._ensure_functions()
+
+    def _ensure_functions(self) -> bool:
+        """Install the resolution functions unless current; False if that fails."""
+        if self.conn in OverrideResolutionStorage._installed:
+            return True
+        with self.conn.cursor() as cur:
+            try:
+                if self._installed_version(cur) != FUNCTIONS_VERSION:
+                    # Re-check under the lock: another session may have just installed them
+                    cur.execute("SELECT pg_advisory_xact_lock(%s)", (_INSTALL_LOCK,))
+                    if self._installed_version(cur) != FUNCTIONS_VERSION:
+                        cur.execute(get_functions_sql())
+                        cur.execute("COMMENT ON FUNCTION material_override_values(INTEGER[]) IS %s",
+                                    (FUNCTIONS_VERSION,))
+                self.conn.commit()
+            except Exception as e:
+                self.conn.rollback()
+                print(f"⚠ Server-side override resolution unavailable: {e}")
+                return False
+        OverrideResolutionStorage._installed.add(self.conn)
+        return True
+
+    @staticmethod
+    def _installed_version(cur) -> str:
+        """Version comment of the installed functions (None if missing)."""
+        cur.execute("""
+            SELECT obj_description(to_regprocedure('material_override_values(integer[])'),
+                                   'pg_proc') AS version
+        """)
+        row = cur.fetchone()
+        return row['version'] if isinstance(row, dict) else row[0]
+
+    def effective_values(self, material_ids: Sequence[int],
+                         changed_only: bool = False) -> List[Dict[str, Any]]:
+        """
+        Resolved values of many materials in one query.
+
+        Args:
+            material_ids: Material IDs
+            changed_only: Only values changed by overrides
+
+        Returns:
+            Rows of {'material_id', 'path', 'value', 'unit', 'ref_id',
+            'entry_index', 'source'} ordered by material, path and entry index;
+            source is 'stored', 'preferred' or 'override'
+        """
+        function = 'material_override_values' if changed_only else 'effective_material_values'
+        with self.conn.cursor() as cur:
+            cur.execute(f"SELECT * FROM {function}(%s)", (list(material_ids),))
+            rows = cur.fetchall()
+
+        keys = ('material_id', 'path', 'value', 'unit', 'ref_id', 'entry_index', 'source')
+        return [dict(row) if isinstance(row, dict) else dict(zip(keys, row)) for row in rows]
@@ -4,10 +4,26 @@ Stores user overrides SEPARATELY from reference data.
 
 CRITICAL: This module does NOT modify core tables.
 Overrides are stored in a dedicated table for persistence.
+
+All edits go through apply_overrides_bulk(): rows are upserted with
+multi-row statements, BATCH_SIZE rows per round trip, in one transaction.
 """
 import psycopg2
-from typing import Dict, List, Any, Optional
+from psycopg2.extras import execute_values
+from typing import Dict, Iterable, Iterator, List, Any, Optional, Sequence, Tuple
 import json
+import weakref
+
+from db.database import stream_query
+
+
+# Override rows per INSERT/DELETE statement in apply_overrides_bulk
+BATCH_SIZE = 1000
+
+OVERRIDE_TYPES = ('reference_preference', 'value_override')
+
+# (material_id, property_path, override_type, override_data or None to delete)
+OverrideRow = Tuple[int, str, Optional[str], Optional[Dict[str, Any]]]
 
 
 class OverrideStorage:
@@ -16,34 +32,122 @@ class OverrideStorage:
     Does NOT touch core material tables.
     """
     
+    # Connections whose override table has been checked
+    _checked = weakref.WeakSet()
+    
     def __init__(self, connection):
         """
         Initialize override storage.
         
+        The override table is checked once per connection.
+        
         Args:
             connection: psycopg2 connection object
         """
         self.conn = connection
-        self._ensure_override_table()
+        if connection not in OverrideStorage._checked:
+            self._ensure_override_table()
+            OverrideStorage._checked.add(connection)
     
     def _ensure_override_table(self):
         """Create override table if it doesn't exist."""
         with self.conn.cursor() as cur:
-            cur.execute("""
-                CREATE TABLE IF NOT EXISTS material_overrides (
-                    override_id SERIAL PRIMARY KEY,
-                    material_id INTEGER NOT NULL REFERENCES materials(material_id) ON DELETE CASCADE,
-                    property_path TEXT NOT NULL,
-                    override_type TEXT NOT NULL CHECK (override_type IN ('reference_preference', 'value_override')),
-                    override_data JSONB NOT NULL,
-                    created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP,
-                    UNIQUE(material_id, property_path, override_type)
-                );
+            cur.execute("SELECT to_regclass('material_overrides') IS NOT NULL AS present")
+            row = cur.fetchone()
+            if not (row['present'] if isinstance(row, dict) else row[0]):
+                cur.execute("""
+                    CREATE TABLE IF NOT EXISTS material_overrides (
+                        override_id SERIAL PRIMARY KEY,
+                        material_id INTEGER NOT NULL REFERENCES materials(material_id) ON DELETE CASCADE,
+                        property_path TEXT NOT NULL,
+                        override_type TEXT NOT NULL CHECK (override_type IN ('reference_preference', 'value_override')),
+                        override_data JSONB NOT NULL,
+                        created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP,
+                        UNIQUE(material_id, property_path, override_type)
+                    );
+                    
+                    CREATE INDEX IF NOT EXISTS idx_overrides_material 
+                    ON material_overrides(material_id);
+                """)
+            self.conn.commit()
+    
+    def apply_overrides_bulk(self, rows: Iterable[OverrideRow],
+                             replace_materials: Sequence[int] = ()) -> Dict[str, int]:
+        """
+        Save and delete many overrides in a single transaction.
+        
+        Rows are consumed lazily, so a generator (e.g. a file being parsed)
+        is never held in memory. When a key occurs more than once, the last
+        row wins. Nothing is saved if any row or statement fails.
+        
+        Args:
+            rows: (material_id, property_path, override_type, override_data);
+                  override_data None deletes the override, and override_type
+                  None with it deletes both types at that path
+            replace_materials: Materials whose existing overrides are all
+                               deleted first
+        
+        Returns:
+            {'saved': n, 'deleted': n} row counts sent to the database
+        """
+        counts = {'saved': 0, 'deleted': 0}
+        try:
+            with self.conn.cursor() as cur:
+                if replace_materials:
+                    cur.execute("""
+                        DELETE FROM material_overrides
+                        WHERE material_id = ANY(%s)
+                    """, (list(replace_materials),))
                 
-                CREATE INDEX IF NOT EXISTS idx_overrides_material 
-                ON material_overrides(material_id);
-            """)
+                batch = {}
+                for material_id, property_path, override_type, override_data in rows:
+                    if override_data is None and override_type is None:
+                        types = OVERRIDE_TYPES
+                    elif override_type in OVERRIDE_TYPES:
+                        types = (override_type,)
+                    else:
+                        raise ValueError(f"Unknown override type: {override_type}")
+                    for t in types:
+                        # Re-inserted so the batch keeps the latest order
+                        batch.pop((material_id, property_path, t), None)
+                        batch[(material_id, property_path, t)] = override_data
+                    if len(batch) >= BATCH_SIZE:
+                        self._write_batch(cur, batch, counts)
+                        batch = {}
+                self._write_batch(cur, batch, counts)
             self.conn.commit()
+        except Exception:
+            self.conn.rollback()
+            raise
+        return counts
+    
+    @staticmethod
+    def _write_batch(cur, batch: Dict[Tuple[int, str, str], Optional[Dict[str, Any]]],
+                     counts: Dict[str, int]):
+        """One multi-row upsert and one multi-row delete (keys are unique)."""
+        upserts = [(material_id, path, override_type, json.dumps(data))
+                   for (material_id, path, override_type), data in batch.items() if data is not None]
+        deletes = [key for key, data in batch.items() if data is None]
+        
+        if upserts:
+            execute_values(cur, """
+                INSERT INTO material_overrides 
+                (material_id, property_path, override_type, override_data)
+                VALUES %s
+                ON CONFLICT (material_id, property_path, override_type)
+                DO UPDATE SET override_data = EXCLUDED.override_data,
+                             created_at = CURRENT_TIMESTAMP
+            """, upserts, template="(%s, %s, %s, %s::jsonb)", page_size=BATCH_SIZE)
+            counts['saved'] += len(upserts)
+        if deletes:
+            execute_values(cur, """
+                DELETE FROM material_overrides o
+                USING (VALUES %s) AS d(material_id, property_path, override_type)
+                WHERE o.material_id = d.material_id
+                  AND o.property_path = d.property_path
+                  AND o.override_type = d.override_type
+            """, deletes, template="(%s::integer, %s::text, %s::text)", page_size=BATCH_SIZE)
+            counts['deleted'] += len(deletes)
     
     def save_reference_preference(self, material_id: int, property_path: str, 
                                    preferred_ref: str):
@@ -56,17 +160,9 @@ class OverrideStorage:
             preferred_ref: Preferred reference ID
         """
         override_data = {'preferred_ref': preferred_ref}
-        
-        with self.conn.cursor() as cur:
-            cur.execute("""
-                INSERT INTO material_overrides 
-                (material_id, property_path, override_type, override_data)
-                VALUES (%s, %s, 'reference_preference', %s)
-                ON CONFLICT (material_id, property_path, override_type)
-                DO UPDATE SET override_data = EXCLUDED.override_data,
-                             created_at = CURRENT_TIMESTAMP
-            """, (material_id, property_path, json.dumps(override_data)))
-            self.conn.commit()
+        self.apply_overrides_bulk([
+            (material_id, property_path, 'reference_preference', override_data)
+        ])
     
     def save_value_override(self, material_id: int, property_path: str, 
                            override_value: str, unit: Optional[str] = None,
@@ -86,17 +182,9 @@ class OverrideStorage:
             'unit': unit,
             'reason': reason
         }
-        
-        with self.conn.cursor() as cur:
-            cur.execute("""
-                INSERT INTO material_overrides 
-                (material_id, property_path, override_type, override_data)
-                VALUES (%s, %s, 'value_override', %s)
-                ON CONFLICT (material_id, property_path, override_type)
-                DO UPDATE SET override_data = EXCLUDED.override_data,
-                             created_at = CURRENT_TIMESTAMP
-            """, (material_id, property_path, json.dumps(override_data)))
-            self.conn.commit()
+        self.apply_overrides_bulk([
+            (material_id, property_path, 'value_override', override_data)
+        ])
     
     def load_overrides(self, material_id: int) -> Dict[str, Any]:
         """
@@ -141,18 +229,7 @@ class OverrideStorage:
             property_path: Path to property
             override_type: Specific override type or None for all
         """
-        with self.conn.cursor() as cur:
-            if override_type:
-                cur.execute("""
-                    DELETE FROM material_overrides
-                    WHERE material_id = %s AND property_path = %s AND override_type = %s
-                """, (material_id, property_path, override_type))
-            else:
-                cur.execute("""
-                    DELETE FROM material_overrides
-                    WHERE material_id = %s AND property_path = %s
-                """, (material_id, property_path))
-            self.conn.commit()
+        self.apply_overrides_bulk([(material_id, property_path, override_type, None)])
     
     def delete_all_overrides(self, material_id: int):
         """
@@ -161,12 +238,7 @@ class OverrideStorage:
         Args:
             material_id: Material ID
         """
-        with self.conn.cursor() as cur:
-            cur.execute("""
-                DELETE FROM material_overrides
-                WHERE material_id = %s
-            """, (material_id,))
-            self.conn.commit()
+        self.apply_overrides_bulk([], replace_materials=[material_id])
     
     def list_overrides(self, material_id: int) -> List[Dict[str, Any]]:
         """
@@ -178,27 +250,34 @@ class OverrideStorage:
         Returns:
             List of override dictionaries
         """
-        with self.conn.cursor() as cur:
-            cur.execute("""
-                SELECT property_path, override_type, override_data, created_at
-                FROM material_overrides
-                WHERE material_id = %s
-                ORDER BY created_at DESC
-            """, (material_id,))
-            
-            results = []
-            for row in cur.fetchall():
-                property_path, override_type, override_data, created_at = row
-                data = json.loads(override_data) if isinstance(override_data, str) else override_data
-                
-                results.append({
-                    'property_path': property_path,
-                    'override_type': override_type,
-                    'override_data': data,
-                    'created_at': created_at
-                })
+        return list(self.iter_overrides(material_id))
+    
+    def iter_overrides(self, material_id: int) -> Iterator[Dict[str, Any]]:
+        """
+        Stream the overrides of a material, newest first (server-side cursor).
+        
+        Args:
+            material_id: Material ID
+        
+        Yields:
+            Override dictionaries as returned by list_overrides()
+        """
+        sql = """
+            SELECT property_path, override_type, override_data, created_at
+            FROM material_overrides
+            WHERE material_id = %s
+            ORDER BY created_at DESC
+        """
+        for row in stream_query(self.conn, sql, (material_id,)):
+            property_path, override_type, override_data, created_at = row
+            data = json.loads(override_data) if isinstance(override_data, str) else override_data
             
-            return results
+            yield {
+                'property_path': property_path,
+                'override_type': override_type,
+                'override_data': data,
+                'created_at': created_at
+            }
     
     def has_overrides(self, material_id: int) -> bool:
         """
@@ -210,14 +289,42 @@ class OverrideStorage:
         Returns:
             True if material has overrides
         """
+        return self.count_overrides(material_id) > 0
+    
+    def count_overrides(self, material_id: int) -> int:
+        """
+        Number of overrides of a material.
+        
+        Args:
+            material_id: Material ID
+        
+        Returns:
+            Override count
+        """
         with self.conn.cursor() as cur:
             cur.execute("""
                 SELECT COUNT(*) FROM material_overrides
                 WHERE material_id = %s
             """, (material_id,))
-            count = cur.fetchone()[0]
-            return count > 0
+            return cur.fetchone()[0]
 
+    
+    def materials_with_overrides(self, material_ids: List[int]) -> set:
+        """
+        Which of the given materials have overrides (one query).
+        
+        Args:
+            material_ids: Material IDs
+        
+        Returns:
+            Set of material IDs with at least one override
+        """
+        with self.conn.cursor() as cur:
+            cur.execute("""
+                SELECT DISTINCT material_id FROM material_overrides
+                WHERE material_id = ANY(%s)
+            """, (list(material_ids),))
+            return {row[0] for row in cur.fetchall()}
 
 def create_override_storage(connection) -> OverrideStorage:
     """
@@ -0,0 +1,352 @@
+"""
+Property Path Storage for Material Database Engine.
+Indexed ltree paths on property entries and model parameters, and a small
+path query language compiled to a single SQL query.
+
+Every property entry and model parameter gets a stored path in the same
+dotted layout used by overrides and the property viewer:
+
+    properties.Thermal.Density
+    models.ElasticModel.ThermoMechanical.Density
+    models.ElastoPlastic.ShearModulus
+    models.EOSModel.Row.2.K0
+    models.EOSModel.Row.2.unreacted.K0
+
+Paths are set by triggers (and recomputed when a parent is renamed), and a
+GiST index answers pattern matches without walking the model tables.
+
+Path query language (one dot-separated segment per level):
+
+    Density              a name (case-sensitive)
+    Dens*                names starting with "Dens"
+    unreacted|reacted    either name
+    *                    exactly one level
+    **                   any number of levels (including none)
+    Row[2], Row[*]       Row number 2, any Row
+
+A query that does not start with "models", "properties" or a wildcard is
+looked up under both roots, so "EOSModel.Row[*].K0" finds K0 in every EOS
+row. Characters other than letters, digits and "_" are stored as "_".
+"""
+import re
+from typing import Any, Callable, Dict, List, Optional, Sequence, Tuple
+
+from db.reference_key_storage import run_in_batches, BATCH_SIZE
+
+
+ROOTS = ('properties', 'models')
+
+_SEGMENT = re.compile(r'^(?P<name>[^\[\]]*?)(?:\[(?P<index>\d+|\*)\])?$')
+_LABEL = re.compile(r'[^A-Za-z0-9_]')
+
+
+def path_label(name: str) -> str:
+    """Stored label for a name (mirrors the SQL path_label function)."""
+    return _LABEL.sub('_', name) or '_'
+
+
+def _compile_name(name: str) -> str:
+    if name == '**':
+        return '*'
+    if name == '*':
+        return '*{1}'
+    alternatives = []
+    for alternative in name.split('|'):
+        prefix = alternative.endswith('*')
+        label = alternative[:-1] if prefix else alternative
+        if not label or '*' in label:
+            raise ValueError(f"Invalid path segment: '{name}'")
+        alternatives.append(path_label(label) + ('*' if prefix else ''))
+    return '|'.join(alternatives)
+
+
+def compile_path(query: str) -> Tuple[str, Tuple[str, ...]]:
+    """
+    Compile a path query to an lquery.
+
+    Args:
+        query: Path query, e.g. "EOSModel.Row[*].K0"
+
+    Returns:
+        (lquery text, roots the query can match)
+
+    Raises:
+        ValueError: If the query is empty or malformed
+    """
+    segments = [segment.strip() for segment in query.strip().split('.')]
+    if not query.strip() or not all(segments):
+        raise ValueError(f"Invalid path query: '{query}'")
+
+    labels = []
+    for segment in segments:
+        match = _SEGMENT.match(segment)
+        if not match or not match.group('name'):
+            raise ValueError(f"Invalid path segment: '{segment}'")
+        labels.append(_compile_name(match.group('name')))
+        index = match.group('index')
+        if index is not None:
+            labels.append('*{1}' if index == '*' else str(int(index)))
+
+    if segments[0] in ROOTS:
+        roots = (segments[0],)
+    else:
+        roots = ROOTS
+        if not segments[0].startswith('*'):
+            labels.insert(0, '*{1}')
+    return '.'.join(labels), roots
+
+
+# Per root: (FROM/JOIN clause from alias e to materials m, unit column)
+_SOURCES = {
+    'properties': (
+        "property_entries e "
+        "JOIN properties p ON p.property_id = e.property_id "
+        "JOIN property_categories pc ON pc.category_id = p.category_id "
+        "JOIN materials m ON m.material_id = pc.material_id",
+        'p.unit',
+    ),
+    'models': (
+        "model_parameters e "
+        "JOIN sub_models sm ON sm.sub_model_id = e.sub_model_id "
+        "JOIN models mo ON mo.model_id = sm.model_id "
+        "JOIN materials m ON m.material_id = mo.material_id",
+        'e.unit',
+    ),
+}
+
+
+def path_query_sql(roots: Sequence[str] = ROOTS, filter_materials: bool = False) -> str:
+    """
+    Values whose path matches an lquery, over one or many materials.
+
+    Parameters: lquery and materials (names) when filter_materials is set.
+    """
+    materials = "AND m.name = ANY(%(materials)s)" if filter_materials else ""
+    selects = [f"""
+        SELECT m.name AS material, e.path::text AS path, e.value, {unit} AS unit,
+               e.ref_id AS ref, e.entry_index AS "index"
+        FROM {source}
+        WHERE e.path ~ %(lquery)s::lquery {materials}"""
+               for source, unit in (_SOURCES[root] for root in roots)]
+    return "\nUNION ALL".join(selects) + "\nORDER BY material, path, \"index\""
+
+
+def get_functions_sql() -> str:
+    """Path functions and the triggers that keep stored paths current."""
+    return """
+        CREATE OR REPLACE FUNCTION path_label(name TEXT) RETURNS TEXT AS $$
+            SELECT COALESCE(NULLIF(regexp_replace(name, '[^A-Za-z0-9_]', '_', 'g'), ''), '_')
+        $$ LANGUAGE sql IMMUTABLE;
+
+        -- Dotted names (e.g. SpecificHeatConstants.c0) become nested labels
+        CREATE OR REPLACE FUNCTION path_labels(name TEXT) RETURNS TEXT AS $$
+            SELECT string_agg(path_label(part), '.' ORDER BY n)
+            FROM unnest(string_to_array(name, '.')) WITH ORDINALITY AS t(part, n)
+        $$ LANGUAGE sql IMMUTABLE;
+
+        CREATE OR REPLACE FUNCTION property_entry_path(pid INTEGER) RETURNS ltree AS $$
+            SELECT text2ltree('properties.' || path_label(pc.category_type) || '.'
+                              || path_labels(p.property_name))
+            FROM properties p
+            JOIN property_categories pc ON pc.category_id = p.category_id
+            WHERE p.property_id = pid
+        $$ LANGUAGE sql STABLE;
+
+        -- Sub-models named like their model or parameter are not repeated
+        -- (models.ReactionModel.LnZ, models.ElastoPlastic.ShearModulus)
+        CREATE OR REPLACE FUNCTION model_parameter_path(smid INTEGER, param TEXT) RETURNS ltree AS $$
+            SELECT text2ltree(concat_ws('.', 'models', path_label(mo.model_type),
+                CASE WHEN sm.row_index IS NOT NULL THEN path_label(sm.sub_model_type) || '.' || sm.row_index
+                     WHEN sm.parent_sub_model_id IS NOT NULL THEN NULL
+                     WHEN sm.sub_model_type IN (mo.model_type, param) THEN NULL
+                     ELSE path_label(sm.sub_model_type) END,
+                CASE WHEN sm.parent_sub_model_id IS NOT NULL
+                     THEN path_label(COALESCE(sm.parent_name, sm.sub_model_type)) END,
+                path_labels(param)))
+            FROM sub_models sm
+            JOIN models mo ON mo.model_id = sm.model_id
+            WHERE sm.sub_model_id = smid
+        $$ LANGUAGE sql STABLE;
+
+        CREATE OR REPLACE FUNCTION property_entries_set_path() RETURNS TRIGGER AS $$
+        BEGIN
+            NEW.path := property_entry_path(NEW.property_id);
+            RETURN NEW;
+        END;
+        $$ LANGUAGE plpgsql;
+
+        CREATE OR REPLACE FUNCTION model_parameters_set_path() RETURNS TRIGGER AS $$
+        BEGIN
+            NEW.path := model_parameter_path(NEW.sub_model_id, NEW.param_name);
+            RETURN NEW;
+        END;
+        $$ LANGUAGE plpgsql;
+
+        -- Renaming a category, property, model or sub-model moves its values
+        CREATE OR REPLACE FUNCTION paths_on_parent_rename() RETURNS TRIGGER AS $$
+        BEGIN
+            IF TG_TABLE_NAME = 'property_categories' THEN
+                UPDATE property_entries e SET path = property_entry_path(e.property_id)
+                FROM properties p
+                WHERE p.property_id = e.property_id AND p.category_id = NEW.category_id;
+            ELSIF TG_TABLE_NAME = 'properties' THEN
+                UPDATE property_entries SET path = property_entry_path(property_id)
+                WHERE property_id = NEW.property_id;
+            ELSIF TG_TABLE_NAME = 'models' THEN
+                UPDATE model_parameters e SET path = model_parameter_path(e.sub_model_id, e.param_name)
+                FROM sub_models sm
+                WHERE sm.sub_model_id = e.sub_model_id AND sm.model_id = NEW.model_id;
+            ELSE
+                UPDATE model_parameters SET path = model_parameter_path(sub_model_id, param_name)
+                WHERE sub_model_id = NEW.sub_model_id;
+            END IF;
+            RETURN NULL;
+        END;
+        $$ LANGUAGE plpgsql;
+    """
+
+
+# Parent table -> columns whose change moves the stored paths below it
+_PARENT_COLUMNS = {
+    'property_categories': 'category_type',
+    'properties': 'property_name, category_id',
+    'models': 'model_type',
+    'sub_models': 'sub_model_type, model_id, row_index, parent_sub_model_id, parent_name',
+}
+
+
+def get_triggers_sql() -> str:
+    """Row triggers on the value tables and their parents."""
+    sql = ["""
+        DROP TRIGGER IF EXISTS property_entries_path ON property_entries;
+        CREATE TRIGGER property_entries_path
+            BEFORE INSERT OR UPDATE OF property_id ON property_entries
+            FOR EACH ROW EXECUTE PROCEDURE property_entries_set_path();
+
+        DROP TRIGGER IF EXISTS model_parameters_path ON model_parameters;
+        CREATE TRIGGER model_parameters_path
+            BEFORE INSERT OR UPDATE OF sub_model_id, param_name ON model_parameters
+            FOR EACH ROW EXECUTE PROCEDURE model_parameters_set_path();"""]
+    for table, columns in _PARENT_COLUMNS.items():
+        sql.append(f"""
+        DROP TRIGGER IF EXISTS {table}_paths ON {table};
+        CREATE TRIGGER {table}_paths
+            AFTER UPDATE OF {columns} ON {table}
+            FOR EACH ROW EXECUTE PROCEDURE paths_on_parent_rename();""")
+    return "\n".join(sql)
+
+
+def get_create_sql() -> str:
+    """Extension, path columns, GiST indexes, functions and triggers."""
+    return "\n".join([
+        "CREATE EXTENSION IF NOT EXISTS ltree;",
+        "ALTER TABLE property_entries ADD COLUMN IF NOT EXISTS path ltree;",
+        "ALTER TABLE model_parameters ADD COLUMN IF NOT EXISTS path ltree;",
+        "CREATE INDEX IF NOT EXISTS idx_property_entries_path ON property_entries USING GIST (path);",
+        "CREATE INDEX IF NOT EXISTS idx_model_parameters_path ON model_parameters USING GIST (path);",
+        # Rows still waiting for backfill() (empty once migrated)
+        "CREATE INDEX IF NOT EXISTS idx_property_entries_path_missing ON property_entries(entry_id) WHERE path IS NULL;",
+        "CREATE INDEX IF NOT EXISTS idx_model_parameters_path_missing ON model_parameters(param_id) WHERE path IS NULL;",
+        get_functions_sql(),
+        get_triggers_sql(),
+    ])
+
+
+class PropertyPathStorage:
+    """
+    Manages the ltree path columns and answers path queries.
+    Does NOT change stored values.
+    """
+
+    def __init__(self, connection):
+        """
+        Initialize property path storage.
+
+        Installs ltree, the path columns and triggers if needed. Rows stored
+        before that get their paths from backfill().
+
+        Args:
+            connection: psycopg2 connection object
+        """
+        self.conn = connection
+        self.available = self._ensure_paths()
+
+    def _ensure_paths(self) -> bool:
+        """Create extension, columns and triggers; False if ltree is unavailable."""
+        with self.conn.cursor() as cur:
+            try:
+                # The last trigger created by get_create_sql() marks a full install
+                cur.execute("SELECT EXISTS (SELECT 1 FROM pg_trigger WHERE tgname = 'sub_models_paths') AS present")
+                row = cur.fetchone()
+                if not (row['present'] if isinstance(row, dict) else row[0]):
+                    cur.execute(get_create_sql())
+                self.conn.commit()
+            except Exception as e:
+                self.conn.rollback()
+                print(f"⚠ Property paths unavailable: {e}")
+                return False
+        return True
+
+    def complete(self) -> bool:
+        """True when every stored row has its path (backfill() has finished)."""
+        with self.conn.cursor() as cur:
+            cur.execute("""
+                SELECT NOT EXISTS (SELECT 1 FROM property_entries WHERE path IS NULL)
+                   AND NOT EXISTS (SELECT 1 FROM model_parameters WHERE path IS NULL) AS complete
+            """)
+            row = cur.fetchone()
+        self.conn.commit()
+        return bool(row['complete'] if isinstance(row, dict) else row[0])
+
+    def backfill(self, batch_size: int = BATCH_SIZE,
+                 progress: Optional[Callable[[str, int, int], None]] = None):
+        """
+        Set paths of rows stored before the path columns existed.
+
+        Runs in primary-key batches, one commit each; safe to re-run.
+
+        Args:
+            batch_size: Rows per committed batch
+            progress: Optional callback(table, done, total)
+        """
+        report = progress or (lambda table, done, total: None)
+        run_in_batches(self.conn, """
+            UPDATE property_entries SET path = property_entry_path(property_id)
+            WHERE entry_id > %(start)s AND entry_id <= %(stop)s AND path IS NULL
+        """, "SELECT COALESCE(MAX(entry_id), 0) FROM property_entries", batch_size,
+            lambda done, total: report('property_entries', done, total))
+        run_in_batches(self.conn, """
+            UPDATE model_parameters SET path = model_parameter_path(sub_model_id, param_name)
+            WHERE param_id > %(start)s AND param_id <= %(stop)s AND path IS NULL
+        """, "SELECT COALESCE(MAX(param_id), 0) FROM model_parameters", batch_size,
+            lambda done, total: report('model_parameters', done, total))
+
+    def query(self, path_query: str, materials: Optional[Sequence[str]] = None) -> List[Dict[str, Any]]:
+        """
+        Values matching a path query, in one indexed SQL query.
+
+        Args:
+            path_query: e.g. "EOSModel.Row[*].K0" or "properties.Thermal.Dens*"
+            materials: Material names to search (all materials if None)
+
+        Returns:
+            List of {'material', 'path', 'value', 'unit', 'ref', 'index'}
+            ordered by material, path and entry index
+
+        Raises:
+            ValueError: If the path query is malformed
+            RuntimeError: If ltree is not available
+        """
+        if not self.available:
+            raise RuntimeError("Property paths require the PostgreSQL ltree extension")
+        lquery, roots = compile_path(path_query)
+        params = {'lquery': lquery}
+        if materials is not None:
+            params['materials'] = list(materials)
+
+        with self.conn.cursor() as cur:
+            cur.execute(path_query_sql(roots, filter_materials=materials is not None), params)
+            rows = cur.fetchall()
+
+        keys = ('material', 'path', 'value', 'unit', 'ref', 'index')
+        return [dict(row) if isinstance(row, dict) else dict(zip(keys, row)) for row in rows]
@@ -4,15 +4,27 @@ Retrieves material data from PostgreSQL database.
 
 Returns data in a structure that mirrors the original XML.
 """
-from typing import Dict, List, Any, Optional
+from typing import Dict, Iterator, List, Any, Optional
+from itertools import groupby
+from psycopg2.extensions import TRANSACTION_STATUS_IDLE
+import re
 import sys
 import os
+import weakref
 
 sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
 
-from db.database import DatabaseManager
+from db.database import DatabaseManager, stream_query
 from overrides.override_manager import OverrideManager
 from db.override_storage import OverrideStorage
+from db.schema import get_references_search_sql
+from db.reference_key_storage import ReferenceKeyStorage
+from db.property_path_storage import PropertyPathStorage
+from db.material_document_storage import MaterialDocumentStorage
+from db.override_resolution_storage import OverrideResolutionStorage, apply_effective_values
+
+
+MATERIAL_FIELDS = ['material_id', 'xml_id', 'name', 'author', 'date', 'version', 'created_at']
 
 
 class MaterialQuerier:
@@ -29,6 +41,9 @@ class MaterialQuerier:
         self.conn = db_manager.connect()
         self.override_manager = OverrideManager()
         self.override_storage = OverrideStorage(self.conn)
+        self.paths = PropertyPathStorage(self.conn)
+        self.documents = MaterialDocumentStorage(self.conn)
+        self.resolution = OverrideResolutionStorage(self.conn, self.paths)
     
     def get_material_by_name(self, name: str, apply_overrides: bool = True) -> Optional[Dict[str, Any]]:
         """
@@ -63,14 +78,67 @@ class MaterialQuerier:
         Returns:
             Material data dictionary
         """
-        material_data = {
-            'metadata': self._get_metadata(material_id),
-            'properties': self._get_properties(material_id),
-            'models': self._get_models(material_id)
-        }
+        material_data = self._load_documents([material_id])[material_id]
         
         # Apply overrides if requested
         if apply_overrides:
+            self._apply_overrides({material_id: material_data})
+        
+        return material_data
+    
+    def get_materials_by_ids(self, material_ids: List[int], 
+                             apply_overrides: bool = True) -> Dict[int, Dict[str, Any]]:
+        """
+        Retrieve complete data of many materials (e.g. for batch exports).
+        
+        Cached documents are read in one query and overrides of all the
+        materials are resolved in one more.
+        
+        Args:
+            material_ids: Material IDs
+            apply_overrides: Whether to apply stored overrides
+        
+        Returns:
+            {material_id: material data} for the requested IDs
+        """
+        materials = self._load_documents(material_ids)
+        if apply_overrides:
+            self._apply_overrides(materials)
+        return materials
+    
+    def get_materials_by_names(self, names: List[str],
+                               apply_overrides: bool = True) -> Dict[str, Dict[str, Any]]:
+        """
+        Retrieve complete data of many materials by name.
+        
+        IDs are looked up in one query, then loaded as get_materials_by_ids().
+        
+        Args:
+            names: Material names
+            apply_overrides: Whether to apply stored overrides
+        
+        Returns:
+            {name: material data} for materials that exist
+        """
+        cursor = self.conn.cursor()
+        cursor.execute("SELECT name, material_id FROM materials WHERE name = ANY(%s)", (list(names),))
+        ids = dict(cursor.fetchall())
+        cursor.close()
+        
+        materials = self.get_materials_by_ids(list(ids.values()), apply_overrides) if ids else {}
+        return {name: materials[material_id] for name, material_id in ids.items()}
+    
+    def _apply_overrides(self, materials: Dict[int, Dict[str, Any]]):
+        """Apply stored overrides to assembled materials (in place)."""
+        if self.resolution.available:
+            # Resolved in SQL; only overridden paths are returned
+            rows = self.resolution.effective_values(list(materials), changed_only=True)
+            for material_id, material_rows in groupby(rows, key=lambda row: row['material_id']):
+                apply_effective_values(materials[material_id], list(material_rows))
+            return
+        
+        # Fallback until property paths are installed and backfilled
+        for material_id in materials:
             # Load stored overrides from database
             stored_overrides = self.override_storage.load_overrides(material_id)
             
@@ -87,42 +155,155 @@ class MaterialQuerier:
                 )
             
             # Apply all overrides to material data
-            material_data = self.override_manager.apply_overrides(material_id, material_data)
+            materials[material_id] = self.override_manager.apply_overrides(
+                material_id, materials[material_id]
+            )
+    
+    def _assemble_material(self, material_id: int) -> Dict[str, Any]:
+        """Build material data from the normalized tables."""
+        return {
+            'metadata': self._get_metadata(material_id),
+            'properties': self._get_properties(material_id),
+            'models': self._get_models(material_id)
+        }
+    
+    def _load_documents(self, material_ids: List[int]) -> Dict[int, Dict[str, Any]]:
+        """
+        Material data (without overrides), from the document cache when current.
         
-        return material_data
+        Missing or outdated documents are rebuilt from the normalized tables
+        and saved for the next load. The save is committed only when no
+        transaction was open before this read; inside a caller's transaction
+        it is left to the caller's commit (or rollback).
+        """
+        if not self.documents.available:
+            return {material_id: self._assemble_material(material_id) for material_id in material_ids}
+        
+        owns_transaction = self.conn.get_transaction_status() == TRANSACTION_STATUS_IDLE
+        cached = self.documents.load_many(material_ids)
+        materials = {}
+        rebuilt = {}
+        for material_id in material_ids:
+            document, version = cached.get(material_id, (None, 0))
+            if document is None:
+                document = self._assemble_material(material_id)
+                if document['metadata']:
+                    rebuilt[material_id] = (document, version)
+            materials[material_id] = document
+        if rebuilt:
+            self._store_documents(rebuilt, owns_transaction)
+        return materials
+    
+    def _store_documents(self, rebuilt: Dict[int, Any], commit: bool):
+        """Save rebuilt documents in a savepoint; a failed save never fails the read."""
+        with self.conn.cursor() as cur:
+            cur.execute("SAVEPOINT store_documents")
+            try:
+                for material_id, (document, version) in rebuilt.items():
+                    self.documents.store(material_id, document, version)
+                cur.execute("RELEASE SAVEPOINT store_documents")
+            except Exception as e:
+                cur.execute("ROLLBACK TO SAVEPOINT store_documents")
+                print(f"⚠ Could not cache material documents: {e}")
+        if commit:
+            self.conn.commit()
+    
+    def refresh_document(self, material_id: int):
+        """
+        Rebuild the cached document of a material without committing.
+        
+        Inserters call this inside their transaction, so the rows and the
+        document are committed together.
+        
+        Args:
+            material_id: Material ID
+        """
+        if self.documents.available:
+            _, version = self.documents.load(material_id)
+            self.documents.store(material_id, self._assemble_material(material_id), version)
     
     def list_materials(self) -> List[Dict[str, Any]]:
         """
         Get list of all materials.
         
+        Loads the whole table; use iter_materials() or list_materials_page()
+        for large catalogues.
+        
         Returns:
             List of material summaries
         """
-        cursor = self.conn.cursor()
+        return list(self.iter_materials())
+    
+    def iter_materials(self) -> Iterator[Dict[str, Any]]:
+        """
+        Stream all material summaries in name order (server-side cursor).
         
-        sql = """
-            SELECT material_id, xml_id, name, author, date, version, created_at
+        Yields:
+            Material summary dictionaries
+        """
+        sql = f"""
+            SELECT {', '.join(MATERIAL_FIELDS)}
             FROM materials
-            ORDER BY name
+            ORDER BY name, material_id
         """
+        for row in stream_query(self.conn, sql):
+            yield dict(zip(MATERIAL_FIELDS, row))
+    
+    def list_materials_page(self, limit: int = 100, after: Optional[Dict[str, Any]] = None) -> List[Dict[str, Any]]:
+        """
+        Get one page of material summaries in name order (keyset pagination).
         
-        cursor.execute(sql)
-        results = cursor.fetchall()
+        Args:
+            limit: Page size
+            after: Last material of the previous page (first page if None)
+        
+        Returns:
+            Up to `limit` material summaries
+        """
+        cursor = self.conn.cursor()
+        
+        if after is None:
+            cursor.execute(f"""
+                SELECT {', '.join(MATERIAL_FIELDS)}
+                FROM materials
+                ORDER BY name, material_id
+                LIMIT %s
+            """, (limit,))
+        else:
+            cursor.execute(f"""
+                SELECT {', '.join(MATERIAL_FIELDS)}
+                FROM materials
+                WHERE (name, material_id) > (%s, %s)
+                ORDER BY name, material_id
+                LIMIT %s
+            """, (after['name'], after['material_id'], limit))
+        rows = cursor.fetchall()
         cursor.close()
         
-        materials = []
-        for row in results:
-            materials.append({
-                'material_id': row[0],
-                'xml_id': row[1],
-                'name': row[2],
-                'author': row[3],
-                'date': row[4],
-                'version': row[5],
-                'created_at': row[6]
-            })
+        return [dict(zip(MATERIAL_FIELDS, row)) for row in rows]
+    
+    def count_materials(self) -> int:
+        """Number of materials in the database."""
+        cursor = self.conn.cursor()
+        cursor.execute("SELECT COUNT(*) FROM materials")
+        count = cursor.fetchone()[0]
+        cursor.close()
+        return count
+    
+    def query_path(self, path_query: str, materials: Optional[List[str]] = None) -> List[Dict[str, Any]]:
+        """
+        Stored values addressed by a path query, in one indexed query.
         
-        return materials
+        Stored values are returned as imported (overrides are not applied).
+        
+        Args:
+            path_query: Path query, e.g. "EOSModel.Row[*].K0" (see db.property_path_storage)
+            materials: Material names to search (all materials if None)
+        
+        Returns:
+            List of {'material', 'path', 'value', 'unit', 'ref', 'index'}
+        """
+        return self.paths.query(path_query, materials)
     
     def get_material_id(self, name: str) -> Optional[int]:
         """
@@ -140,7 +321,92 @@ class MaterialQuerier:
         result = cursor.fetchone()
         cursor.close()
         return result[0] if result else None
-    
+
+    def get_materials_batch(self, names: List[str]) -> Dict[str, Dict[str, Any]]:
+        """
+        Retrieve property data, ElasticModel and EOS row parameters for many
+        materials with a single query.
+
+        Intended for physics code that needs a few parameters of many
+        materials at once. Stored values are returned as imported (overrides
+        are not applied) and nested EOS parameters (unreacted/reacted) are
+        not included.
+
+        Args:
+            names: Material names
+
+        Returns:
+            {name: {'metadata', 'properties', 'models'}} in the same layout as
+            get_material_by_name(), for materials that exist
+        """
+        cursor = self.conn.cursor()
+
+        sql = """
+            SELECT m.name, 'property', pc.category_type, NULL, p.property_name,
+                   p.unit, pe.value, pe.ref_id, pe.entry_index, NULL
+            FROM materials m
+            JOIN property_categories pc ON pc.material_id = m.material_id
+            JOIN properties p ON p.category_id = pc.category_id
+            JOIN property_entries pe ON pe.property_id = p.property_id
+            WHERE m.name = ANY(%s)
+            UNION ALL
+            SELECT m.name, 'model', mo.model_type, sm.sub_model_type, mp.param_name,
+                   mp.unit, mp.value, mp.ref_id, mp.entry_index, sm.row_index
+            FROM materials m
+            JOIN models mo ON mo.material_id = m.material_id
+            JOIN sub_models sm ON sm.model_id = mo.model_id
+            JOIN model_parameters mp ON mp.sub_model_id = sm.sub_model_id
+            WHERE m.name = ANY(%s)
+              AND mo.model_type IN ('ElasticModel', 'EOSModel')
+              AND sm.parent_sub_model_id IS NULL
+        """
+
+        cursor.execute(sql, (list(names), list(names)))
+        rows = cursor.fetchall()
+        cursor.close()
+
+        materials = {}
+        eos_rows = {}
+
+        for name, kind, section, sub_section, param, unit, value, ref_id, entry_index, row_index in rows:
+            material = materials.setdefault(name, {
+                'metadata': {'name': name},
+                'properties': {},
+                'models': {}
+            })
+
+            if kind == 'property':
+                prop = material['properties'].setdefault(section, {}).setdefault(
+                    param, {'unit': unit, 'entries': []}
+                )
+                prop['entries'].append({'value': value, 'ref': ref_id, 'index': entry_index})
+            elif sub_section == 'Row':
+                row = eos_rows.setdefault(name, {}).setdefault(row_index, {})
+                row.setdefault(param, []).append(
+                    {'value': value, 'unit': unit, 'ref': ref_id, 'index': entry_index}
+                )
+            else:
+                sub_model = material['models'].setdefault(section, {}).setdefault(sub_section, {})
+                sub_model.setdefault(param, []).append(
+                    {'value': value, 'unit': unit, 'ref': ref_id, 'index': entry_index}
+                )
+
+        # EOS rows use the same single-entry flattening as _get_eos_model()
+        for name, rows_dict in eos_rows.items():
+            materials[name]['models'].setdefault('EOSModel', {})['rows'] = [
+                {
+                    'index': str(row_index) if row_index else None,
+                    'parameters': {
+                        param: entries[0] if len(entries) == 1 else sorted(
+                            entries, key=lambda e: e['index'] or 0)
+                        for param, entries in rows_dict[row_index].items()
+                    }
+                }
+                for row_index in sorted(rows_dict, key=lambda i: i or 0)
+            ]
+
+        return materials
+
     def _get_metadata(self, material_id: int) -> Dict[str, Any]:
         """Retrieve material metadata."""
         cursor = self.conn.cursor()
@@ -610,9 +876,34 @@ if __name__ == "__main__":
     db.close()
 
 
+REFERENCE_FIELDS = ['reference_id', 'ref_type', 'author', 'title', 'journal', 'year', 'volume', 'pages']
+
+HEADLINE_OPTIONS = 'StartSel=<b>, StopSel=</b>, HighlightAll=true'
+
+
+def prefix_tsquery(search_text: str) -> Optional[str]:
+    """
+    Build a to_tsquery() string matching every word as a prefix.
+    
+    Example:
+        >>> prefix_tsquery("Marsh shock-wave")
+        'marsh:* & shock:* & wave:*'
+    
+    Returns:
+        Query string, or None when the text has no searchable words
+    """
+    words = re.findall(r'[^\W_]+', search_text.lower())
+    if not words:
+        return None
+    return ' & '.join(f"{word}:*" for word in words)
+
+
 class ReferenceQuerier:
     """Handles querying of reference data from database."""
     
+    # Connections whose search column and index have been checked
+    _search_checked = weakref.WeakSet()
+    
     def __init__(self, db_manager: DatabaseManager):
         """
         Initialize querier with database manager.
@@ -622,6 +913,35 @@ class ReferenceQuerier:
         """
         self.db = db_manager
         self.conn = db_manager.connect()
+        self._ensure_search_vector()
+        self.reference_keys = ReferenceKeyStorage(self.conn)
+    
+    def _ensure_search_vector(self):
+        """
+        Add the full-text search column and index to existing databases.
+        
+        Checked once per connection; the DDL (ALTER TABLE takes an exclusive
+        lock even when the column exists) only runs when something is missing.
+        """
+        if self.conn in ReferenceQuerier._search_checked:
+            return
+        with self.conn.cursor() as cur:
+            try:
+                cur.execute("""
+                    SELECT EXISTS (SELECT 1 FROM information_schema.columns
+                                   WHERE table_name = 'references'
+                                     AND column_name = 'search_vector')
+                       AND to_regclass('idx_references_search') IS NOT NULL AS present
+                """)
+                row = cur.fetchone()
+                if not (row['present'] if isinstance(row, dict) else row[0]):
+                    cur.execute(get_references_search_sql())
+                self.conn.commit()
+            except Exception as e:
+                self.conn.rollback()
+                print(f"⚠ Reference full-text search unavailable: {e}")
+                return
+        ReferenceQuerier._search_checked.add(self.conn)
     
     def get_reference_by_id(self, reference_id: int) -> Optional[Dict[str, Any]]:
         """
@@ -663,35 +983,124 @@ class ReferenceQuerier:
         """
         Get list of all references.
         
+        Loads the whole table; use iter_references() or search_references()
+        (which pages by ID when no search text is given) for large tables.
+        
         Returns:
             List of reference dictionaries
         """
-        cursor = self.conn.cursor()
+        return list(self.iter_references())
+    
+    def iter_references(self) -> Iterator[Dict[str, Any]]:
+        """
+        Stream all references in ID order (server-side cursor).
         
-        sql = """
-            SELECT reference_id, ref_type, author, title, journal, year, volume, pages
+        Yields:
+            Reference dictionaries
+        """
+        sql = f"""
+            SELECT {', '.join(REFERENCE_FIELDS)}
             FROM "references"
             ORDER BY reference_id
         """
+        for row in stream_query(self.conn, sql):
+            yield dict(zip(REFERENCE_FIELDS, row))
+    
+    def search_references(self, search_text: str = "", ref_type: Optional[str] = None,
+                          limit: int = 100, after: Optional[Dict[str, Any]] = None) -> List[Dict[str, Any]]:
+        """
+        Ranked full-text search over title, author, journal and year.
+        
+        Every word must match (as a prefix, so partially typed words match).
+        Matches in the title rank above author, journal and year matches.
+        Pages are fetched with keyset pagination: pass the last row of the
+        previous page as `after` to get the next one.
+        
+        Args:
+            search_text: Words to search for (empty lists references by ID)
+            ref_type: Only this reference type (all if None)
+            limit: Page size
+            after: Last row of the previous page
+        
+        Returns:
+            List of reference dictionaries with 'rank', plus 'title_headline'
+            and 'author_headline' with matches wrapped in <b></b>
+        """
+        query = prefix_tsquery(search_text)
+        params = {
+            'query': query,
+            'ref_type': ref_type,
+            'limit': limit,
+            'after_rank': after.get('rank') if after else None,
+            'after_id': after.get('reference_id') if after else None,
+        }
+        fields = ', '.join(f"r.{field}" for field in REFERENCE_FIELDS)
+        
+        if query is None:
+            sql = f"""
+                SELECT {fields}, NULL::real AS rank,
+                       r.title AS title_headline, r.author AS author_headline
+                FROM "references" r
+                WHERE (%(ref_type)s::text IS NULL OR r.ref_type = %(ref_type)s)
+                  AND (%(after_id)s::integer IS NULL OR r.reference_id > %(after_id)s)
+                ORDER BY r.reference_id
+                LIMIT %(limit)s
+            """
+        else:
+            sql = f"""
+                WITH q AS (
+                    SELECT to_tsquery('simple', %(query)s) AS query
+                ),
+                ranked AS (
+                    SELECT {fields}, ts_rank(r.search_vector, q.query)::real AS rank
+                    FROM "references" r, q
+                    WHERE r.search_vector @@ q.query
+                      AND (%(ref_type)s::text IS NULL OR r.ref_type = %(ref_type)s)
+                ),
+                page AS (
+                    SELECT * FROM ranked
+                    WHERE %(after_rank)s::real IS NULL
+                       OR rank < %(after_rank)s::real
+                       OR (rank = %(after_rank)s::real AND reference_id > %(after_id)s)
+                    ORDER BY rank DESC, reference_id
+                    LIMIT %(limit)s
+                )
+                SELECT page.*,
+                       ts_headline('simple', COALESCE(page.title, ''), q.query, '{HEADLINE_OPTIONS}') AS title_headline,
+                       ts_headline('simple', COALESCE(page.author, ''), q.query, '{HEADLINE_OPTIONS}') AS author_headline
+                FROM page, q
+                ORDER BY page.rank DESC, page.reference_id
+            """
         
-        cursor.execute(sql)
+        cursor = self.conn.cursor()
+        cursor.execute(sql, params)
         rows = cursor.fetchall()
         cursor.close()
         
-        references = []
-        for row in rows:
-            references.append({
-                'reference_id': row[0],
-                'ref_type': row[1],
-                'author': row[2],
-                'title': row[3],
-                'journal': row[4],
-                'year': row[5],
-                'volume': row[6],
-                'pages': row[7]
-            })
+        columns = REFERENCE_FIELDS + ['rank', 'title_headline', 'author_headline']
+        return [dict(zip(columns, row)) for row in rows]
+    
+    def count_references(self, search_text: str = "", ref_type: Optional[str] = None) -> int:
+        """
+        Number of references matching a search (see search_references).
+        
+        Args:
+            search_text: Words to search for (empty counts all)
+            ref_type: Only this reference type (all if None)
         
-        return references
+        Returns:
+            Number of matching references
+        """
+        cursor = self.conn.cursor()
+        cursor.execute("""
+            SELECT COUNT(*)
+            FROM "references"
+            WHERE (%(query)s::text IS NULL OR search_vector @@ to_tsquery('simple', %(query)s))
+              AND (%(ref_type)s::text IS NULL OR ref_type = %(ref_type)s)
+        """, {'query': prefix_tsquery(search_text), 'ref_type': ref_type})
+        count = cursor.fetchone()[0]
+        cursor.close()
+        return count
     
     def get_references_for_material(self, material_name: str) -> List[int]:
         """
@@ -703,6 +1112,18 @@ class ReferenceQuerier:
         Returns:
             List of unique reference IDs used by this material
         """
+        if self.reference_keys.available:
+            with self.conn.cursor() as cursor:
+                cursor.execute("""
+                    SELECT mr.reference_id
+                    FROM materials m
+                    JOIN material_references mr ON mr.material_id = m.material_id
+                    WHERE m.name = %s
+                    ORDER BY mr.reference_id
+                """, (material_name,))
+                return [row[0] for row in cursor.fetchall()]
+        
+        # Legacy databases (migrate_reference_keys.py not run yet)
         cursor = self.conn.cursor()
         
         # Get material ID
@@ -763,6 +1184,18 @@ class ReferenceQuerier:
         Returns:
             List of material names
         """
+        if self.reference_keys.available:
+            with self.conn.cursor() as cursor:
+                cursor.execute("""
+                    SELECT m.name
+                    FROM material_references mr
+                    JOIN materials m ON m.material_id = mr.material_id
+                    WHERE mr.reference_id = %s
+                    ORDER BY m.name
+                """, (reference_id,))
+                return [row[0] for row in cursor.fetchall()]
+        
+        # Legacy databases (migrate_reference_keys.py not run yet)
         cursor = self.conn.cursor()
         
         # Find materials with this ref in property entries
@@ -796,3 +1229,38 @@ class ReferenceQuerier:
         # Combine and deduplicate
         all_materials = sorted(set(materials_from_props + materials_from_models))
         return all_materials
+    
+    def validate_references(self) -> Dict[str, Any]:
+        """
+        Check reference integrity across all materials.
+        
+        Returns:
+            Dictionary with:
+            - missing: [(material name, reference ID)] cited but not in the database
+            - unused: [reference ID] not cited by any material
+            - reference_count, material_count: totals
+        """
+        if self.reference_keys.available:
+            return self.reference_keys.validation_report()
+        
+        # Legacy databases (migrate_reference_keys.py not run yet): per-material lookups
+        with self.conn.cursor() as cursor:
+            cursor.execute("SELECT name FROM materials ORDER BY name")
+            materials = [row[0] for row in cursor.fetchall()]
+        ref_ids_in_db = {ref['reference_id'] for ref in self.iter_references()}
+        
+        missing = []
+        used = set()
+        for material_name in materials:
+            for ref_id in self.get_references_for_material(material_name):
+                if ref_id in ref_ids_in_db:
+                    used.add(ref_id)
+                else:
+                    missing.append((material_name, ref_id))
+        
+        return {
+            'missing': missing,
+            'unused': sorted(ref_ids_in_db - used),
+            'reference_count': len(ref_ids_in_db),
+            'material_count': len(materials),
+        }
@@ -0,0 +1,426 @@
+"""
+Reference Key Storage for Material Database Engine.
+Typed reference keys and the material <-> reference bridge table.
+
+property_entries.ref_id and model_parameters.ref_id hold the raw ref="..."
+attribute (numeric IDs, USER_OVERRIDE, free text). This module adds:
+
+- an INTEGER reference_id column on both tables with a real foreign key to
+  "references", set by a trigger from ref_id when it names an existing
+  reference (NULL otherwise, and filled in when the reference is imported
+  later);
+- material_references, one row per (material, numeric ref ID) maintained by
+  statement-level triggers. It keeps IDs that have no reference row, so
+  dangling citations can be reported;
+- composite indexes for material -> references and reference -> materials.
+
+Existing databases are converted by migrate() in short batches (one commit
+per batch), with indexes built CONCURRENTLY and the foreign keys validated
+last, so the tables stay usable while it runs. Lookups use the bridge table
+only once reference_key_migrations records the finished backfill; until
+then they keep querying the citing tables directly.
+"""
+from typing import Callable, Dict, List, Optional
+
+
+# ref_id text -> INTEGER, NULL for non-numeric refs (never raises)
+def numeric_ref(column: str) -> str:
+    return f"(CASE WHEN {column} ~ '^[0-9]{{1,9}}$' THEN {column}::integer END)"
+
+
+# Tables citing references: (table, key column, material join from alias e)
+CITING_TABLES = {
+    'property_entries': (
+        'entry_id',
+        "JOIN properties p ON p.property_id = e.property_id "
+        "JOIN property_categories pc ON pc.category_id = p.category_id",
+        'pc.material_id',
+    ),
+    'model_parameters': (
+        'param_id',
+        "JOIN sub_models sm ON sm.sub_model_id = e.sub_model_id "
+        "JOIN models m ON m.model_id = sm.model_id",
+        'm.material_id',
+    ),
+}
+
+# Composite indexes: (name, table, columns)
+INDEXES = (
+    ('idx_property_entries_reference', 'property_entries', 'reference_id, property_id'),
+    ('idx_property_entries_property_reference', 'property_entries', 'property_id, reference_id'),
+    ('idx_model_parameters_reference', 'model_parameters', 'reference_id, sub_model_id'),
+    ('idx_model_parameters_sub_model_reference', 'model_parameters', 'sub_model_id, reference_id'),
+    ('idx_material_references_reference', 'material_references', 'reference_id, material_id'),
+)
+
+BATCH_SIZE = 5000
+
+
+def get_columns_sql() -> str:
+    """reference_id columns with NOT VALID foreign keys (no table scan)."""
+    sql = []
+    for table in CITING_TABLES:
+        sql.append(f"""
+        ALTER TABLE {table} ADD COLUMN IF NOT EXISTS reference_id INTEGER;
+        DO $$
+        BEGIN
+            IF NOT EXISTS (SELECT 1 FROM pg_constraint WHERE conname = 'fk_{table}_reference') THEN
+                ALTER TABLE {table} ADD CONSTRAINT fk_{table}_reference
+                    FOREIGN KEY (reference_id) REFERENCES "references"(reference_id)
+                    ON DELETE SET NULL NOT VALID;
+            END IF;
+        END $$;""")
+    return "\n".join(sql)
+
+
+def get_bridge_table_sql() -> str:
+    """Bridge table (reference_id is not a foreign key: dangling IDs are kept)."""
+    return """
+        CREATE TABLE IF NOT EXISTS material_references (
+            material_id INTEGER NOT NULL REFERENCES materials(material_id) ON DELETE CASCADE,
+            reference_id INTEGER NOT NULL,
+            PRIMARY KEY (material_id, reference_id)
+        );
+    """
+
+
+def get_marker_table_sql() -> str:
+    """Completion marker: one row per finished migration step."""
+    return """
+        CREATE TABLE IF NOT EXISTS reference_key_migrations (
+            step TEXT PRIMARY KEY,
+            completed_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP
+        );
+    """
+
+
+def get_mark_complete_sql(only_if_empty: bool = False) -> str:
+    """Record the finished backfill (for a new database: only when nothing is stored yet)."""
+    condition = """
+        WHERE NOT EXISTS (SELECT 1 FROM property_entries)
+          AND NOT EXISTS (SELECT 1 FROM model_parameters)""" if only_if_empty else ""
+    return f"""
+        INSERT INTO reference_key_migrations (step)
+        SELECT 'backfill'{condition}
+        ON CONFLICT (step) DO NOTHING;
+    """
+
+
+def get_index_sql(concurrently: bool = False) -> List[str]:
+    """One CREATE INDEX statement per index (CONCURRENTLY cannot be batched)."""
+    mode = "CONCURRENTLY " if concurrently else ""
+    return [f"CREATE INDEX {mode}IF NOT EXISTS {name} ON {table}({columns})"
+            for name, table, columns in INDEXES]
+
+
+def _bridge_select(table: str, source: str, material_filter: str = "") -> str:
+    """(material_id, reference_id) pairs cited by rows of `source` aliased e."""
+    _, join, material = CITING_TABLES[table]
+    return f"""
+            SELECT DISTINCT {material}, {numeric_ref('e.ref_id')}
+            FROM {source} e
+            {join}
+            WHERE {numeric_ref('e.ref_id')} IS NOT NULL {material_filter}"""
+
+
+def get_functions_sql() -> str:
+    """Trigger functions keeping reference_id and material_references current."""
+    functions = [f"""
+        CREATE OR REPLACE FUNCTION set_reference_id()
+        RETURNS TRIGGER AS $$
+        BEGIN
+            NEW.reference_id := (SELECT r.reference_id FROM "references" r
+                                 WHERE r.reference_id = {numeric_ref('NEW.ref_id')});
+            RETURN NEW;
+        END;
+        $$ LANGUAGE plpgsql;
+
+        CREATE OR REPLACE FUNCTION references_link_citations()
+        RETURNS TRIGGER AS $$
+        BEGIN
+            UPDATE property_entries e SET reference_id = n.reference_id
+            FROM new_references n
+            WHERE e.ref_id = n.reference_id::text AND e.reference_id IS NULL;
+            UPDATE model_parameters e SET reference_id = n.reference_id
+            FROM new_references n
+            WHERE e.ref_id = n.reference_id::text AND e.reference_id IS NULL;
+            RETURN NULL;
+        END;
+        $$ LANGUAGE plpgsql;
+
+        CREATE OR REPLACE FUNCTION material_references_refresh(ids INTEGER[])
+        RETURNS VOID AS $$
+        BEGIN
+            DELETE FROM material_references WHERE material_id = ANY(ids);
+            -- Skip materials being deleted (cascades reach here mid-delete)
+            ids := ARRAY(SELECT material_id FROM materials WHERE material_id = ANY(ids));
+            INSERT INTO material_references (material_id, reference_id)
+            {_bridge_select('property_entries', 'property_entries', 'AND pc.material_id = ANY(ids)')}
+            UNION
+            {_bridge_select('model_parameters', 'model_parameters', 'AND m.material_id = ANY(ids)')}
+            ON CONFLICT DO NOTHING;
+        END;
+        $$ LANGUAGE plpgsql;"""]
+
+    for table, (key, join, material) in CITING_TABLES.items():
+        functions.append(f"""
+        CREATE OR REPLACE FUNCTION {table}_references_on_insert()
+        RETURNS TRIGGER AS $$
+        BEGIN
+            INSERT INTO material_references (material_id, reference_id)
+            {_bridge_select(table, 'new_rows')}
+            ON CONFLICT DO NOTHING;
+            RETURN NULL;
+        END;
+        $$ LANGUAGE plpgsql;
+
+        CREATE OR REPLACE FUNCTION {table}_references_on_update()
+        RETURNS TRIGGER AS $$
+        BEGIN
+            -- Only rows whose ref attribute changed (not reference_id backfills)
+            PERFORM material_references_refresh(ARRAY(
+                SELECT DISTINCT {material}
+                FROM old_rows e
+                JOIN new_rows n ON n.{key} = e.{key}
+                {join}
+                WHERE n.ref_id IS DISTINCT FROM e.ref_id
+            ));
+            RETURN NULL;
+        END;
+        $$ LANGUAGE plpgsql;
+
+        CREATE OR REPLACE FUNCTION {table}_references_on_delete()
+        RETURNS TRIGGER AS $$
+        BEGIN
+            -- Rebuild the affected materials only
+            PERFORM material_references_refresh(ARRAY(
+                SELECT DISTINCT {material} FROM old_rows e {join}
+            ));
+            RETURN NULL;
+        END;
+        $$ LANGUAGE plpgsql;""")
+    return "\n".join(functions)
+
+
+def get_triggers_sql() -> str:
+    """Row trigger for reference_id, statement triggers for the bridge table."""
+    sql = ["""
+        DROP TRIGGER IF EXISTS references_link_citations ON "references";
+        CREATE TRIGGER references_link_citations
+            AFTER INSERT ON "references"
+            REFERENCING NEW TABLE AS new_references
+            FOR EACH STATEMENT
+            EXECUTE PROCEDURE references_link_citations();"""]
+    for table in CITING_TABLES:
+        sql.append(f"""
+        DROP TRIGGER IF EXISTS {table}_reference_id ON {table};
+        CREATE TRIGGER {table}_reference_id
+            BEFORE INSERT OR UPDATE OF ref_id ON {table}
+            FOR EACH ROW
+            EXECUTE PROCEDURE set_reference_id();
+
+        DROP TRIGGER IF EXISTS {table}_references_insert ON {table};
+        CREATE TRIGGER {table}_references_insert
+            AFTER INSERT ON {table}
+            REFERENCING NEW TABLE AS new_rows
+            FOR EACH STATEMENT
+            EXECUTE PROCEDURE {table}_references_on_insert();
+
+        DROP TRIGGER IF EXISTS {table}_references_update ON {table};
+        CREATE TRIGGER {table}_references_update
+            AFTER UPDATE ON {table}
+            REFERENCING OLD TABLE AS old_rows NEW TABLE AS new_rows
+            FOR EACH STATEMENT
+            EXECUTE PROCEDURE {table}_references_on_update();
+
+        DROP TRIGGER IF EXISTS {table}_references_delete ON {table};
+        CREATE TRIGGER {table}_references_delete
+            AFTER DELETE ON {table}
+            REFERENCING OLD TABLE AS old_rows
+            FOR EACH STATEMENT
+            EXECUTE PROCEDURE {table}_references_on_delete();""")
+    return "\n".join(sql)
+
+
+def get_create_sql() -> str:
+    """Everything for a new (empty) database."""
+    return "\n".join([get_columns_sql(), get_bridge_table_sql(),
+                      ";\n".join(get_index_sql()) + ";",
+                      get_functions_sql(), get_triggers_sql(),
+                      get_marker_table_sql(), get_mark_complete_sql(only_if_empty=True)])
+
+
+def run_in_batches(conn, statement: str, max_key_sql: str, batch_size: int,
+                   report: Callable[[int, int], None]):
+    """
+    Run a statement over consecutive key ranges, committing each.
+
+    Args:
+        conn: psycopg2 connection
+        statement: SQL using %(start)s and %(stop)s (start < key <= stop)
+        max_key_sql: Query returning the largest key
+        batch_size: Keys per batch
+        report: Callback(done, total) after each batch
+    """
+    with conn.cursor() as cur:
+        cur.execute(max_key_sql)
+        row = cur.fetchone()
+        max_key = list(row.values())[0] if isinstance(row, dict) else row[0]
+    conn.commit()
+
+    start = 0
+    while start < max_key:
+        stop = start + batch_size
+        with conn.cursor() as cur:
+            try:
+                cur.execute(statement, {'start': start, 'stop': stop})
+                conn.commit()
+            except Exception:
+                conn.rollback()
+                raise
+        start = stop
+        report(min(start, max_key), max_key)
+
+
+class ReferenceKeyStorage:
+    """
+    Manages reference_id columns, the material_references bridge table and
+    their triggers. Does NOT change ref_id values.
+    """
+
+    def __init__(self, connection):
+        """
+        Initialize reference key storage.
+
+        Args:
+            connection: psycopg2 connection object
+        """
+        self.conn = connection
+        self.available = self._installed()
+
+    def _installed(self) -> bool:
+        """
+        True once the bridge table is complete: migrate() has finished its
+        backfill, or the schema was created on an empty database. A bridge
+        table still being filled (or left half-filled) does not count.
+        """
+        with self.conn.cursor() as cur:
+            cur.execute("SELECT to_regclass('reference_key_migrations') IS NOT NULL AS present")
+            row = cur.fetchone()
+            present = row['present'] if isinstance(row, dict) else row[0]
+            if present:
+                cur.execute("""
+                    SELECT EXISTS (SELECT 1 FROM reference_key_migrations
+                                   WHERE step = 'backfill') AS complete
+                """)
+                row = cur.fetchone()
+                present = row['complete'] if isinstance(row, dict) else row[0]
+        self.conn.commit()
+        return bool(present)
+
+    def migrate(self, batch_size: int = BATCH_SIZE,
+                progress: Optional[Callable[[str, int, int], None]] = None):
+        """
+        Convert an existing database (safe to re-run).
+
+        Steps, each committed separately:
+        1. Columns, NOT VALID foreign keys, bridge table, triggers
+           (from here on new rows are kept up to date)
+        2. Backfill reference_id in primary-key batches
+        3. Backfill material_references in material batches, then record
+           completion (lookups switch to the bridge table)
+        4. Build indexes CONCURRENTLY
+        5. Validate the foreign keys
+
+        Args:
+            batch_size: Rows (or materials) per committed batch
+            progress: Optional callback(step, done, total)
+        """
+        report = progress or (lambda step, done, total: None)
+
+        self._run(get_columns_sql(), get_bridge_table_sql(), get_functions_sql(), get_triggers_sql(),
+                  get_marker_table_sql())
+        report('schema', 1, 1)
+
+        for table, (key, _, _) in CITING_TABLES.items():
+            run_in_batches(self.conn, f"""
+                UPDATE {table} t SET reference_id = r.reference_id
+                FROM "references" r
+                WHERE t.{key} > %(start)s AND t.{key} <= %(stop)s
+                  AND r.reference_id = {numeric_ref('t.ref_id')}
+                  AND t.reference_id IS DISTINCT FROM r.reference_id
+            """, f"SELECT COALESCE(MAX({key}), 0) FROM {table}", batch_size,
+                lambda done, total, table=table: report(table, done, total))
+
+        run_in_batches(self.conn, """
+            SELECT material_references_refresh(ARRAY(
+                SELECT material_id FROM materials
+                WHERE material_id > %(start)s AND material_id <= %(stop)s
+            ))
+        """, "SELECT COALESCE(MAX(material_id), 0) FROM materials", batch_size,
+            lambda done, total: report('material_references', done, total))
+
+        # Lookups switch to the bridge table from here on
+        self._run(get_mark_complete_sql())
+        self.available = True
+
+        autocommit = self.conn.autocommit
+        self.conn.autocommit = True
+        try:
+            with self.conn.cursor() as cur:
+                for statement in get_index_sql(concurrently=True):
+                    cur.execute(statement)
+        finally:
+            self.conn.autocommit = autocommit
+        report('indexes', 1, 1)
+
+        self._run(*[f"ALTER TABLE {table} VALIDATE CONSTRAINT fk_{table}_reference"
+                    for table in CITING_TABLES])
+        report('validate', 1, 1)
+
+    def _run(self, *statements: str):
+        with self.conn.cursor() as cur:
+            try:
+                for statement in statements:
+                    cur.execute(statement)
+                self.conn.commit()
+            except Exception:
+                self.conn.rollback()
+                raise
+
+    def validation_report(self) -> Dict[str, List]:
+        """
+        Reference integrity in one query.
+
+        Returns:
+            Dictionary with:
+            - missing: [(material name, reference ID)] cited but not in "references"
+            - unused: [reference ID] not cited by any material
+            - reference_count, material_count: totals
+        """
+        with self.conn.cursor() as cur:
+            cur.execute("""
+                SELECT json_build_object(
+                    'missing', (
+                        SELECT COALESCE(json_agg(json_build_array(m.name, mr.reference_id)
+                                                 ORDER BY m.name, mr.reference_id), '[]')
+                        FROM material_references mr
+                        JOIN materials m ON m.material_id = mr.material_id
+                        WHERE NOT EXISTS (SELECT 1 FROM "references" r
+                                          WHERE r.reference_id = mr.reference_id)
+                    ),
+                    'unused', (
+                        SELECT COALESCE(json_agg(r.reference_id ORDER BY r.reference_id), '[]')
+                        FROM "references" r
+                        WHERE NOT EXISTS (SELECT 1 FROM material_references mr
+                                          WHERE mr.reference_id = r.reference_id)
+                    ),
+                    'reference_count', (SELECT COUNT(*) FROM "references"),
+                    'material_count', (SELECT COUNT(*) FROM materials)
+                ) AS report
+            """)
+            row = cur.fetchone()
+        self.conn.commit()
+        report = row['report'] if isinstance(row, dict) else row[0]
+        report['missing'] = [tuple(pair) for pair in report['missing']]
+        return report
@@ -2,6 +2,8 @@
 Database schema that mirrors the XML structure exactly.
 Schema is designed to be material-agnostic and preserve all XML hierarchy.
 """
+from db.reference_key_storage import get_create_sql as get_reference_keys_sql
+from db.material_document_storage import get_create_sql as get_material_documents_sql
 
 # SQL schema creation statements
 
@@ -79,7 +81,7 @@ CREATE TABLE IF NOT EXISTS property_entries (
     entry_id SERIAL PRIMARY KEY,
     property_id INTEGER REFERENCES properties(property_id) ON DELETE CASCADE,
     value TEXT,  -- Store as TEXT to preserve '13E9', '0.385', etc.
-    ref_id VARCHAR(50),  -- Reference ID (not enforced as foreign key for flexibility)
+    ref_id VARCHAR(50),  -- Raw ref attribute (numeric ID, USER_OVERRIDE, ...); typed key in reference_id
     entry_index INTEGER  -- For ordered entries
 );
 
@@ -119,7 +121,7 @@ CREATE TABLE IF NOT EXISTS model_parameters (
     param_name VARCHAR(100) NOT NULL,  -- 'Density', 'AmbientTemperature', 'A', 'B', 'n', etc.
     value TEXT,  -- Store as TEXT to preserve scientific notation and allow NULL
     unit VARCHAR(50),
-    ref_id VARCHAR(50),  -- Reference ID (not enforced as foreign key for flexibility)
+    ref_id VARCHAR(50),  -- Raw ref attribute (numeric ID, USER_OVERRIDE, ...); typed key in reference_id
     entry_index INTEGER  -- For multiple entries per parameter
 );
 
@@ -127,6 +129,7 @@ CREATE TABLE IF NOT EXISTS model_parameters (
 -- INDEXES for performance
 -- ============================================================
 CREATE INDEX IF NOT EXISTS idx_materials_xml_id ON materials(xml_id);
+CREATE INDEX IF NOT EXISTS idx_materials_name ON materials(name, material_id);  -- Keyset pagination
 CREATE INDEX IF NOT EXISTS idx_property_categories_material ON property_categories(material_id);
 CREATE INDEX IF NOT EXISTS idx_properties_category ON properties(category_id);
 CREATE INDEX IF NOT EXISTS idx_property_entries_property ON property_entries(property_id);
@@ -137,8 +140,29 @@ CREATE INDEX IF NOT EXISTS idx_property_entries_ref ON property_entries(ref_id);
 CREATE INDEX IF NOT EXISTS idx_model_parameters_ref ON model_parameters(ref_id);
 """
 
+REFERENCES_SEARCH_SQL = """
+-- ============================================================
+-- REFERENCES FULL-TEXT SEARCH
+-- Generated tsvector (kept current by PostgreSQL on every write)
+-- Weights: title A, author B, journal C, year D
+-- 'simple' config: author names and journal titles are not stemmed
+-- ============================================================
+ALTER TABLE "references" ADD COLUMN IF NOT EXISTS search_vector tsvector
+    GENERATED ALWAYS AS (
+        setweight(to_tsvector('simple', COALESCE(title, '')), 'A') ||
+        setweight(to_tsvector('simple', COALESCE(author, '')), 'B') ||
+        setweight(to_tsvector('simple', COALESCE(journal, '')), 'C') ||
+        setweight(to_tsvector('simple', COALESCE(year, '')), 'D')
+    ) STORED;
+
+CREATE INDEX IF NOT EXISTS idx_references_search ON "references" USING GIN (search_vector);
+"""
+
 DROP_SCHEMA_SQL = """
 -- Drop all tables in reverse order of dependencies
+DROP TABLE IF EXISTS material_documents CASCADE;
+DROP TABLE IF EXISTS material_references CASCADE;
+DROP TABLE IF EXISTS reference_key_migrations CASCADE;
 DROP TABLE IF EXISTS model_parameters CASCADE;
 DROP TABLE IF EXISTS sub_models CASCADE;
 DROP TABLE IF EXISTS models CASCADE;
@@ -152,7 +176,13 @@ DROP TABLE IF EXISTS "references" CASCADE;
 
 def get_create_schema_sql():
     """Return SQL statements to create the database schema."""
-    return SCHEMA_SQL
+    return (SCHEMA_SQL + REFERENCES_SEARCH_SQL + get_reference_keys_sql()
+            + get_material_documents_sql())
+
+
+def get_references_search_sql():
+    """Return SQL adding the references full-text search column and index (idempotent)."""
+    return REFERENCES_SEARCH_SQL
 
 
 def get_drop_schema_sql():
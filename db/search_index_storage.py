@@ -0,0 +1,199 @@
+"""
+Search Index Storage for Material Database Engine.
+Trigram (pg_trgm) indexes and ranked fuzzy search over materials and properties.
+
+Each searchable table gets a GIN trigram index on a search document that
+concatenates the fields a user may type (name, common name / alias, XML ID,
+which also carries formulas such as "PBX-9501" or "Cu"). Both the typo
+tolerant word-similarity operator (<%) and substring ILIKE are answered
+from that index, so a search no longer scans every row. Results are ranked
+by word similarity and returned a page at a time.
+
+When pg_trgm cannot be installed (missing extension or privileges) the
+storage reports available = False and searches fall back to ILIKE.
+"""
+import weakref
+from typing import Any, Dict, List, Optional, Tuple
+
+
+# Search documents. Expressions use only immutable operators so they can be
+# indexed, and are repeated verbatim in queries for the planner to use the index.
+MATERIAL_DOCUMENT = ("COALESCE(name, '') || ' ' || COALESCE(common_name, '') || ' ' || COALESCE(xml_id, '')")
+PARAMETER_DOCUMENT = "COALESCE(parameter_name, '')"
+
+# (table, index name, expression)
+SEARCH_INDEXES = (
+    ('xml_finalized_materials', 'idx_xml_finalized_materials_search_trgm', MATERIAL_DOCUMENT),
+    ('xml_finalized_parameters', 'idx_xml_finalized_parameters_name_trgm', PARAMETER_DOCUMENT),
+)
+
+# Word similarity needed for a fuzzy (non-substring) match, 0..1
+DEFAULT_THRESHOLD = 0.4
+
+
+def escape_like(term: str) -> str:
+    """Escape LIKE wildcards so user input matches literally."""
+    return term.replace('\\', '\\\\').replace('%', '\\%').replace('_', '\\_')
+
+
+def material_search_query(trigram: bool = True) -> str:
+    """
+    Ranked material search.
+
+    Parameters: term, pattern (escaped %term%), limit, offset.
+    """
+    if trigram:
+        match = f"(%(term)s <%% ({MATERIAL_DOCUMENT}) OR ({MATERIAL_DOCUMENT}) ILIKE %(pattern)s)"
+        score = f"word_similarity(%(term)s, {MATERIAL_DOCUMENT})"
+    else:
+        match = f"({MATERIAL_DOCUMENT}) ILIKE %(pattern)s"
+        score = "1.0"
+    return f"""
+        SELECT
+            material_id,
+            xml_id,
+            name,
+            common_name,
+            material_class,
+            status,
+            CASE WHEN ({MATERIAL_DOCUMENT}) ILIKE %(pattern)s THEN 1.0 ELSE {score} END AS score
+        FROM xml_finalized_materials
+        WHERE {match}
+        ORDER BY score DESC, name, material_id
+        LIMIT %(limit)s OFFSET %(offset)s;
+    """
+
+
+def property_search_query(trigram: bool = True, filter_materials: bool = False) -> str:
+    """
+    Ranked property name search (one row per distinct parameter).
+
+    Parameters: term, pattern, limit, offset and material_ids when
+    filter_materials is set.
+    """
+    if trigram:
+        match = f"(%(term)s <%% ({PARAMETER_DOCUMENT}) OR ({PARAMETER_DOCUMENT}) ILIKE %(pattern)s)"
+        score = f"MAX(CASE WHEN ({PARAMETER_DOCUMENT}) ILIKE %(pattern)s THEN 1.0 ELSE word_similarity(%(term)s, {PARAMETER_DOCUMENT}) END)"
+    else:
+        match = f"({PARAMETER_DOCUMENT}) ILIKE %(pattern)s"
+        score = "1.0"
+    materials = "AND material_id = ANY(%(material_ids)s)" if filter_materials else ""
+    return f"""
+        SELECT
+            parameter_name,
+            category_name,
+            category_number,
+            COUNT(DISTINCT material_id) AS material_count,
+            {score} AS score
+        FROM xml_finalized_parameters
+        WHERE {match}
+          AND is_empty_value = FALSE
+          {materials}
+        GROUP BY parameter_name, category_name, category_number
+        ORDER BY score DESC, parameter_name, category_number
+        LIMIT %(limit)s OFFSET %(offset)s;
+    """
+
+
+class SearchIndexStorage:
+    """
+    Manages the pg_trgm extension and the trigram search indexes.
+    Does NOT modify any table rows.
+    """
+
+    # Connections whose extension and indexes have been checked
+    _installed = weakref.WeakSet()
+
+    def __init__(self, connection):
+        """
+        Initialize search index storage.
+
+        Installs pg_trgm and the indexes if needed (checked once per
+        connection; DDL runs only for what is missing).
+
+        Args:
+            connection: psycopg2 connection object
+        """
+        self.conn = connection
+        self.available = self._ensure_indexes()
+
+    def _ensure_indexes(self) -> bool:
+        """Create extension and indexes; False if pg_trgm is unavailable."""
+        if self.conn in SearchIndexStorage._installed:
+            return True
+        with self.conn.cursor() as cur:
+            try:
+                cur.execute("SELECT EXISTS (SELECT 1 FROM pg_extension WHERE extname = 'pg_trgm') AS present")
+                row = cur.fetchone()
+                if not (row['present'] if isinstance(row, dict) else row[0]):
+                    cur.execute("CREATE EXTENSION IF NOT EXISTS pg_trgm")
+                for table, name, expression in SEARCH_INDEXES:
+                    cur.execute("SELECT to_regclass(%s) IS NOT NULL AS has_table, "
+                                "to_regclass(%s) IS NOT NULL AS has_index", (table, name))
+                    row = cur.fetchone()
+                    has_table, has_index = ((row['has_table'], row['has_index'])
+                                            if isinstance(row, dict) else row)
+                    if has_table and not has_index:
+                        cur.execute(f"CREATE INDEX IF NOT EXISTS {name} ON {table} "
+                                    f"USING GIN (({expression}) gin_trgm_ops)")
+                self.conn.commit()
+            except Exception as e:
+                self.conn.rollback()
+                print(f"⚠ Trigram search unavailable, using ILIKE: {e}")
+                return False
+        SearchIndexStorage._installed.add(self.conn)
+        return True
+
+    def _search(self, query: str, term: str, limit: Optional[int], offset: int,
+                threshold: float, extra: Optional[Dict[str, Any]] = None) -> List[Tuple]:
+        params = {'term': term, 'pattern': f"%{escape_like(term)}%",
+                  'limit': limit, 'offset': offset}
+        params.update(extra or {})
+        with self.conn.cursor() as cur:
+            if self.available:
+                # Transaction-local threshold, sent with the query so it also
+                # holds in autocommit mode (one implicit transaction)
+                params['threshold'] = str(threshold)
+                query = ("SELECT set_config('pg_trgm.word_similarity_threshold', %(threshold)s, true);"
+                         + query)
+            cur.execute(query, params)
+            return cur.fetchall()
+
+    def search_materials(self, term: str, limit: Optional[int] = 50, offset: int = 0,
+                         threshold: float = DEFAULT_THRESHOLD) -> List[Tuple]:
+        """
+        Materials matching a term, best matches first.
+
+        Substring matches on name, common name or XML ID rank first; other
+        rows match when their word similarity reaches the threshold.
+
+        Args:
+            term: Search text
+            limit: Page size (None for all matches)
+            offset: Rows to skip
+            threshold: Minimum word similarity for fuzzy matches
+
+        Returns:
+            Rows of (material_id, xml_id, name, common_name, material_class, status, score)
+        """
+        return self._search(material_search_query(self.available), term.strip(), limit, offset, threshold)
+
+    def search_properties(self, term: str, material_ids: Optional[List[int]] = None,
+                          limit: Optional[int] = 50, offset: int = 0,
+                          threshold: float = DEFAULT_THRESHOLD) -> List[Tuple]:
+        """
+        Property names matching a term, best matches first.
+
+        Args:
+            term: Search text
+            material_ids: Only properties of these materials (all if None)
+            limit: Page size (None for all matches)
+            offset: Rows to skip
+            threshold: Minimum word similarity for fuzzy matches
+
+        Returns:
+            Rows of (parameter_name, category_name, category_number, material_count, score)
+        """
+        query = property_search_query(self.available, filter_materials=material_ids is not None)
+        extra = {'material_ids': list(material_ids)} if material_ids is not None else None
+        return self._search(query, term.strip(), limit, offset, threshold, extra)
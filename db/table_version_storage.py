@@ -0,0 +1,100 @@
+"""
+Table Version Storage for Material Database Engine.
+Trigger-maintained change counters for tables read into memory.
+
+Statement-level triggers bump a per-table counter in table_versions on
+every INSERT, UPDATE, DELETE or TRUNCATE, so a cache can tell whether its
+tables changed by reading one small row per table instead of scanning
+or aggregating them.
+"""
+import weakref
+from typing import Sequence
+
+
+# Tables whose changes invalidate the in-memory property catalogue
+CATALOGUE_TABLES = ('xml_finalized_parameters', 'xml_finalized_materials')
+
+
+def get_table_sql() -> str:
+    """SQL for the counter table and the trigger function."""
+    return """
+        CREATE TABLE IF NOT EXISTS table_versions (
+            table_name TEXT PRIMARY KEY,
+            version BIGINT NOT NULL DEFAULT 0
+        );
+
+        CREATE OR REPLACE FUNCTION table_versions_bump() RETURNS trigger AS $$
+        BEGIN
+            INSERT INTO table_versions (table_name, version) VALUES (TG_TABLE_NAME, 1)
+            ON CONFLICT (table_name) DO UPDATE SET version = table_versions.version + 1;
+            RETURN NULL;
+        END
+        $$ LANGUAGE plpgsql;
+    """
+
+
+def get_trigger_sql(table: str) -> str:
+    """SQL (re)creating the statement-level counter trigger of a table."""
+    return f"""
+        DROP TRIGGER IF EXISTS {table}_version ON {table};
+        CREATE TRIGGER {table}_version
+        AFTER INSERT OR UPDATE OR DELETE OR TRUNCATE ON {table}
+        FOR EACH STATEMENT EXECUTE FUNCTION table_versions_bump();
+    """
+
+
+class TableVersionStorage:
+    """
+    Manages the table_versions counters and their triggers.
+    Does NOT modify rows of the tracked tables.
+    """
+
+    # Connections on which everything is known to be installed
+    _installed = weakref.WeakSet()
+
+    def __init__(self, connection, tables: Sequence[str] = CATALOGUE_TABLES):
+        """
+        Initialize table version storage.
+
+        Installs the counter table and triggers only when something is
+        missing (checked once per connection).
+
+        Args:
+            connection: psycopg2 connection object
+            tables: Tables to track
+        """
+        self.conn = connection
+        self.tables = list(tables)
+        self.available = self._ensure_triggers()
+
+    def _ensure_triggers(self) -> bool:
+        """Install what is missing; False if a tracked table is missing or install fails."""
+        if self.conn in TableVersionStorage._installed:
+            return True
+        triggers = [f"{table}_version" for table in self.tables]
+        with self.conn.cursor() as cur:
+            try:
+                cur.execute("""
+                    SELECT (SELECT COUNT(*) FROM unnest(%s::text[]) AS t(name)
+                            WHERE to_regclass(t.name) IS NOT NULL) = %s AS has_tables,
+                           to_regclass('table_versions') IS NOT NULL AS has_versions,
+                           (SELECT COUNT(*) FROM pg_trigger WHERE tgname = ANY(%s)) = %s AS has_triggers
+                """, (self.tables, len(self.tables), triggers, len(triggers)))
+                row = cur.fetchone()
+                has_tables, has_versions, has_triggers = (tuple(row.values()) if isinstance(row, dict)
+                                                          else tuple(row))
+                if not has_tables:
+                    self.conn.commit()
+                    return False
+                if not (has_versions and has_triggers):
+                    cur.execute(get_table_sql())
+                    for table in self.tables:
+                        cur.execute(get_trigger_sql(table))
+                self.conn.commit()
+            except Exception as e:
+                self.conn.rollback()
+                print(f"⚠ Table version counters unavailable: {e}")
+                return False
+
+        TableVersionStorage._installed.add(self.conn)
+        return True
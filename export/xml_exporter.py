@@ -417,7 +417,7 @@ if __name__ == "__main__":
     db.connect()
     
     querier = MaterialQuerier(db)
-    materials = querier.list_materials()
+    materials = querier.list_materials_page(limit=1)
     
     if materials:
         material = materials[0]
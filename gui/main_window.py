@@ -368,9 +368,9 @@ class MainWindow(QMainWindow):
         try:
             print("DEBUG: load_materials() starting...")
             # Get data from Model
-            materials = self.querier.list_materials()
+            # Names only, streamed (no summary dicts for the whole table)
+            materials = [m['name'] for m in self.querier.iter_materials()]
             print(f"DEBUG: Got {len(materials)} materials from database")
-            print(f"DEBUG: Materials: {materials}")
             
             # Update View
             self.material_browser.load_materials(materials)
@@ -565,8 +565,7 @@ class MainWindow(QMainWindow):
             elif tab_name == "overrides":
                 # Export overrides list as XML
                 material_id = self.querier.get_material_id(self.current_material)
-                overrides_list = self.querier.override_storage.list_overrides(material_id)
-                self._export_overrides_xml(overrides_list)
+                self._export_overrides_xml(material_id)
                 return
                 
             else:  # active
@@ -617,9 +616,10 @@ class MainWindow(QMainWindow):
                 f"Failed to export:\n{str(e)}"
             )
     
-    def _export_overrides_xml(self, overrides_list):
+    def _export_overrides_xml(self, material_id):
         """Export overrides to XML file."""
         from PyQt6.QtWidgets import QFileDialog
+        from overrides.override_xml import export_overrides_xml
         
         file_path, _ = QFileDialog.getSaveFileName(
             self,
@@ -632,23 +632,12 @@ class MainWindow(QMainWindow):
             return
         
         try:
-            with open(file_path, 'w', encoding='utf-8') as f:
-                f.write('<?xml version="1.0" encoding="UTF-8"?>\n')
-                f.write(f'<overrides material="{self.current_material}" count="{len(overrides_list)}">\n')
-                
-                for override in overrides_list:
-                    f.write('  <override>\n')
-                    f.write(f'    <property>{override.get("property_path", "")}</property>\n')
-                    f.write(f'    <original_value>{override.get("original_value", "")}</original_value>\n')
-                    f.write(f'    <new_value>{override.get("new_value", "")}</new_value>\n')
-                    if override.get("unit"):
-                        f.write(f'    <unit>{override.get("unit")}</unit>\n')
-                    if override.get("reason"):
-                        f.write(f'    <reason>{override.get("reason")}</reason>\n')
-                    f.write(f'    <timestamp>{override.get("timestamp", "")}</timestamp>\n')
-                    f.write('  </override>\n')
-                
-                f.write('</overrides>\n')
+            export_overrides_xml(
+                self.querier.override_storage,
+                material_id,
+                self.current_material,
+                file_path
+            )
             
             QMessageBox.information(
                 self,
@@ -843,36 +832,16 @@ class MainWindow(QMainWindow):
     def on_validate_references(self):
         """Validate reference integrity."""
         try:
-            # Get all materials
-            materials = self.querier.list_all_materials()
-            
-            # Get all references
-            all_refs = self.ref_querier.list_all_references()
-            ref_ids_in_db = set(ref['reference_id'] for ref in all_refs)
-            
-            # Check each material for invalid references
-            issues = []
-            unused_refs = ref_ids_in_db.copy()
-            
-            for material_name in materials:
-                # Get references used by this material
-                try:
-                    ref_ids = self.ref_querier.get_references_for_material(material_name)
-                    
-                    for ref_id in ref_ids:
-                        # Check if reference exists
-                        if ref_id not in ref_ids_in_db:
-                            issues.append(f"❌ {material_name}: References missing ID {ref_id}")
-                        else:
-                            # Remove from unused set
-                            unused_refs.discard(ref_id)
-                except Exception as e:
-                    issues.append(f"⚠ {material_name}: Error checking references - {e}")
+            # Missing and unused references in a single query
+            result = self.ref_querier.validate_references()
+            issues = [f"❌ {material_name}: References missing ID {ref_id}"
+                      for material_name, ref_id in result['missing']]
+            unused_refs = result['unused']
             
             # Build report
             report = f"""<h3>Reference Validation Report</h3>
-<p><b>Total References:</b> {len(all_refs)}</p>
-<p><b>Materials Checked:</b> {len(materials)}</p>
+<p><b>Total References:</b> {result['reference_count']}</p>
+<p><b>Materials Checked:</b> {result['material_count']}</p>
 <hr>
 """
             
@@ -888,7 +857,7 @@ class MainWindow(QMainWindow):
             
             if unused_refs:
                 report += f"<hr><p><b>⚠ {len(unused_refs)} unused reference(s):</b></p>"
-                report += f"<p>{', '.join(str(r) for r in sorted(list(unused_refs)[:30]))}"
+                report += f"<p>{', '.join(str(r) for r in unused_refs[:30])}"
                 if len(unused_refs) > 30:
                     report += f" ... and {len(unused_refs) - 30} more"
                 report += "</p>"
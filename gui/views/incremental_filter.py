@@ -0,0 +1,80 @@
+"""
+Incremental Filter
+
+Search-as-you-type filtering over a fixed list of strings.
+
+A query matches an item when every whitespace-separated word of the query
+occurs in the item (case-insensitive). Typing more only narrows the result,
+so each keystroke re-checks the previous matches instead of the whole list;
+deleting characters goes back to a remembered earlier result.
+"""
+
+from typing import List, Sequence, Tuple
+
+
+def _words(text: str) -> Tuple[str, ...]:
+    return tuple(text.casefold().split())
+
+
+def _narrows(query: Tuple[str, ...], previous: Tuple[str, ...]) -> bool:
+    """True if every item matching query also matches previous."""
+    return all(any(old in new for new in query) for old in previous)
+
+
+class IncrementalFilter:
+    """
+    Filter a list of strings by a search query.
+
+    Usage:
+        f = IncrementalFilter(names)
+        rows = f.filter("cop")      # Indices of matching names, in list order
+        rows = f.filter("copp")     # Only re-checks the rows found for "cop"
+    """
+
+    HISTORY = 32    # Earlier results kept for backspacing
+
+    def __init__(self, items: Sequence[str] = ()):
+        self.set_items(items)
+
+    def set_items(self, items: Sequence[str]):
+        """Replace the filtered list (forgets earlier results)."""
+        self._haystack = [str(item).casefold() for item in items]
+        self._history: List[Tuple[Tuple[str, ...], List[int]]] = []
+        self.scanned = 0    # Items checked by the last filter() call (diagnostics)
+
+    def __len__(self):
+        return len(self._haystack)
+
+    def filter(self, text: str) -> List[int]:
+        """
+        Indices of matching items, in list order.
+
+        Args:
+            text: Search text (empty matches everything)
+
+        Returns:
+            List of indices into the item list
+        """
+        query = _words(text)
+        if not query:
+            self.scanned = 0
+            return list(range(len(self._haystack)))
+
+        # Drop remembered results this query does not narrow (e.g. after backspace)
+        while self._history and not _narrows(query, self._history[-1][0]):
+            self._history.pop()
+
+        if self._history and self._history[-1][0] == query:
+            self.scanned = 0
+            return list(self._history[-1][1])
+
+        haystack = self._haystack
+        matches = self._history[-1][1] if self._history else range(len(haystack))
+        self.scanned = len(matches)
+        # One pass per word: each pass only checks what the previous kept
+        for word in query:
+            matches = [i for i in matches if word in haystack[i]]
+
+        self._history.append((query, matches))
+        del self._history[:-self.HISTORY]
+        return list(matches)
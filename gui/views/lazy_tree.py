@@ -0,0 +1,237 @@
+"""
+Lazy Tree
+
+Qt-free tree structure behind LazyTreeModel.
+
+Children of a node are described by a list of keys plus a factory, and
+nodes are only created when the view fetches them (in batches, when a node
+is expanded or scrolled to its end). Insertions and removals are reported
+to a listener as row ranges, so a Qt model can forward them as
+beginInsertRows/beginRemoveRows instead of resetting, which keeps
+selection and expansion state intact.
+"""
+
+from typing import Any, Callable, Dict, Iterable, List, Optional, Sequence
+
+
+class LazyNode:
+    """
+    One tree node.
+
+    Args:
+        key: Identifier, unique among siblings
+        text: Display text
+        data: Payload returned for Qt.UserRole
+        loader: loader(node) -> (keys, factory), called on first expand
+        tooltip: Text or callable(node) -> text, evaluated on first hover
+        style: Optional display hints ({'bold': True, 'color': 'gray', ...})
+    """
+
+    __slots__ = ('key', 'text', 'data', 'loader', 'tooltip', 'style',
+                 'parent', 'row', 'children', 'pending', 'factory', '_index')
+
+    def __init__(self, key, text: str, data: Any = None,
+                 loader: Optional[Callable[['LazyNode'], tuple]] = None,
+                 tooltip: Any = None, style: Optional[Dict[str, Any]] = None):
+        self.key = key
+        self.text = text
+        self.data = data
+        self.loader = loader
+        self.tooltip = tooltip
+        self.style = style or {}
+        self.parent: Optional[LazyNode] = None
+        self.row = 0
+        self.children: List[LazyNode] = []
+        self.pending: List[Any] = []      # Keys not yet turned into nodes
+        self.factory: Optional[Callable[[Any], LazyNode]] = None
+        self._index: Dict[Any, LazyNode] = {}
+
+    def has_children(self) -> bool:
+        return bool(self.children or self.pending or self.loader)
+
+    def child(self, key) -> Optional['LazyNode']:
+        return self._index.get(key)
+
+    def tooltip_text(self) -> Optional[str]:
+        if callable(self.tooltip):
+            self.tooltip = self.tooltip(self)
+        return self.tooltip
+
+    def __repr__(self):
+        return f"LazyNode({self.key!r}, {len(self.children)} loaded, {len(self.pending)} pending)"
+
+
+class TreeListener:
+    """Change notifications (LazyTreeModel forwards these to Qt)."""
+
+    def begin_insert(self, parent: LazyNode, first: int, last: int): pass
+    def end_insert(self): pass
+    def begin_remove(self, parent: LazyNode, first: int, last: int): pass
+    def end_remove(self): pass
+    def changed(self, node: LazyNode): pass
+
+
+class LazyTree:
+    """Tree of LazyNodes with batched fetching and incremental updates."""
+
+    BATCH = 256
+
+    def __init__(self, listener: Optional[TreeListener] = None, batch: Optional[int] = None):
+        self.root = LazyNode(None, "")
+        self.listener = listener or TreeListener()
+        self.batch = batch or self.BATCH
+        self.created = 0        # Nodes created by factories (diagnostics)
+
+    # ========== FETCHING ==========
+
+    def can_fetch(self, node: LazyNode) -> bool:
+        return bool(node.pending or node.loader)
+
+    def fetch(self, node: LazyNode, limit: Optional[int] = None) -> int:
+        """
+        Create the next batch of children.
+
+        Returns:
+            Number of children added
+        """
+        if node.loader is not None:
+            loader, node.loader = node.loader, None
+            keys, factory = loader(node)
+            node.pending = list(keys)
+            node.factory = factory
+            self.listener.changed(node)     # Loaders may update the node's text
+        if not node.pending:
+            return 0
+        count = min(limit or self.batch, len(node.pending))
+        keys, node.pending = node.pending[:count], node.pending[count:]
+        new = [node.factory(key) for key in keys]
+        self.created += count
+        self._insert(node, len(node.children), new)
+        return count
+
+    def fetch_all(self, node: LazyNode):
+        while self.can_fetch(node):
+            self.fetch(node, limit=max(len(node.pending), 1))
+
+    # ========== STRUCTURE ==========
+
+    def set_children(self, parent: LazyNode, keys: Sequence[Any], factory: Callable[[Any], LazyNode]):
+        """Replace a node's children with lazily created ones"""
+        self.clear_children(parent)
+        parent.loader = None
+        parent.pending = list(keys)
+        parent.factory = factory
+        self.listener.changed(parent)
+
+    def set_loader(self, parent: LazyNode, loader):
+        """Drop a node's children and load them again on next expand"""
+        self.clear_children(parent)
+        parent.pending = []
+        parent.loader = loader
+        self.listener.changed(parent)
+
+    def clear_children(self, parent: LazyNode):
+        if parent.children:
+            self.listener.begin_remove(parent, 0, len(parent.children) - 1)
+            for child in parent.children:
+                child.parent = None
+            parent.children = []
+            parent._index = {}
+            self.listener.end_remove()
+
+    def insert(self, parent: LazyNode, node: LazyNode, row: Optional[int] = None) -> LazyNode:
+        """Insert a node (appended when row is None)"""
+        self._insert(parent, len(parent.children) if row is None else row, [node])
+        return node
+
+    def remove(self, node: LazyNode):
+        """Remove a node and its subtree"""
+        parent = node.parent
+        if parent is None:
+            return
+        row = node.row
+        self.listener.begin_remove(parent, row, row)
+        del parent.children[row]
+        parent._index.pop(node.key, None)
+        node.parent = None
+        self._renumber(parent, row)
+        self.listener.end_remove()
+
+    def sync(self, parent: LazyNode, keys: Sequence[Any], factory: Callable[[Any], LazyNode]):
+        """
+        Bring a node's children in line with an ordered key list.
+
+        Loaded children that disappeared are removed, new keys that fall
+        inside the loaded range are inserted in place and the rest stay
+        pending; unchanged nodes (and so selection/expansion) are kept.
+        """
+        parent.factory = factory
+        wanted = set(keys)
+        for child in [c for c in parent.children if c.key not in wanted]:
+            self.remove(child)
+
+        loaded = [c.key for c in parent.children]
+        if not loaded:
+            parent.pending = list(keys)
+            parent.loader = None
+            self.listener.changed(parent)
+            return
+
+        position = {key: i for i, key in enumerate(keys)}
+        order = [position[key] for key in loaded]
+        if order != sorted(order):
+            # Ordering changed: nothing to preserve positionally
+            self.set_children(parent, keys, factory)
+            return
+
+        # Everything up to the last loaded key is loaded; fully fetched nodes load all
+        end = len(keys) if not parent.pending else order[-1] + 1
+        j = 0
+        for i, key in enumerate(keys[:end]):
+            if j < len(parent.children) and parent.children[j].key == key:
+                j += 1
+                continue
+            self._insert(parent, j, [factory(key)])
+            self.created += 1
+            j += 1
+        parent.pending = list(keys[end:])
+        self.listener.changed(parent)
+
+    # ========== LOOKUP ==========
+
+    def find(self, path: Iterable[Any]) -> Optional[LazyNode]:
+        """Node at a key path from the root, fetching along the way"""
+        node = self.root
+        for key in path:
+            child = node.child(key)
+            while child is None and self.can_fetch(node):
+                self.fetch(node)
+                child = node.child(key)
+            if child is None:
+                return None
+            node = child
+        return node
+
+    def walk(self, node: Optional[LazyNode] = None):
+        """Loaded nodes below a node, depth first"""
+        for child in (node or self.root).children:
+            yield child
+            yield from self.walk(child)
+
+    # ========== INTERNAL ==========
+
+    def _insert(self, parent: LazyNode, row: int, nodes: List[LazyNode]):
+        if not nodes:
+            return
+        self.listener.begin_insert(parent, row, row + len(nodes) - 1)
+        parent.children[row:row] = nodes
+        for node in nodes:
+            node.parent = parent
+            parent._index[node.key] = node
+        self._renumber(parent, row)
+        self.listener.end_insert()
+
+    @staticmethod
+    def _renumber(parent: LazyNode, start: int):
+        for i in range(start, len(parent.children)):
+            parent.children[i].row = i
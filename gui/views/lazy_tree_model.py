@@ -0,0 +1,118 @@
+"""
+Lazy Tree Model
+
+QAbstractItemModel over a LazyTree. Children are created on expand through
+canFetchMore/fetchMore, a batch at a time, and tree changes are reported as
+row insertions/removals so views keep their selection and expansion.
+"""
+
+from typing import Any, Optional
+
+from PyQt6.QtCore import Qt, QAbstractItemModel, QModelIndex
+from PyQt6.QtGui import QColor, QFont
+
+from gui.views.lazy_tree import LazyNode, LazyTree
+
+
+class LazyTreeModel(QAbstractItemModel):
+    """
+    Single-column lazy tree model.
+
+    Usage:
+        model = LazyTreeModel()
+        model.tree.sync(model.tree.root, names, make_node)
+        view.setModel(model)
+    """
+
+    def __init__(self, batch: Optional[int] = None, parent=None):
+        super().__init__(parent)
+        self.tree = LazyTree(listener=self, batch=batch)
+        self._fonts = {}
+
+    # ========== NODES <-> INDEXES ==========
+
+    def node(self, index: QModelIndex) -> LazyNode:
+        return index.internalPointer() if index.isValid() else self.tree.root
+
+    def index_of(self, node: Optional[LazyNode]) -> QModelIndex:
+        if node is None or node is self.tree.root or node.parent is None:
+            return QModelIndex()
+        return self.createIndex(node.row, 0, node)
+
+    # ========== TREE LISTENER ==========
+
+    def begin_insert(self, parent, first, last):
+        self.beginInsertRows(self.index_of(parent), first, last)
+
+    def end_insert(self):
+        self.endInsertRows()
+
+    def begin_remove(self, parent, first, last):
+        self.beginRemoveRows(self.index_of(parent), first, last)
+
+    def end_remove(self):
+        self.endRemoveRows()
+
+    def changed(self, node):
+        index = self.index_of(node)
+        if index.isValid():
+            self.dataChanged.emit(index, index)
+
+    # ========== QAbstractItemModel ==========
+
+    def index(self, row, column, parent=QModelIndex()):
+        node = self.node(parent)
+        if column != 0 or not 0 <= row < len(node.children):
+            return QModelIndex()
+        return self.createIndex(row, 0, node.children[row])
+
+    def parent(self, index=QModelIndex()):
+        if not index.isValid():
+            return QModelIndex()
+        return self.index_of(index.internalPointer().parent)
+
+    def rowCount(self, parent=QModelIndex()):
+        if parent.column() > 0:
+            return 0
+        return len(self.node(parent).children)
+
+    def columnCount(self, parent=QModelIndex()):
+        return 1
+
+    def hasChildren(self, parent=QModelIndex()):
+        return self.node(parent).has_children()
+
+    def canFetchMore(self, parent):
+        return self.tree.can_fetch(self.node(parent))
+
+    def fetchMore(self, parent):
+        self.tree.fetch(self.node(parent))
+
+    def data(self, index, role=Qt.ItemDataRole.DisplayRole):
+        if not index.isValid():
+            return None
+        node = index.internalPointer()
+
+        if role == Qt.ItemDataRole.DisplayRole:
+            return node.text
+        if role == Qt.ItemDataRole.UserRole:
+            return node.data
+        if role == Qt.ItemDataRole.ToolTipRole:
+            return node.tooltip_text()
+        if role == Qt.ItemDataRole.ForegroundRole and 'color' in node.style:
+            return QColor(node.style['color'])
+        if role == Qt.ItemDataRole.FontRole and 'font' in node.style:
+            return self._font(node.style['font'])
+        return None
+
+    def flags(self, index):
+        if not index.isValid():
+            return Qt.ItemFlag.NoItemFlags
+        return Qt.ItemFlag.ItemIsEnabled | Qt.ItemFlag.ItemIsSelectable
+
+    def _font(self, spec):
+        """QFont for a (family, size, bold) tuple (shared between nodes)"""
+        if spec not in self._fonts:
+            family, size, bold = spec
+            self._fonts[spec] = QFont(family, size, QFont.Weight.Bold if bold else QFont.Weight.Normal)
+        return self._fonts[spec]
@@ -1,15 +1,28 @@
 """
 Material Browser View
 
-Tree widget for browsing materials by category.
+Lazy tree view for browsing materials by category.
 """
 
 from PyQt6.QtWidgets import (
-    QWidget, QVBoxLayout, QTreeWidget, QTreeWidgetItem,
+    QWidget, QVBoxLayout, QTreeView,
     QLineEdit, QLabel
 )
 from PyQt6.QtCore import pyqtSignal, Qt
 
+from gui.views.incremental_filter import IncrementalFilter
+from gui.views.lazy_tree import LazyNode
+from gui.views.lazy_tree_model import LazyTreeModel
+
+
+EXPLOSIVES = ["RDX", "TNT", "HMX", "PETN", "TATB", "CL-20", "HNS", "Nitromethane"]
+METALS = ["Aluminum", "Copper", "Magnesium", "Nickel", "Tantalum", "Titanium", "Tungsten"]
+CATEGORIES = ["Metals", "Explosives", "Other"]
+
+
+def _material_node(material_name):
+    return LazyNode(material_name, material_name, data=material_name)
+
 
 class MaterialBrowser(QWidget):
     """
@@ -23,6 +36,10 @@ class MaterialBrowser(QWidget):
     
     def __init__(self, parent=None):
         super().__init__(parent)
+        self.all_materials = []
+        self.categories = {}  # category -> sorted material names
+        self._entries = []  # (category, name) in display order
+        self._filter = IncrementalFilter()  # Search over self._entries names
         self.init_ui()
     
     def init_ui(self):
@@ -41,10 +58,13 @@ class MaterialBrowser(QWidget):
         self.search_box.textChanged.connect(self.on_search)
         layout.addWidget(self.search_box)
         
-        # Tree widget
-        self.tree = QTreeWidget()
+        # Tree view (material nodes are created as categories are expanded/scrolled)
+        self.model = LazyTreeModel(parent=self)
+        self.tree = QTreeView()
         self.tree.setHeaderHidden(True)
-        self.tree.itemClicked.connect(self.on_item_clicked)
+        self.tree.setUniformRowHeights(True)
+        self.tree.setModel(self.model)
+        self.tree.clicked.connect(self.on_item_clicked)
         layout.addWidget(self.tree)
         
         # Stats label
@@ -55,81 +75,64 @@ class MaterialBrowser(QWidget):
         """
         Load materials into tree view.
         
+        Reloading updates the tree in place: only added/removed materials
+        change, so the selection and expanded categories are kept.
+        
         Args:
             materials: List of material dictionaries with 'name' key
         """
-        self.tree.clear()
         self.all_materials = materials
         
         # Extract material names from dictionaries
         material_names = [m['name'] if isinstance(m, dict) else m for m in materials]
         
         # Categorize materials
-        categories = {
-            "Metals": [],
-            "Explosives": [],
-            "Other": []
-        }
-        
-        explosives = ["RDX", "TNT", "HMX", "PETN", "TATB", "CL-20", "HNS", "Nitromethane"]
-        metals = ["Aluminum", "Copper", "Magnesium", "Nickel", "Tantalum", "Titanium", "Tungsten"]
-        
+        categories = {category: [] for category in CATEGORIES}
         for material_name in material_names:
-            if material_name in metals:
+            if material_name in METALS:
                 categories["Metals"].append(material_name)
-            elif material_name in explosives:
+            elif material_name in EXPLOSIVES:
                 categories["Explosives"].append(material_name)
             else:
                 categories["Other"].append(material_name)
+        self.categories = {category: sorted(items) for category, items in categories.items()}
+        self._entries = [(category, name) for category, names in self.categories.items() for name in names]
+        self._filter.set_items(name for _, name in self._entries)
         
-        # Build tree
-        for category, items in categories.items():
-            if not items:
-                continue
-            
-            # Category node
-            category_item = QTreeWidgetItem(self.tree, [f"{category} ({len(items)})"])
-            category_item.setExpanded(True)
-            
-            # Material nodes
-            for material in sorted(items):
-                material_item = QTreeWidgetItem(category_item, [material])
-                material_item.setData(0, Qt.ItemDataRole.UserRole, material)
+        self._sync_tree(self.search_box.text())
         
         # Update stats
         self.stats_label.setText(f"Total: {len(material_names)} materials")
     
-    def on_item_clicked(self, item, column):
+    def _sync_tree(self, text=""):
+        """Show categories and materials matching the search text."""
+        tree = self.model.tree
+        shown = {}
+        for row in self._filter.filter(text):
+            category, name = self._entries[row]
+            shown.setdefault(category, []).append(name)
+        
+        new_categories = [category for category in shown if tree.root.child(category) is None]
+        tree.sync(tree.root, list(shown), lambda category: LazyNode(category, category))
+        
+        for category, names in shown.items():
+            node = tree.root.child(category)
+            node.text = f"{category} ({len(names)})"
+            tree.sync(node, names, _material_node)
+        
+        # Categories start expanded (only the first batch of materials is created)
+        for category in new_categories:
+            self.tree.expand(self.model.index_of(tree.root.child(category)))
+        if text.strip():
+            for category in shown:
+                self.tree.expand(self.model.index_of(tree.root.child(category)))
+    
+    def on_item_clicked(self, index):
         """Handle tree item click."""
-        material_name = item.data(0, Qt.ItemDataRole.UserRole)
+        material_name = index.data(Qt.ItemDataRole.UserRole)
         if material_name:
             self.material_selected.emit(material_name)
     
     def on_search(self, text):
         """Filter materials by search text."""
-        if not text:
-            # Show all
-            for i in range(self.tree.topLevelItemCount()):
-                category = self.tree.topLevelItem(i)
-                category.setHidden(False)
-                for j in range(category.childCount()):
-                    category.child(j).setHidden(False)
-            return
-        
-        # Filter
-        text = text.lower()
-        for i in range(self.tree.topLevelItemCount()):
-            category = self.tree.topLevelItem(i)
-            category_has_match = False
-            
-            for j in range(category.childCount()):
-                child = category.child(j)
-                material_name = child.data(0, Qt.ItemDataRole.UserRole)
-                
-                if material_name and text in material_name.lower():
-                    child.setHidden(False)
-                    category_has_match = True
-                else:
-                    child.setHidden(True)
-            
-            category.setHidden(not category_has_match)
+        self._sync_tree(text)
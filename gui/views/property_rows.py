@@ -0,0 +1,195 @@
+"""
+Property Rows
+
+Flattens an assembled material (properties + models dictionaries) into the
+row list shown by the PropertyViewer tables, and compares two row lists for
+the diff view. Kept free of Qt so the row logic can be reused and tested
+without a display.
+"""
+
+from typing import Any, Dict, List, NamedTuple, Optional
+
+
+USER_OVERRIDE = "USER_OVERRIDE"
+
+
+class PropertyRow(NamedTuple):
+    """One table row: a property entry or model parameter."""
+    path: str       # e.g. properties.Thermal.Cp, models.EOSModel.Row[1].A
+    value: str      # Display text ("(null)", "(empty)" and "(no rows)" for missing values)
+    unit: str
+    ref: Any        # Reference ID, USER_OVERRIDE or '' (raw, for tooltips)
+    empty: bool     # Missing value (drawn in gray)
+
+    @property
+    def is_override(self) -> bool:
+        return self.ref == USER_OVERRIDE
+
+    @property
+    def ref_text(self) -> str:
+        return str(self.ref) if self.ref else ""
+
+
+class DiffRow(NamedTuple):
+    """A row whose value, unit or reference differs from the original."""
+    path: str
+    original: str
+    value: str
+    unit: str
+    ref: Any
+    status: str     # 'changed', 'added' or 'removed'
+
+    @property
+    def ref_text(self) -> str:
+        return str(self.ref) if self.ref else ""
+
+
+def _entry_row(path: str, entry: Dict[str, Any], unit: Optional[str] = None) -> PropertyRow:
+    value = entry.get('value')
+    empty = value is None or value == ''
+    return PropertyRow(
+        path=path,
+        value="(null)" if empty else str(value),
+        unit=unit if unit is not None else entry.get('unit', ''),
+        ref=entry.get('ref', ''),
+        empty=empty,
+    )
+
+
+def flatten_material(properties: Dict[str, Any], models: Dict[str, Any]) -> List[PropertyRow]:
+    """
+    Rows for every property entry and model parameter, including empty and
+    null values, in display order.
+
+    Args:
+        properties: Properties dictionary of an assembled material
+        models: Models dictionary of an assembled material
+
+    Returns:
+        List of PropertyRow
+    """
+    rows = []
+
+    for category, props in (properties or {}).items():
+        if category == "Phase":
+            state = props.get('State')
+            rows.append(PropertyRow("properties.Phase.State", state if state else "(empty)", "", "", not state))
+            continue
+
+        # Thermal, Mechanical, etc.
+        for prop_name, prop_data in props.items():
+            if not isinstance(prop_data, dict):
+                continue
+            path = f"properties.{category}.{prop_name}"
+            unit = prop_data.get('unit', '')
+            entries = prop_data.get('entries', [])
+            if not entries:
+                rows.append(PropertyRow(path, "(empty)", unit, "", True))
+            for entry in entries:
+                rows.append(_entry_row(path, entry, unit))
+
+    for model_type, model_data in (models or {}).items():
+        if not isinstance(model_data, dict):
+            continue
+
+        # EOSModel with 'rows' structure
+        if model_type == 'EOSModel' and 'rows' in model_data:
+            rows_list = model_data.get('rows', [])
+            if not rows_list:
+                rows.append(PropertyRow(f"models.{model_type}", "(no rows)", "", "", True))
+            for eos_row in rows_list:
+                prefix = f"models.{model_type}.Row[{eos_row.get('index', '?')}]"
+                for param_name, param_value in eos_row.get('parameters', {}).items():
+                    if not isinstance(param_value, dict):
+                        continue
+                    if 'value' in param_value:
+                        rows.append(_entry_row(f"{prefix}.{param_name}", param_value))
+                        continue
+                    # Nested dict (unreacted/reacted)
+                    for nested_name, nested_value in param_value.items():
+                        if isinstance(nested_value, dict) and 'value' in nested_value:
+                            rows.append(_entry_row(f"{prefix}.{param_name}.{nested_name}", nested_value))
+            continue
+
+        for param_name, param_value in model_data.items():
+            path = f"models.{model_type}.{param_name}"
+            if isinstance(param_value, list):
+                # List of entries (like ThermoMechanical parameters)
+                rows.extend(_entry_row(path, entry) for entry in param_value if isinstance(entry, dict))
+            elif isinstance(param_value, dict):
+                if 'value' in param_value:
+                    rows.append(_entry_row(path, param_value))
+                    continue
+                # Nested structure (e.g. SpecificHeatConstants.c0)
+                for sub_name, sub_value in param_value.items():
+                    if isinstance(sub_value, dict) and 'value' in sub_value:
+                        rows.append(_entry_row(f"{path}.{sub_name}", sub_value))
+                    elif isinstance(sub_value, list):
+                        rows.extend(_entry_row(f"{path}.{sub_name}", sub_entry)
+                                    for sub_entry in sub_value if isinstance(sub_entry, dict))
+
+    return rows
+
+
+def _keyed(rows: List[PropertyRow]) -> Dict[tuple, PropertyRow]:
+    """Rows keyed by (path, occurrence) so repeated entries of a path line up."""
+    seen = {}
+    keyed = {}
+    for row in rows:
+        n = seen.get(row.path, 0)
+        seen[row.path] = n + 1
+        keyed[(row.path, n)] = row
+    return keyed
+
+
+def diff_rows(original: List[PropertyRow], active: List[PropertyRow]) -> List[DiffRow]:
+    """
+    Rows that differ between the original and the active (overridden) data,
+    in active display order followed by rows that only exist in the original.
+    """
+    before = _keyed(original)
+    after = _keyed(active)
+    diff = []
+    for key, row in after.items():
+        old = before.get(key)
+        if old is None:
+            diff.append(DiffRow(row.path, "", row.value, row.unit, row.ref, 'added'))
+        elif (old.value, old.unit, old.ref) != (row.value, row.unit, row.ref):
+            diff.append(DiffRow(row.path, old.value, row.value, row.unit, row.ref, 'changed'))
+    for key, old in before.items():
+        if key not in after:
+            diff.append(DiffRow(old.path, old.value, "", old.unit, old.ref, 'removed'))
+    return diff
+
+
+def reference_id(ref_value) -> Optional[int]:
+    """Numeric reference ID of a ref cell, or None (USER_OVERRIDE, free text)."""
+    if isinstance(ref_value, bool):
+        return None
+    if isinstance(ref_value, (int, float)):
+        return int(ref_value)
+    if isinstance(ref_value, str) and ref_value.strip().isdigit():
+        return int(ref_value.strip())
+    return None
+
+
+def reference_tooltip(ref_value, reference_cache: Dict[int, Dict[str, Any]]) -> Optional[str]:
+    """
+    Rich tooltip with the full citation of a reference.
+
+    Returns:
+        HTML string, or None when the reference is unknown
+    """
+    ref_id = reference_id(ref_value)
+    ref_data = reference_cache.get(ref_id) if ref_id else None
+    if not ref_data:
+        return None
+    return f"""<b>Reference #{ref_id}</b><br>
+<i>{ref_data.get('title', 'No title')}</i><br>
+<br>
+<b>Author:</b> {ref_data.get('author', 'Unknown')}<br>
+<b>Year:</b> {ref_data.get('year', '--')}<br>
+<b>Type:</b> {ref_data.get('ref_type', 'unknown')}<br>
+<b>Journal:</b> {ref_data.get('journal', '--')}<br>
+<b>Volume:</b> {ref_data.get('volume', '--')}, <b>Pages:</b> {ref_data.get('pages', '--')}
+"""
@@ -0,0 +1,144 @@
+"""
+Property Table Model
+
+QAbstractTableModel over the flattened rows of an assembled material.
+
+The view asks only for the cells it paints, so showing a material costs one
+flatten pass instead of a QTableWidgetItem per cell. Styling (empty values,
+override highlighting) and reference tooltips are computed when a cell is
+painted or hovered; tooltips are cached per reference.
+
+Diff mode shows only the rows that differ from the original data, with the
+original value alongside, so no second table is needed for the comparison.
+"""
+
+from typing import Any, Dict, List, Optional
+
+from PyQt6.QtCore import Qt, QAbstractTableModel, QModelIndex
+from PyQt6.QtGui import QColor
+
+from gui.views.property_rows import PropertyRow, diff_rows, reference_tooltip
+
+
+GOLD = QColor(255, 215, 0, 50)      # Overridden / changed rows
+GRAY = QColor(120, 120, 120)        # Empty and null values, removed rows
+
+
+class PropertyTableModel(QAbstractTableModel):
+    """
+    Read-only table of material rows.
+
+    Columns: Property, Value, Unit, Reference
+    Diff mode: Property, Original Value, Value, Unit, Reference
+    """
+
+    HEADERS = ["Property", "Value", "Unit", "Reference"]
+    DIFF_HEADERS = ["Property", "Original Value", "Value", "Unit", "Reference"]
+
+    def __init__(self, highlight_overrides: bool = False, parent=None):
+        """
+        Args:
+            highlight_overrides: Highlight USER_OVERRIDE rows in gold
+            parent: Parent QObject
+        """
+        super().__init__(parent)
+        self.highlight_overrides = highlight_overrides
+        self._rows: List[PropertyRow] = []
+        self._original: Optional[List[PropertyRow]] = None
+        self._diff = None
+        self._diff_mode = False
+        self._references: Dict[int, Dict[str, Any]] = {}
+        self._tooltips: Dict[Any, Optional[str]] = {}
+
+    # ========== DATA ==========
+
+    def set_material(self, rows: List[PropertyRow], original_rows: Optional[List[PropertyRow]] = None,
+                     reference_cache: Optional[Dict[int, Dict[str, Any]]] = None):
+        """
+        Show a material.
+
+        Args:
+            rows: Rows to display
+            original_rows: Rows of the original data (enables diff mode)
+            reference_cache: {reference_id: reference dict} for tooltips
+        """
+        self.beginResetModel()
+        self._rows = rows
+        self._original = original_rows
+        self._diff = None
+        self._references = reference_cache or {}
+        self._tooltips = {}
+        if original_rows is None:
+            self._diff_mode = False
+        self.endResetModel()
+
+    def clear(self):
+        self.set_material([])
+
+    @property
+    def diff_mode(self) -> bool:
+        return self._diff_mode
+
+    def set_diff_mode(self, enabled: bool):
+        """Show only rows that differ from the original (needs original_rows)"""
+        enabled = bool(enabled) and self._original is not None
+        if enabled == self._diff_mode:
+            return
+        self.beginResetModel()
+        self._diff_mode = enabled
+        self.endResetModel()
+
+    def _visible(self):
+        if not self._diff_mode:
+            return self._rows
+        if self._diff is None:
+            self._diff = diff_rows(self._original, self._rows)
+        return self._diff
+
+    def row_at(self, row: int):
+        """PropertyRow (or DiffRow in diff mode) shown at a row"""
+        return self._visible()[row]
+
+    # ========== QAbstractTableModel ==========
+
+    def rowCount(self, parent=QModelIndex()):
+        return 0 if parent.isValid() else len(self._visible())
+
+    def columnCount(self, parent=QModelIndex()):
+        return 0 if parent.isValid() else len(self.DIFF_HEADERS if self._diff_mode else self.HEADERS)
+
+    def headerData(self, section, orientation, role=Qt.ItemDataRole.DisplayRole):
+        if role == Qt.ItemDataRole.DisplayRole and orientation == Qt.Orientation.Horizontal:
+            headers = self.DIFF_HEADERS if self._diff_mode else self.HEADERS
+            return headers[section]
+        return super().headerData(section, orientation, role)
+
+    def data(self, index, role=Qt.ItemDataRole.DisplayRole):
+        if not index.isValid():
+            return None
+        row = self._visible()[index.row()]
+        column = index.column()
+
+        if role == Qt.ItemDataRole.DisplayRole:
+            if self._diff_mode:
+                return (row.path, row.original, row.value, row.unit, row.ref_text)[column]
+            return (row.path, row.value, row.unit, row.ref_text)[column]
+
+        if role == Qt.ItemDataRole.BackgroundRole:
+            if self._diff_mode:
+                return GOLD if row.status != 'removed' else None
+            if self.highlight_overrides and row.is_override:
+                return GOLD
+            return None
+
+        if role == Qt.ItemDataRole.ForegroundRole:
+            if self._diff_mode:
+                return GRAY if row.status == 'removed' else None
+            return GRAY if row.empty else None
+
+        if role == Qt.ItemDataRole.ToolTipRole and column == self.columnCount() - 1 and row.ref:
+            if row.ref not in self._tooltips:
+                self._tooltips[row.ref] = reference_tooltip(row.ref, self._references)
+            return self._tooltips[row.ref]
+
+        return None
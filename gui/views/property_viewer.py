@@ -11,7 +11,7 @@ Overrides are non-destructive and material-specific.
 """
 
 from PyQt6.QtWidgets import (
-    QWidget, QVBoxLayout, QTabWidget, QTableWidget,
+    QWidget, QVBoxLayout, QTabWidget, QTableWidget, QTableView, QCheckBox,
     QTableWidgetItem, QLabel, QHeaderView, QHBoxLayout, QPushButton, QMessageBox, QFileDialog
 )
 from PyQt6.QtCore import Qt, pyqtSignal
@@ -19,6 +19,8 @@ from PyQt6.QtGui import QColor
 
 # Import the new ReferenceViewer widget
 from gui.views.reference_viewer import ReferenceViewer
+from gui.views.property_rows import flatten_material
+from gui.views.property_table_model import PropertyTableModel
 
 
 class PropertyViewer(QWidget):
@@ -57,7 +59,7 @@ class PropertyViewer(QWidget):
         original_container = QWidget()
         original_layout = QVBoxLayout(original_container)
         original_layout.setContentsMargins(0, 0, 0, 0)
-        self.original_data_tab = self._create_table()
+        self.original_data_tab = self._create_table(highlight_overrides=False)
         original_layout.addWidget(self.original_data_tab)
         # Export button for Original Data
         export_original_btn = QPushButton("Export Original Data as XML")
@@ -83,8 +85,12 @@ class PropertyViewer(QWidget):
         active_container = QWidget()
         active_layout = QVBoxLayout(active_container)
         active_layout.setContentsMargins(0, 0, 0, 0)
-        self.active_view_tab = self._create_table()
+        self.active_view_tab = self._create_table(highlight_overrides=True)
         active_layout.addWidget(self.active_view_tab)
+        # Diff against the original in the same table
+        self.diff_checkbox = QCheckBox("Show only changes vs. Original Data")
+        self.diff_checkbox.toggled.connect(self._on_diff_toggled)
+        active_layout.addWidget(self.diff_checkbox)
         # Export button for Active View
         export_active_btn = QPushButton("Export Active View as XML")
         export_active_btn.clicked.connect(lambda: self.export_requested.emit("active"))
@@ -97,22 +103,21 @@ class PropertyViewer(QWidget):
         self.tabs.addTab(self.references_tab, "References")
         self.tabs.setTabToolTip(3, "Scientific references and citations used by this material")
     
-    def _create_table(self):
-        """Create standard 4-column table for data display."""
-        table = QTableWidget()
-        table.setColumnCount(4)
-        table.setHorizontalHeaderLabels(["Property", "Value", "Unit", "Reference"])
+    def _create_table(self, highlight_overrides=False):
+        """Create standard 4-column table (model/view: only visible rows are rendered)."""
+        table = QTableView()
+        table.setModel(PropertyTableModel(highlight_overrides=highlight_overrides, parent=table))
         
-        # Configure headers
+        # Configure headers (content sizing samples rows instead of measuring all of them)
         header = table.horizontalHeader()
+        header.setResizeContentsPrecision(200)
+        header.setSectionResizeMode(QHeaderView.ResizeMode.ResizeToContents)
         header.setSectionResizeMode(0, QHeaderView.ResizeMode.Stretch)
-        header.setSectionResizeMode(1, QHeaderView.ResizeMode.ResizeToContents)
-        header.setSectionResizeMode(2, QHeaderView.ResizeMode.ResizeToContents)
-        header.setSectionResizeMode(3, QHeaderView.ResizeMode.ResizeToContents)
+        table.verticalHeader().setSectionResizeMode(QHeaderView.ResizeMode.Fixed)
         
         # Read-only
-        table.setEditTriggers(QTableWidget.EditTrigger.NoEditTriggers)
-        table.setSelectionBehavior(QTableWidget.SelectionBehavior.SelectRows)
+        table.setEditTriggers(QTableView.EditTrigger.NoEditTriggers)
+        table.setSelectionBehavior(QTableView.SelectionBehavior.SelectRows)
         
         return table
     
@@ -164,19 +169,23 @@ class PropertyViewer(QWidget):
             for ref in references_list:
                 self.reference_cache[ref.get('reference_id')] = ref
         
-        # Clear all tabs
-        self.original_data_tab.setRowCount(0)
+        # Clear overrides tab
+        self.overrides_tab.clearSpans()
         self.overrides_tab.setRowCount(0)
-        self.active_view_tab.setRowCount(0)
         
-        # TAB 1: Original Data (NO overrides)
-        self._load_data_to_table(
-            self.original_data_tab,
+        # Flatten each version once; both table models share the row lists
+        original_rows = flatten_material(
             material_data_original.get('properties', {}),
-            material_data_original.get('models', {}),
-            highlight_overrides=False
+            material_data_original.get('models', {})
+        )
+        active_rows = flatten_material(
+            material_data_with_overrides.get('properties', {}),
+            material_data_with_overrides.get('models', {})
         )
         
+        # TAB 1: Original Data (NO overrides)
+        self.original_data_tab.model().set_material(original_rows, reference_cache=self.reference_cache)
+        
         # TAB 2: Overrides (comparison)
         self._load_overrides_comparison(
             material_data_original,
@@ -184,13 +193,11 @@ class PropertyViewer(QWidget):
             overrides_list or []
         )
         
-        # TAB 3: Active View (with overrides)
-        self._load_data_to_table(
-            self.active_view_tab,
-            material_data_with_overrides.get('properties', {}),
-            material_data_with_overrides.get('models', {}),
-            highlight_overrides=True
-        )
+        # TAB 3: Active View (with overrides, diffable against the original)
+        active_model = self.active_view_tab.model()
+        active_model.set_material(active_rows, original_rows=original_rows,
+                                  reference_cache=self.reference_cache)
+        active_model.set_diff_mode(self.diff_checkbox.isChecked())
         
         # TAB 4: References (NEW)
         if references_list is not None:
@@ -198,276 +205,9 @@ class PropertyViewer(QWidget):
         else:
             self.references_tab.clear()
     
-    def _load_data_to_table(self, table, properties, models, highlight_overrides=False):
-        """
-        Load properties and models into a table.
-        CRITICAL: Display ALL entries, including empty/null values.
-        
-        Args:
-            table: QTableWidget to populate
-            properties: Properties dictionary
-            models: Models dictionary
-            highlight_overrides: If True, highlight USER_OVERRIDE entries in gold
-        """
-        row = 0
-        
-        # Load properties
-        for category, props in properties.items():
-            if category == "Phase":
-                state = props.get('State')
-                table.insertRow(row)
-                table.setItem(row, 0, QTableWidgetItem(f"properties.Phase.State"))
-                table.setItem(row, 1, QTableWidgetItem(state if state else "(empty)"))
-                table.setItem(row, 2, QTableWidgetItem(""))
-                table.setItem(row, 3, QTableWidgetItem(""))
-                if not state:
-                    self._set_empty_style(table, row)
-                row += 1
-                continue
-            
-            # Handle Thermal, Mechanical, etc.
-            for prop_name, prop_data in props.items():
-                if isinstance(prop_data, dict):
-                    unit = prop_data.get('unit', '')
-                    entries = prop_data.get('entries', [])
-                    
-                    if not entries:
-                        # No entries at all - show empty
-                        table.insertRow(row)
-                        table.setItem(row, 0, QTableWidgetItem(f"properties.{category}.{prop_name}"))
-                        table.setItem(row, 1, QTableWidgetItem("(empty)"))
-                        table.setItem(row, 2, QTableWidgetItem(unit))
-                        table.setItem(row, 3, QTableWidgetItem(""))
-                        self._set_empty_style(table, row)
-                        row += 1
-                    else:
-                        # Display ALL entries (including null ones)
-                        for entry in entries:
-                            table.insertRow(row)
-                            table.setItem(row, 0, QTableWidgetItem(f"properties.{category}.{prop_name}"))
-                            
-                            value = entry.get('value')
-                            if value is None or value == '':
-                                table.setItem(row, 1, QTableWidgetItem("(null)"))
-                                self._set_empty_style(table, row)
-                            else:
-                                table.setItem(row, 1, QTableWidgetItem(str(value)))
-                            
-                            table.setItem(row, 2, QTableWidgetItem(unit))
-                            
-                            ref = entry.get('ref', '')
-                            ref_item = QTableWidgetItem(str(ref) if ref else "")
-                            table.setItem(row, 3, ref_item)
-                            
-                            # Add tooltip to reference cell
-                            if ref:
-                                self._set_reference_tooltip(ref_item, ref)
-                            
-                            # Highlight overrides in Active View
-                            if highlight_overrides and ref == "USER_OVERRIDE":
-                                self._highlight_row(table, row)
-                            
-                            row += 1
-        
-        # Load models - handle ALL model types
-        print(f"DEBUG [property_viewer]: Loading models, total types = {len(models)}")
-        print(f"DEBUG [property_viewer]: Model types: {list(models.keys())}")
-        for model_type, model_data in models.items():
-            print(f"DEBUG [property_viewer]: Processing model_type = '{model_type}'")
-            print(f"DEBUG [property_viewer]: model_data type = {type(model_data)}, data = {model_data}")
-            if not isinstance(model_data, dict):
-                print(f"DEBUG [property_viewer]: Skipping {model_type} - not a dict")
-                continue
-            
-            # Special handling for EOSModel with 'rows' structure
-            if model_type == 'EOSModel' and 'rows' in model_data:
-                rows_list = model_data.get('rows', [])
-                if not rows_list:
-                    # Show empty EOS model
-                    table.insertRow(row)
-                    table.setItem(row, 0, QTableWidgetItem(f"models.{model_type}"))
-                    table.setItem(row, 1, QTableWidgetItem("(no rows)"))
-                    table.setItem(row, 2, QTableWidgetItem(""))
-                    table.setItem(row, 3, QTableWidgetItem(""))
-                    self._set_empty_style(table, row)
-                    row += 1
-                else:
-                    # Display each row and its parameters
-                    for eos_row in rows_list:
-                        row_index = eos_row.get('index', '?')
-                        parameters = eos_row.get('parameters', {})
-                        
-                        for param_name, param_value in parameters.items():
-                            if isinstance(param_value, dict):
-                                # Simple parameter
-                                if 'value' in param_value:
-                                    table.insertRow(row)
-                                    table.setItem(row, 0, QTableWidgetItem(f"models.{model_type}.Row[{row_index}].{param_name}"))
-                                    
-                                    value = param_value.get('value')
-                                    if value is None or value == '':
-                                        table.setItem(row, 1, QTableWidgetItem("(null)"))
-                                        self._set_empty_style(table, row)
-                                    else:
-                                        table.setItem(row, 1, QTableWidgetItem(str(value)))
-                                    
-                                    table.setItem(row, 2, QTableWidgetItem(param_value.get('unit', '')))
-                                    
-                                    ref = param_value.get('ref', '')
-                                    table.setItem(row, 3, QTableWidgetItem(str(ref) if ref else ""))
-                                    
-                                    if highlight_overrides and ref == "USER_OVERRIDE":
-                                        self._highlight_row(table, row)
-                                    
-                                    row += 1
-                                else:
-                                    # Nested dict (unreacted/reacted)
-                                    for nested_name, nested_value in param_value.items():
-                                        if isinstance(nested_value, dict) and 'value' in nested_value:
-                                            table.insertRow(row)
-                                            table.setItem(row, 0, QTableWidgetItem(f"models.{model_type}.Row[{row_index}].{param_name}.{nested_name}"))
-                                            
-                                            value = nested_value.get('value')
-                                            if value is None or value == '':
-                                                table.setItem(row, 1, QTableWidgetItem("(null)"))
-                                                self._set_empty_style(table, row)
-                                            else:
-                                                table.setItem(row, 1, QTableWidgetItem(str(value)))
-                                            
-                                            table.setItem(row, 2, QTableWidgetItem(nested_value.get('unit', '')))
-                                            
-                                            ref = nested_value.get('ref', '')
-                                            table.setItem(row, 3, QTableWidgetItem(str(ref) if ref else ""))
-                                            
-                                            if highlight_overrides and ref == "USER_OVERRIDE":
-                                                self._highlight_row(table, row)
-                                            
-                                            row += 1
-                continue  # Skip normal processing for EOSModel
-            
-            # Process each sub-model or parameter
-            print(f"DEBUG [property_viewer]: Processing params for {model_type}, total params = {len(model_data)}")
-            for param_name, param_value in model_data.items():
-                print(f"DEBUG [property_viewer]:   param_name = '{param_name}', type = {type(param_value)}")
-                if isinstance(param_value, list):
-                    # List of entries (like ThermoMechanical parameters)
-                    print(f"DEBUG [property_viewer]:     It's a list with {len(param_value)} entries")
-                    for entry in param_value:
-                        if isinstance(entry, dict):
-                            table.insertRow(row)
-                            table.setItem(row, 0, QTableWidgetItem(f"models.{model_type}.{param_name}"))
-                            print(f"DEBUG [property_viewer]:     Inserted row {row}: models.{model_type}.{param_name} = {entry.get('value')}")
-                            
-                            value = entry.get('value')
-                            if value is None or value == '':
-                                table.setItem(row, 1, QTableWidgetItem("(null)"))
-                                self._set_empty_style(table, row)
-                            else:
-                                table.setItem(row, 1, QTableWidgetItem(str(value)))
-                            
-                            table.setItem(row, 2, QTableWidgetItem(entry.get('unit', '')))
-                            
-                            ref = entry.get('ref', '')
-                            ref_item = QTableWidgetItem(str(ref) if ref else "")
-                            table.setItem(row, 3, ref_item)
-                            
-                            # Add tooltip to reference cell
-                            if ref:
-                                self._set_reference_tooltip(ref_item, ref)
-                            
-                            if highlight_overrides and ref == "USER_OVERRIDE":
-                                self._highlight_row(table, row)
-                            
-                            row += 1
-                
-                elif isinstance(param_value, dict):
-                    print(f"DEBUG [property_viewer]:     It's a dict with keys: {list(param_value.keys())}")
-                    # Could be nested dict (SpecificHeatConstants) or sub-model
-                    if 'value' in param_value:
-                        print(f"DEBUG [property_viewer]:     Direct value dict")
-                        # Direct value dict
-                        table.insertRow(row)
-                        table.setItem(row, 0, QTableWidgetItem(f"models.{model_type}.{param_name}"))
-                        print(f"DEBUG [property_viewer]:     Inserted row {row}: models.{model_type}.{param_name} = {param_value.get('value')}")
-                        
-                        value = param_value.get('value')
-                        if value is None or value == '':
-                            table.setItem(row, 1, QTableWidgetItem("(null)"))
-                            self._set_empty_style(table, row)
-                        else:
-                            table.setItem(row, 1, QTableWidgetItem(str(value)))
-                        
-                        table.setItem(row, 2, QTableWidgetItem(param_value.get('unit', '')))
-                        
-                        ref = param_value.get('ref', '')
-                        ref_item = QTableWidgetItem(str(ref) if ref else "")
-                        table.setItem(row, 3, ref_item)
-                        
-                        # Add tooltip to reference cell
-                        if ref:
-                            self._set_reference_tooltip(ref_item, ref)
-                        
-                        if highlight_overrides and ref == "USER_OVERRIDE":
-                            self._highlight_row(table, row)
-                        
-                        row += 1
-                    else:
-                        # Nested structure - recursively process
-                        for sub_name, sub_value in param_value.items():
-                            if isinstance(sub_value, dict) and 'value' in sub_value:
-                                # Nested parameter (e.g., SpecificHeatConstants.c0)
-                                table.insertRow(row)
-                                table.setItem(row, 0, QTableWidgetItem(f"models.{model_type}.{param_name}.{sub_name}"))
-                                
-                                value = sub_value.get('value')
-                                if value is None or value == '':
-                                    table.setItem(row, 1, QTableWidgetItem("(null)"))
-                                    self._set_empty_style(table, row)
-                                else:
-                                    table.setItem(row, 1, QTableWidgetItem(str(value)))
-                                
-                                table.setItem(row, 2, QTableWidgetItem(sub_value.get('unit', '')))
-                                
-                                ref = sub_value.get('ref', '')
-                                ref_item = QTableWidgetItem(str(ref) if ref else "")
-                                table.setItem(row, 3, ref_item)
-                                
-                                # Add tooltip to reference cell
-                                if ref:
-                                    self._set_reference_tooltip(ref_item, ref)
-                                
-                                if highlight_overrides and ref == "USER_OVERRIDE":
-                                    self._highlight_row(table, row)
-                                
-                                row += 1
-                            elif isinstance(sub_value, list):
-                                # List of sub-entries
-                                for sub_entry in sub_value:
-                                    if isinstance(sub_entry, dict):
-                                        table.insertRow(row)
-                                        table.setItem(row, 0, QTableWidgetItem(f"models.{model_type}.{param_name}.{sub_name}"))
-                                        
-                                        value = sub_entry.get('value')
-                                        if value is None or value == '':
-                                            table.setItem(row, 1, QTableWidgetItem("(null)"))
-                                            self._set_empty_style(table, row)
-                                        else:
-                                            table.setItem(row, 1, QTableWidgetItem(str(value)))
-                                        
-                                        table.setItem(row, 2, QTableWidgetItem(sub_entry.get('unit', '')))
-                                        
-                                        ref = sub_entry.get('ref', '')
-                                        ref_item = QTableWidgetItem(str(ref) if ref else "")
-                                        table.setItem(row, 3, ref_item)
-                                        
-                                        # Add tooltip to reference cell
-                                        if ref:
-                                            self._set_reference_tooltip(ref_item, ref)
-                                        
-                                        if highlight_overrides and ref == "USER_OVERRIDE":
-                                            self._highlight_row(table, row)
-                                        
-                                        row += 1
+    def _on_diff_toggled(self, checked):
+        """Switch the Active View between all rows and changes vs. the original."""
+        self.active_view_tab.model().set_diff_mode(checked)
     
     def _load_overrides_comparison(self, original_data, override_data, overrides_list):
         """
@@ -569,55 +309,3 @@ class PropertyViewer(QWidget):
             item = table.item(row, col)
             if item:
                 item.setBackground(color)
-    
-    def _set_empty_style(self, table, row):
-        """
-        Style empty/null values with gray text.
-        
-        Args:
-            table: QTableWidget
-            row: Row number
-        """
-        gray = QColor(120, 120, 120)
-        for col in range(4):
-            item = table.item(row, col)
-            if item:
-                item.setForeground(gray)
-    
-    def _set_reference_tooltip(self, item, ref_value):
-        """
-        Add tooltip to reference cell showing full citation.
-        
-        Args:
-            item: QTableWidgetItem for the reference cell
-            ref_value: Reference ID (string or number)
-        """
-        if not ref_value or ref_value == "USER_OVERRIDE":
-            return
-        
-        try:
-            # Extract numeric ID from reference string
-            ref_id = None
-            if isinstance(ref_value, (int, float)):
-                ref_id = int(ref_value)
-            elif isinstance(ref_value, str) and ref_value.strip().isdigit():
-                ref_id = int(ref_value.strip())
-            
-            if ref_id and hasattr(self, 'reference_cache'):
-                # Look up reference in cache (populated when material is loaded)
-                ref_data = self.reference_cache.get(ref_id)
-                
-                if ref_data:
-                    # Create rich tooltip with full citation
-                    tooltip = f"""<b>Reference #{ref_id}</b><br>
-<i>{ref_data.get('title', 'No title')}</i><br>
-<br>
-<b>Author:</b> {ref_data.get('author', 'Unknown')}<br>
-<b>Year:</b> {ref_data.get('year', '--')}<br>
-<b>Type:</b> {ref_data.get('ref_type', 'unknown')}<br>
-<b>Journal:</b> {ref_data.get('journal', '--')}<br>
-<b>Volume:</b> {ref_data.get('volume', '--')}, <b>Pages:</b> {ref_data.get('pages', '--')}
-"""
-                    item.setToolTip(tooltip)
-        except (ValueError, TypeError):
-            pass  # Invalid reference format, skip tooltip
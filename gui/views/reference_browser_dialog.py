@@ -3,6 +3,10 @@ Reference Browser Dialog
 
 Standalone dialog to browse ALL references in the database.
 Provides search, filter, and detailed view capabilities.
+
+Searching runs a ranked full-text query in the database and loads one page
+of results at a time (more are fetched as the table is scrolled), so the
+bibliography is never loaded and filtered in full.
 """
 
 from PyQt6.QtWidgets import (
@@ -10,7 +14,7 @@ from PyQt6.QtWidgets import (
     QTableWidgetItem, QLabel, QPushButton, QLineEdit,
     QComboBox, QHeaderView, QMessageBox, QFileDialog
 )
-from PyQt6.QtCore import Qt
+from PyQt6.QtCore import Qt, QTimer
 from PyQt6.QtGui import QColor
 
 
@@ -19,19 +23,29 @@ class ReferenceBrowserDialog(QDialog):
     Dialog to browse all references in the database.
     
     Features:
-    - View all 124 references
+    - Browse all references, a page at a time
     - Filter by type (article, conference, report, etc.)
-    - Search by author, title, or year
+    - Ranked search by author, title, journal or year (matches highlighted in tooltips)
     - View details of any reference
     - See which materials use each reference
     - Export all references
     """
     
+    PAGE_SIZE = 200
+    SEARCH_DELAY_MS = 150  # Wait for typing to pause before querying
+    
     def __init__(self, ref_querier, parent=None):
         super().__init__(parent)
         self.ref_querier = ref_querier
-        self.all_references = []
-        self.filtered_references = []
+        self.total_references = 0
+        self.filtered_count = 0
+        self.filtered_references = []  # Rows loaded so far for the current search
+        self.has_more = False
+        
+        self._search_timer = QTimer(self)
+        self._search_timer.setSingleShot(True)
+        self._search_timer.setInterval(self.SEARCH_DELAY_MS)
+        self._search_timer.timeout.connect(self.apply_filters)
         
         self.setWindowTitle("Browse All References")
         self.setGeometry(200, 100, 1200, 700)
@@ -53,8 +67,8 @@ class ReferenceBrowserDialog(QDialog):
         # Search box
         filter_layout.addWidget(QLabel("Search:"))
         self.search_box = QLineEdit()
-        self.search_box.setPlaceholderText("Search by author, title, or year...")
-        self.search_box.textChanged.connect(self.apply_filters)
+        self.search_box.setPlaceholderText("Search by author, title, journal or year...")
+        self.search_box.textChanged.connect(self._search_timer.start)
         filter_layout.addWidget(self.search_box)
         
         # Type filter
@@ -94,8 +108,9 @@ class ReferenceBrowserDialog(QDialog):
         header.setSectionResizeMode(5, QHeaderView.ResizeMode.Interactive)       # Journal
         header.setSectionResizeMode(6, QHeaderView.ResizeMode.Interactive)       # Used By
         
-        # Enable sorting
-        self.table.setSortingEnabled(True)
+        # Rows arrive in rank order (no sorting: pages are appended while scrolling)
+        self.table.setSortingEnabled(False)
+        self.table.verticalScrollBar().valueChanged.connect(self._on_scrolled)
         
         # Read-only
         self.table.setEditTriggers(QTableWidget.EditTrigger.NoEditTriggers)
@@ -130,12 +145,10 @@ class ReferenceBrowserDialog(QDialog):
         self.table.itemSelectionChanged.connect(self.on_selection_changed)
     
     def load_references(self):
-        """Load all references from database."""
+        """Load the first page of references from database."""
         try:
-            self.all_references = self.ref_querier.list_all_references()
-            self.filtered_references = self.all_references.copy()
-            self.populate_table()
-            self.update_count_label()
+            self.total_references = self.ref_querier.count_references()
+            self.apply_filters()
         except Exception as e:
             QMessageBox.critical(
                 self,
@@ -143,12 +156,31 @@ class ReferenceBrowserDialog(QDialog):
                 f"Failed to load references:\n{str(e)}"
             )
     
-    def populate_table(self):
-        """Populate table with filtered references."""
-        self.table.setSortingEnabled(False)
-        self.table.setRowCount(0)
-        
-        for ref in self.filtered_references:
+    def _current_filters(self):
+        """(search text, reference type or None)"""
+        selected_type = self.type_filter.currentText()
+        return self.search_box.text(), (None if selected_type == "All Types" else selected_type)
+    
+    def load_more(self):
+        """Fetch the next page of the current search."""
+        search_text, ref_type = self._current_filters()
+        after = self.filtered_references[-1] if self.filtered_references else None
+        page = self.ref_querier.search_references(
+            search_text, ref_type=ref_type, limit=self.PAGE_SIZE, after=after)
+        self.has_more = len(page) == self.PAGE_SIZE
+        self.filtered_references.extend(page)
+        self.populate_table(page)
+    
+    def _on_scrolled(self, value):
+        """Load the next page when the table is scrolled to the end."""
+        if self._search_timer.isActive():
+            return  # A new search is about to replace the rows
+        if self.has_more and value >= self.table.verticalScrollBar().maximum():
+            self.load_more()
+    
+    def populate_table(self, references):
+        """Append references to the table."""
+        for ref in references:
             row_position = self.table.rowCount()
             self.table.insertRow(row_position)
             
@@ -158,7 +190,7 @@ class ReferenceBrowserDialog(QDialog):
             self.table.setItem(row_position, 0, id_item)
             
             # Type
-            ref_type = ref.get('ref_type', '')
+            ref_type = ref.get('ref_type') or ''
             type_item = QTableWidgetItem(ref_type)
             type_item.setTextAlignment(Qt.AlignmentFlag.AlignCenter)
             
@@ -174,25 +206,25 @@ class ReferenceBrowserDialog(QDialog):
             
             self.table.setItem(row_position, 1, type_item)
             
-            # Author
-            author = ref.get('author', 'Unknown')
+            # Author (tooltip highlights the matched words)
+            author = ref.get('author') or 'Unknown'
             if len(author) > 30:
                 author = author[:27] + '...'
             author_item = QTableWidgetItem(author)
-            author_item.setToolTip(ref.get('author', 'Unknown'))
+            author_item.setToolTip(ref.get('author_headline') or ref.get('author') or 'Unknown')
             self.table.setItem(row_position, 2, author_item)
             
             # Year
-            year_item = QTableWidgetItem(ref.get('year', '--'))
+            year_item = QTableWidgetItem(ref.get('year') or '--')
             year_item.setTextAlignment(Qt.AlignmentFlag.AlignCenter)
             self.table.setItem(row_position, 3, year_item)
             
-            # Title
-            title = ref.get('title', 'No title')
+            # Title (tooltip highlights the matched words)
+            title = ref.get('title') or 'No title'
             if len(title) > 50:
                 title = title[:47] + '...'
             title_item = QTableWidgetItem(title)
-            title_item.setToolTip(ref.get('title', 'No title'))
+            title_item.setToolTip(ref.get('title_headline') or ref.get('title') or 'No title')
             self.table.setItem(row_position, 4, title_item)
             
             # Journal
@@ -200,7 +232,7 @@ class ReferenceBrowserDialog(QDialog):
             if journal and len(journal) > 30:
                 journal = journal[:27] + '...'
             journal_item = QTableWidgetItem(journal or '--')
-            journal_item.setToolTip(ref.get('journal', '--'))
+            journal_item.setToolTip(ref.get('journal') or '--')
             self.table.setItem(row_position, 5, journal_item)
             
             # Used By (fetch materials using this reference)
@@ -218,36 +250,22 @@ class ReferenceBrowserDialog(QDialog):
                 self.table.setItem(row_position, 6, used_by_item)
             except:
                 self.table.setItem(row_position, 6, QTableWidgetItem("--"))
-        
-        self.table.setSortingEnabled(True)
-        self.table.sortItems(0, Qt.SortOrder.AscendingOrder)
     
     def apply_filters(self):
-        """Apply search and type filters."""
-        search_text = self.search_box.text().lower()
-        selected_type = self.type_filter.currentText()
-        
-        self.filtered_references = []
+        """Run the search and type filter in the database (first page)."""
+        self._search_timer.stop()
+        search_text, ref_type = self._current_filters()
         
-        for ref in self.all_references:
-            # Type filter
-            if selected_type != "All Types" and ref.get('ref_type') != selected_type:
-                continue
-            
-            # Search filter
-            if search_text:
-                author = ref.get('author', '').lower()
-                title = ref.get('title', '').lower()
-                year = ref.get('year', '').lower()
-                journal = ref.get('journal', '').lower()
-                
-                if not (search_text in author or search_text in title or 
-                        search_text in year or search_text in journal):
-                    continue
-            
-            self.filtered_references.append(ref)
+        try:
+            self.filtered_count = self.ref_querier.count_references(search_text, ref_type)
+            self.filtered_references = []
+            self.table.setRowCount(0)
+            self.load_more()
+        except Exception as e:
+            print(f"❌ Reference search failed: {e}")
+            self.count_label.setText("Search failed")
+            return
         
-        self.populate_table()
         self.update_count_label()
     
     def reset_filters(self):
@@ -257,8 +275,8 @@ class ReferenceBrowserDialog(QDialog):
     
     def update_count_label(self):
         """Update the count label."""
-        total = len(self.all_references)
-        filtered = len(self.filtered_references)
+        total = self.total_references
+        filtered = self.filtered_count
         
         if filtered == total:
             self.count_label.setText(f"Showing all {total} references")
@@ -283,12 +301,14 @@ class ReferenceBrowserDialog(QDialog):
         row = selected_rows[0].row()
         ref_id = int(self.table.item(row, 0).text())
         
-        # Find the reference data
+        # Find the reference data (loaded rows first)
         ref_data = None
-        for ref in self.all_references:
+        for ref in self.filtered_references:
             if ref.get('reference_id') == ref_id:
                 ref_data = ref
                 break
+        if ref_data is None:
+            ref_data = self.ref_querier.get_reference_by_id(ref_id)
         
         if not ref_data:
             return
@@ -335,12 +355,15 @@ class ReferenceBrowserDialog(QDialog):
             return
         
         try:
+            count = self.ref_querier.count_references()
+            
             # Create XML content
             with open(file_path, 'w', encoding='utf-8') as f:
                 f.write('<?xml version="1.0" encoding="UTF-8"?>\n')
-                f.write(f'<references database="Materials_DB" count="{len(self.all_references)}">\n')
+                f.write(f'<references database="Materials_DB" count="{count}">\n')
                 
-                for ref in self.all_references:
+                # Streamed: written as rows arrive
+                for ref in self.ref_querier.iter_references():
                     f.write('  <reference>\n')
                     f.write(f'    <id>{ref.get("reference_id", "")}</id>\n')
                     f.write(f'    <type>{ref.get("ref_type", "misc")}</type>\n')
@@ -363,7 +386,7 @@ class ReferenceBrowserDialog(QDialog):
             QMessageBox.information(
                 self,
                 "Export Successful",
-                f"All {len(self.all_references)} references exported to XML:\n{file_path}"
+                f"All {count} references exported to XML:\n{file_path}"
             )
         
         except Exception as e:
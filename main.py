@@ -10,6 +10,7 @@ Usage:
     python main.py export <material_name>                    # Export material to XML
     python main.py export-all                                # Export all materials
     python main.py query <material_name>                     # Query and display material data
+    python main.py query-path <path_query> [material1,material2,...]  # Query one path across materials
     python main.py reset                                     # Reset database (WARNING: deletes all data)
     
     # Override commands
@@ -17,15 +18,30 @@ Usage:
     python main.py set-override <material> <path> <value>    # Set value override
     python main.py list-overrides <material>                 # List all overrides
     python main.py clear-overrides <material> [path]         # Clear overrides
+    python main.py import-overrides <file> [material] [--replace]  # Apply overrides XML (one transaction)
+    python main.py export-overrides <material> [file]        # Write overrides XML
     
     # References commands
     python main.py import-references                         # Import References.xml into database
     python main.py query-reference <id>                      # Query specific reference by ID
     python main.py list-references                           # List all references
     python main.py material-references <material>            # Show refs used by material
+    
+    # Physics commands
+    python main.py impedance-match <flyer> <target[,layer2,...]> <velocity_km_s>
+    python main.py impedance-match all <velocity_km_s[,v2,...]>  # Solve every material pair
+    python main.py hydro <flyer[:mm]> <target[:mm][,layer2[:mm],...]> <velocity_km_s> [t_end_us] [out.npz] [--strength] [--burn]
+    python main.py hydro benchmark [n_cells]                 # Hydrocode throughput
+    python main.py off-hugoniot <release|reshock> <material> <P_GPa[,P2,...]> [out.csv|out.parquet]
+    python main.py critical-temperature [all|material[,m2,...]] [output_dir]  # Regenerate FK tables
+    python main.py formulation show [all|formulation]        # Derived vs measured mixture properties
+    python main.py formulation set <formulation> <material:fraction[,...]>
+    python main.py formulation sweep <material,material[,...]> [step] [out.csv]
+    python main.py uncertainty <material> <hugoniot|eos|jc> [n_samples] [out.csv|out.png]  # Monte Carlo bands
 """
 import sys
 import os
+import time
 import argparse
 import json
 from pathlib import Path
@@ -41,6 +57,9 @@ from parser.xml_parser import parse_material_xml
 from export.xml_exporter import export_material_to_xml
 from config import XML_DIR, EXPORT_DIR
 
+# Materials loaded per round of export-all
+EXPORT_BATCH_SIZE = 50
+
 
 class MaterialDatabaseCLI:
     """Command-line interface for Material Database Engine."""
@@ -147,19 +166,20 @@ class MaterialDatabaseCLI:
     def list_materials(self):
         """List all materials in database."""
         querier = MaterialQuerier(self.db)
-        materials = querier.list_materials()
+        count = querier.count_materials()
         
-        if not materials:
+        if not count:
             print("No materials found in database.")
             print("Use 'python main.py import-all' to import materials.")
             return
         
-        print(f"\nMaterials in database: {len(materials)}")
+        print(f"\nMaterials in database: {count}")
         print("=" * 70)
         print(f"{'ID':<5} {'Name':<20} {'XML ID':<20} {'Version':<15}")
         print("-" * 70)
         
-        for mat in materials:
+        # Streamed: rows print as they arrive
+        for mat in querier.iter_materials():
             print(f"{mat['material_id']:<5} {mat['name']:<20} {mat['xml_id']:<20} {mat['version'] or 'N/A':<15}")
         
         print("=" * 70)
@@ -352,6 +372,35 @@ class MaterialDatabaseCLI:
                         unit = param_data.get('unit') or ''
                         print(f"      {param_name}: {value} {unit}".strip())
     
+    def query_path(self, path_query: str, materials: str = None):
+        """
+        Show stored values matching a path query across materials.
+        
+        Args:
+            path_query: Path query (e.g. "EOSModel.Row[*].K0")
+            materials: Material names separated by commas (all if None)
+        """
+        querier = MaterialQuerier(self.db)
+        names = [name.strip() for name in materials.split(',')] if materials else None
+        try:
+            results = querier.query_path(path_query, names)
+        except (ValueError, RuntimeError) as e:
+            print(f"✗ {e}")
+            return
+        
+        if not results:
+            print(f"✗ No values found for: {path_query}")
+            return
+        
+        print(f"\n{'='*90}")
+        print(f"PATH: {path_query}  ({len(results)} value(s))")
+        print(f"{'='*90}")
+        print(f"{'Material':<20} {'Path':<45} {'Value':<12} {'Unit':<10}")
+        print("-" * 90)
+        for row in results:
+            print(f"{row['material']:<20} {row['path']:<45} {row['value'] or '':<12} {row['unit'] or '':<10}")
+        print(f"{'='*90}\n")
+    
     def export_material(self, material_name: str):
         """
         Export material to XML file.
@@ -378,6 +427,10 @@ class MaterialDatabaseCLI:
             print(f"✗ Material not found: {material_name}")
             return
         
+        self._write_export(material_name, material_data, has_overrides)
+    
+    def _write_export(self, material_name: str, material_data, has_overrides: bool):
+        """Write one material XML file to EXPORT_DIR."""
         # Set filename based on whether overrides exist
         if has_overrides:
             output_filename = f"{material_name}_Override_exported.xml"
@@ -401,26 +454,36 @@ class MaterialDatabaseCLI:
     def export_all(self):
         """Export all materials to XML files."""
         querier = MaterialQuerier(self.db)
-        materials = querier.list_materials()
+        count = querier.count_materials()
         
-        if not materials:
+        if not count:
             print("No materials found in database.")
             return
         
-        print(f"\nExporting {len(materials)} materials")
+        print(f"\nExporting {count} materials")
         print("=" * 50)
         
+        storage = self._get_override_storage()
         success_count = 0
         fail_count = 0
         
-        for mat in materials:
-            try:
-                self.export_material(mat['name'])
-                success_count += 1
-            except Exception as e:
-                print(f"✗ Failed to export {mat['name']}: {e}")
-                fail_count += 1
-            print()
+        # One page of materials at a time: documents and overrides are
+        # fetched per page, not per material
+        page = querier.list_materials_page(limit=EXPORT_BATCH_SIZE)
+        while page:
+            ids = [mat['material_id'] for mat in page]
+            overridden = storage.materials_with_overrides(ids)
+            materials = querier.get_materials_by_ids(ids)
+            for mat in page:
+                try:
+                    self._write_export(mat['name'], materials[mat['material_id']],
+                                       mat['material_id'] in overridden)
+                    success_count += 1
+                except Exception as e:
+                    print(f"✗ Failed to export {mat['name']}: {e}")
+                    fail_count += 1
+                print()
+            page = querier.list_materials_page(limit=EXPORT_BATCH_SIZE, after=page[-1])
         
         print("=" * 50)
         print(f"Export complete: {success_count} succeeded, {fail_count} failed")
@@ -574,6 +637,78 @@ class MaterialDatabaseCLI:
             import traceback
             traceback.print_exc()
     
+    def import_overrides(self, file_path: str, material_name: str = None, replace: bool = False):
+        """
+        Import an overrides XML file in a single transaction.
+        
+        Args:
+            file_path: Path to overrides XML file
+            material_name: Target material (default: the file's material attribute)
+            replace: Clear the material's existing overrides first
+        """
+        from overrides.override_xml import read_overrides_material, import_overrides_xml
+        
+        if not os.path.exists(file_path):
+            print(f"✗ File not found: {file_path}")
+            return
+        
+        try:
+            material_name = material_name or read_overrides_material(file_path)
+        except Exception as e:
+            print(f"✗ Failed to read {file_path}: {e}")
+            return
+        
+        material_id = self._get_material_id(material_name) if material_name else None
+        if material_id is None:
+            print(f"✗ Material not found: {material_name}")
+            return
+        
+        storage = self._get_override_storage()
+        
+        print(f"\nImporting overrides for: {material_name}")
+        print(f"File: {file_path}")
+        if replace:
+            print("Existing overrides will be replaced")
+        print("-" * 50)
+        
+        try:
+            start = time.perf_counter()
+            stats = import_overrides_xml(storage, file_path, material_id, replace=replace)
+            elapsed = (time.perf_counter() - start) * 1000
+            print(f"\n✓ Saved {stats['saved']} override(s) in {elapsed:.1f} ms")
+            if stats['skipped']:
+                print(f"⚠ Skipped {stats['skipped']} of {stats['read']} entries without a value or reference")
+        except Exception as e:
+            print(f"\n✗ Failed to import overrides (nothing was saved): {e}")
+            import traceback
+            traceback.print_exc()
+    
+    def export_overrides(self, material_name: str, file_path: str = None):
+        """
+        Export a material's overrides to XML.
+        
+        Args:
+            material_name: Name of material
+            file_path: Output path (default: EXPORT_DIR/<material>_Overrides.xml)
+        """
+        from overrides.override_xml import export_overrides_xml
+        
+        material_id = self._get_material_id(material_name)
+        if material_id is None:
+            print(f"✗ Material not found: {material_name}")
+            return
+        
+        file_path = file_path or os.path.join(EXPORT_DIR, f"{material_name}_Overrides.xml")
+        storage = self._get_override_storage()
+        
+        try:
+            count = export_overrides_xml(storage, material_id, material_name, file_path)
+            print(f"\n✓ Exported {count} override(s) to: {file_path}")
+        except Exception as e:
+            print(f"\n✗ Export failed: {e}")
+            import traceback
+            traceback.print_exc()
+    
     def _get_material_id(self, material_name: str) -> int:
         """Get material ID from name."""
         conn = self.db.connect()
@@ -666,19 +801,19 @@ class MaterialDatabaseCLI:
         from db.query import ReferenceQuerier
         
         querier = ReferenceQuerier(self.db)
-        references = querier.list_all_references()
+        count = querier.count_references()
         
-        if not references:
+        if not count:
             print("No references found in database. Run 'python main.py import-references' first.")
             return
         
         print(f"\n{'='*100}")
-        print(f"ALL REFERENCES ({len(references)} total)")
+        print(f"ALL REFERENCES ({count} total)")
         print(f"{'='*100}")
         print(f"{'ID':<5} {'Type':<12} {'Author':<30} {'Year':<6} {'Title':<40}")
         print(f"{'-'*5} {'-'*12} {'-'*30} {'-'*6} {'-'*40}")
         
-        for ref in references:
+        for ref in querier.iter_references():
             author = (ref['author'] or '')[:30]
             title = (ref['title'] or '')[:40]
             ref_type = (ref['ref_type'] or '')[:12]
@@ -720,6 +855,580 @@ class MaterialDatabaseCLI:
         
         print(f"{'='*100}\n")
     
+    # ====================================================================
+    # PHYSICS COMMANDS
+    # ====================================================================
+    
+    def _load_hugoniot_table(self):
+        """Load linear Us-Up parameters for all materials."""
+        from Visualization.visualization_service import VisualizationDataService
+        from physics.impedance import HugoniotTable
+        
+        with VisualizationDataService() as service:
+            return HugoniotTable.from_service(service)
+    
+    def impedance_match(self, flyer: str, targets: str, velocity: str):
+        """
+        Solve plate-impact interface states.
+        
+        Args:
+            flyer: Flyer material name, or 'all' for every material pair
+            targets: Target layer names separated by commas (impact side first),
+                     or the velocity list when flyer is 'all'
+            velocity: Impact velocity in km/s (ignored when flyer is 'all')
+        """
+        from physics.impedance import solve_matrix, solve_stack
+        
+        table = self._load_hugoniot_table()
+        
+        if len(table) == 0:
+            print("✗ No materials with Us-Up parameters found")
+            return
+        
+        if flyer == 'all':
+            try:
+                velocities = [float(v) for v in targets.split(',')]
+            except ValueError:
+                print(f"✗ Invalid velocity list: {targets}")
+                return
+            
+            result = solve_matrix(table, velocities)
+            n_cases = result['up'].size
+            
+            print(f"\n{'='*80}")
+            print(f"IMPEDANCE MATCH: {len(table)} x {len(table)} materials x {len(velocities)} velocities")
+            print(f"{'='*80}")
+            print(f"Solved {n_cases} cases in {result['elapsed_s']*1000:.3f} ms")
+            
+            for k, v in enumerate(result['velocities']):
+                print(f"\nInterface pressure (GPa) at {v:.3f} km/s  [rows: flyer, columns: target]")
+                print(f"{'':<14}" + "".join(f"{name[:10]:>11}" for name in result['targets']))
+                for i, name in enumerate(result['flyers']):
+                    row = "".join(f"{result['P'][i, j, k]:>11.3f}" for j in range(len(result['targets'])))
+                    print(f"{name[:13]:<14}{row}")
+            print(f"{'='*80}\n")
+            return
+        
+        try:
+            impact_velocity = float(velocity)
+        except (TypeError, ValueError):
+            print(f"✗ Invalid velocity: {velocity}")
+            return
+        
+        layers = [t.strip() for t in targets.split(',') if t.strip()]
+        missing = [name for name in [flyer] + layers if name not in table]
+        if missing:
+            print(f"✗ No Us-Up parameters for: {', '.join(missing)}")
+            return
+        
+        interfaces = solve_stack(table, flyer, layers, impact_velocity)
+        
+        print(f"\n{'='*80}")
+        print(f"IMPEDANCE MATCH: {flyer} -> {' / '.join(layers)} at {impact_velocity:.3f} km/s")
+        print(f"{'='*80}")
+        print(f"{'Interface':<30} {'Up (km/s)':>12} {'P (GPa)':>12} {'Us (km/s)':>12} {'V/V0':>10}")
+        print("-" * 80)
+        for iface in interfaces:
+            label = f"{iface['upstream']} | {iface['downstream']}"
+            print(f"{label:<30} {float(iface['up'][0]):>12.4f} {float(iface['P'][0]):>12.3f} "
+                  f"{float(iface['us_target'][0]):>12.4f} {float(iface['v_ratio_target'][0]):>10.4f}")
+        print(f"{'='*80}\n")
+    
+    def _parse_layer_spec(self, spec: str, default_mm: float):
+        """Parse 'Name' or 'Name:thickness_mm' into (name, thickness_m)."""
+        name, _, thickness = spec.partition(':')
+        return name.strip(), float(thickness or default_mm) * 1.0e-3
+    
+    def hydro(self, flyer: str, targets: str, velocity: str,
+              t_end_us: str = None, output: str = None,
+              strength: bool = False, burn: bool = False):
+        """
+        Run a 1-D planar plate-impact simulation.
+        
+        Us-Up slopes from the visualization database take precedence
+        when available (most database EOS rows carry no slope).
+        
+        Args:
+            flyer: Flyer material, optionally 'Name:thickness_mm' (default 2 mm)
+            targets: Target layers separated by commas, impact side first
+                     (default 5 mm each)
+            velocity: Impact velocity in km/s
+            t_end_us: End time in microseconds (default: 2 target transit times)
+            output: Path for the compressed .npz time histories
+            strength: Enable Johnson-Cook strength on layers that have the constants
+            burn: Enable Arrhenius burn on layers with kinetics and a reacted JWL row
+        """
+        import numpy as np
+        from physics.hydrocode import HydroMaterial, Layer, LagrangianHydro
+        
+        try:
+            impact_velocity = float(velocity) * 1.0e3
+            specs = [self._parse_layer_spec(flyer, 2.0)]
+            specs += [self._parse_layer_spec(t, 5.0) for t in targets.split(',') if t.strip()]
+        except ValueError:
+            print("✗ Invalid layer specification or velocity")
+            return
+        
+        try:
+            hugoniots = self._load_hugoniot_table()
+        except Exception:
+            hugoniots = None
+        
+        querier = MaterialQuerier(self.db)
+        materials = {}
+        for name, _ in specs:
+            if name in materials:
+                continue
+            overrides = None
+            if hugoniots is not None and name in hugoniots:
+                overrides = {'s': hugoniots.get(name)['s']}
+            try:
+                materials[name] = HydroMaterial.from_querier(querier, name, overrides=overrides,
+                                                             strength=strength, burn=burn,
+                                                             required=False)
+            except ValueError as e:
+                print(f"✗ {e}")
+                return
+        
+        if strength and not any(m.strength for m in materials.values()):
+            print("⚠ --strength: no layer has Johnson-Cook constants")
+        if burn and not any(m.burn for m in materials.values()):
+            print("⚠ --burn: no layer has kinetics and a reacted JWL row")
+        
+        cells_per_mm = 50
+        layers = [Layer(materials[name], thickness, max(int(thickness * 1.0e3 * cells_per_mm), 10),
+                        velocity=impact_velocity if i == 0 else 0.0)
+                  for i, (name, thickness) in enumerate(specs)]
+        sim = LagrangianHydro(layers)
+        
+        # Gauges at every interface and at mid-thickness of each target layer
+        edges = np.cumsum([0.0] + [layer.thickness for layer in layers])
+        stations = []
+        for left, right in zip(edges[1:-1], edges[2:]):
+            stations.extend([float(left), float(0.5 * (left + right))])
+        
+        if t_end_us is not None:
+            t_end = float(t_end_us) * 1.0e-6
+        else:
+            # Two target transit times at the slowest ambient sound speed
+            t_end = 2.0 * (edges[-1] - edges[1]) / float(np.min(sim.c))
+        
+        history = sim.run(t_end, stations=stations)
+        
+        print(f"\n{'='*80}")
+        print(f"HYDRO: {' / '.join(f'{l.material.name} ({l.thickness*1e3:g} mm)' for l in layers)}"
+              f" at {float(velocity):.3f} km/s")
+        print(f"{'='*80}")
+        for material in materials.values():
+            print(f"  {material}")
+        print(f"  {sim.n_cells} cells, {history.metadata['steps']} steps to {t_end*1e6:.3f} μs "
+              f"({history.metadata['cell_updates_per_s']/1e6:.2f} M cell-updates/s)")
+        print(f"\n{'Gauge (mm)':>12} {'Peak P (GPa)':>14} {'Peak Up (km/s)':>16} {'Arrival (μs)':>14}")
+        print("-" * 80)
+        for k, x in enumerate(stations):
+            pressure = history['pressure'][:, k]
+            peak = float(pressure.max())
+            arrived = np.nonzero(pressure > 0.5 * peak)[0] if peak > 0.0 else []
+            arrival = f"{history['t'][arrived[0]]*1e6:>14.3f}" if len(arrived) else f"{'-':>14}"
+            print(f"{x*1e3:>12.3f} {peak/1e9:>14.3f} {float(history['velocity'][:, k].max())/1e3:>16.4f} {arrival}")
+        
+        if output:
+            history.save(output)
+            print(f"\n✓ Time histories written to: {output}")
+        print(f"{'='*80}\n")
+    
+    def hydro_benchmark(self, n_cells: str):
+        """
+        Measure hydrocode throughput.
+        
+        Args:
+            n_cells: Number of cells
+        """
+        from physics.hydrocode import benchmark
+        
+        stats = benchmark(n_cells=int(n_cells))
+        print(f"\n{'='*80}")
+        print(f"HYDRO BENCHMARK: {stats['n_cells']} cells x {stats['steps']} steps")
+        print(f"{'='*80}")
+        print(f"  Elapsed:      {stats['elapsed_s']:.3f} s")
+        print(f"  Throughput:   {stats['cell_updates_per_s']/1e6:.2f} M cell-updates/s")
+        print(f"{'='*80}\n")
+    
+    def off_hugoniot(self, kind: str, material_name: str, pressures: str, output: str = None):
+        """
+        Generate release isentropes or reshock Hugoniots from Hugoniot states.
+        
+        Us-Up parameters come from the visualization database, Γ₀ from the
+        material's stored EOS/thermomechanical data (2s - 1 if absent).
+        
+        Args:
+            kind: 'release' or 'reshock'
+            material_name: Material name
+            pressures: Starting Hugoniot pressures in GPa, comma separated
+            output: Optional .csv or .parquet file for the curves
+        """
+        from physics.isentropes import OffHugoniotEngine, write_family
+        from physics.material_params import get_mie_gruneisen
+        
+        try:
+            start_pressures = [float(p) for p in pressures.split(',') if p.strip()]
+        except ValueError:
+            print(f"✗ Invalid pressure list: {pressures}")
+            return
+        
+        table = self._load_hugoniot_table()
+        if material_name not in table:
+            print(f"✗ No Us-Up parameters for: {material_name}")
+            return
+        params = table.get(material_name)
+        
+        material_data = MaterialQuerier(self.db).get_material_by_name(material_name)
+        gamma0 = get_mie_gruneisen(material_data)['gamma'] if material_data else None
+        params['gamma0'] = gamma0 if gamma0 else 2.0 * params['s'] - 1.0
+        
+        engine = OffHugoniotEngine()
+        if kind == 'release':
+            family = engine.release(material_name, params, pressures=start_pressures)
+        else:
+            family = engine.reshock(material_name, params, pressures=start_pressures)
+        
+        print(f"\n{'='*80}")
+        print(f"{kind.upper()}: {material_name}  (ρ₀ = {params['rho0']:.4f} g/cm³, C₀ = {params['C0']:.4f} km/s, "
+              f"s = {params['s']:.4f}, Γ₀ = {params['gamma0']:.3f})")
+        print(f"{'='*80}")
+        print(f"{'P start (GPa)':>14} {'Up start':>10} {'V/V0 start':>12} {'V/V0 end':>10} "
+              f"{'P end (GPa)':>12} {'Up end':>10}")
+        print("-" * 80)
+        for i in range(len(family['start']['P'])):
+            print(f"{family['start']['P'][i]:>14.3f} {family['start']['up'][i]:>10.4f} "
+                  f"{family['V_ratio'][i, 0]:>12.4f} {family['V_ratio'][i, -1]:>10.4f} "
+                  f"{family['P'][i, -1]:>12.3f} {family['up'][i, -1]:>10.4f}")
+        
+        if output:
+            try:
+                write_family(family, output)
+                print(f"\n✓ Curves written to: {output}")
+            except ImportError as e:
+                print(f"\n✗ {e}")
+        print(f"{'='*80}\n")
+    
+    def critical_temperature_tables(self, materials: str = 'all', output_dir: str = None):
+        """
+        Regenerate Frank-Kamenetskii critical temperature tables.
+        
+        Material data (with surrogates) is loaded in one batch, all tables
+        are solved in one vectorized batch, stored in
+        critical_temperature_tables and written as CSV per material.
+        
+        Args:
+            materials: 'all' for every energetic, or comma-separated names
+            output_dir: CSV directory (export/output/critical_temperature if None)
+        """
+        from physics.thermal_explosion import (
+            ENERGETICS, SURROGATES, build_tables, collect_inputs, input_hash,
+            resolve_inputs, write_table_csv
+        )
+        from db.critical_temperature_storage import CriticalTemperatureStorage
+        import numpy as np
+        
+        names = ENERGETICS if materials == 'all' else [m.strip() for m in materials.split(',') if m.strip()]
+        load_names = list(dict.fromkeys(names + [SURROGATES[n] for n in names if n in SURROGATES]))
+        
+        inputs = collect_inputs(MaterialQuerier(self.db).get_materials_by_names(load_names))
+        resolved = resolve_inputs(inputs)
+        resolved = {name: resolved[name] for name in names if name in resolved}
+        columns = build_tables(resolved)
+        
+        output_dir = output_dir or os.path.join(EXPORT_DIR, 'critical_temperature')
+        os.makedirs(output_dir, exist_ok=True)
+        storage = CriticalTemperatureStorage(self.db.connect())
+        
+        print(f"\n{'='*90}")
+        print(f"CRITICAL TEMPERATURE TABLES ({len(names)} materials)")
+        print(f"{'='*90}")
+        print(f"{'Material':<12} {'Sphere Tc (°C) @ 10 mm':>24} {'@ 100 mm':>10} {'@ 1 m':>10}  Status")
+        print("-" * 90)
+        
+        for name in names:
+            if name not in inputs:
+                print(f"{name:<12} {'':>46}  ✗ material not found")
+                continue
+            if resolved[name]['missing']:
+                print(f"{name:<12} {'':>46}  ✗ missing {', '.join(resolved[name]['missing'])}")
+                continue
+            
+            material_id = self._get_material_id(name)
+            new_hash = input_hash(resolved[name])
+            status = "unchanged" if storage.get_input_hash(material_id) == new_hash else "updated"
+            
+            mask = columns['material'] == name
+            rows = list(zip(columns['geometry'][mask], columns['size_m'][mask], columns['Tc_K'][mask],
+                            columns['induction_s'][mask], columns['kinetics_source'][mask],
+                            columns['thermal_source'][mask]))
+            storage.replace_table(material_id, rows, new_hash)
+            write_table_csv(columns, os.path.join(output_dir, f"{name}_critical_temperature.csv"), name)
+            
+            sphere = mask & (columns['geometry'] == 'sphere')
+            sizes = columns['size_m'][sphere]
+            tc = columns['Tc_C'][sphere]
+            at = [np.interp(np.log(a), np.log(sizes), tc) for a in (0.01, 0.1, 1.0)]
+            borrowed = sorted({src for src in resolved[name]['sources'].values() if src != name})
+            note = f" (inputs from {', '.join(borrowed)})" if borrowed else ""
+            print(f"{name:<12} {at[0]:>24.1f} {at[1]:>10.1f} {at[2]:>10.1f}  ✓ {status}{note}")
+        
+        print(f"\n✓ CSV tables written to: {output_dir}")
+        print(f"{'='*90}\n")
+    
+    def _load_constituent_table(self, names):
+        """
+        Load mixture-rule inputs for many materials with one batch query.
+        Us-Up parameters from the Hugoniot table take precedence when available.
+        """
+        from physics.mixtures import ConstituentTable
+        
+        materials = MaterialQuerier(self.db).get_materials_batch(names)
+        
+        try:
+            hugoniots = self._load_hugoniot_table()
+            overrides = {name: hugoniots.get(name) for name in materials if name in hugoniots}
+        except Exception:
+            overrides = {}
+        
+        return ConstituentTable.from_material_data(materials, overrides)
+    
+    def formulation_show(self, formulation: str = 'all'):
+        """
+        Compare mixture-rule properties of formulations with their own data.
+        
+        Stored compositions are used when present, otherwise the nominal
+        DEFAULT_COMPOSITIONS.
+        
+        Args:
+            formulation: Formulation name, or 'all'
+        """
+        from physics.mixtures import DEFAULT_COMPOSITIONS, PROPERTY_NAMES, composition_matrix, compare_measured, evaluate
+        from db.formulation_storage import FormulationStorage
+        
+        compositions = dict(DEFAULT_COMPOSITIONS)
+        stored = FormulationStorage(self.db.connect()).get_compositions()
+        compositions.update(stored)
+        
+        if formulation != 'all':
+            if formulation not in compositions:
+                print(f"✗ No composition stored for: {formulation}")
+                return
+            compositions = {formulation: compositions[formulation]}
+        
+        names = sorted(set(compositions) | {c for comp in compositions.values() for c in comp})
+        table = self._load_constituent_table(names)
+        
+        formulations = [f for f in sorted(compositions) if all(c in table for c in compositions[f])]
+        for f in sorted(set(compositions) - set(formulations)):
+            missing = [c for c in compositions[f] if c not in table]
+            print(f"✗ {f}: constituents not found: {', '.join(missing)}")
+        if not formulations:
+            return
+        
+        weights = composition_matrix(table, [compositions[f] for f in formulations])
+        derived = evaluate(table, weights['W'])
+        units = {'rho0': 'g/cm³', 'cp': 'J/kg/K', 'C0': 'km/s', 's': '-'}
+        
+        print(f"\n{'='*80}")
+        print(f"FORMULATION MIXTURE RULES ({len(formulations)} formulations)")
+        print(f"{'='*80}")
+        
+        for i, name in enumerate(formulations):
+            source = "stored" if name in stored else "nominal"
+            parts = ", ".join(f"{c} {w:.3f}" for c, w in compositions[name].items())
+            print(f"\n{name}  [{source}: {parts}]")
+            if weights['coverage'][i] < 1.0 - 1.0e-9:
+                print(f"  ⚠ Constituents cover {weights['coverage'][i]:.1%} of the mass (renormalized)")
+            
+            measured = {}
+            if name in table:
+                j = table.index_of(name)
+                measured = {key: getattr(table, key)[j] for key in PROPERTY_NAMES}
+            
+            print(f"  {'Property':<14} {'Derived':>12} {'Measured':>12} {'Diff (%)':>10}")
+            for row in compare_measured({key: derived[key][i] for key in PROPERTY_NAMES}, measured):
+                d = f"{row['derived']:.4g}" if row['derived'] is not None else "-"
+                m = f"{row['measured']:.4g}" if row['measured'] is not None else "-"
+                diff = f"{row['difference_pct']:+.1f}" if row['difference_pct'] is not None else "-"
+                print(f"  {row['property'] + ' (' + units[row['property']] + ')':<14} {d:>12} {m:>12} {diff:>10}")
+        
+        print(f"{'='*80}\n")
+    
+    def formulation_set(self, formulation: str, spec: str):
+        """
+        Store the composition of a formulation.
+        
+        Args:
+            formulation: Formulation material name
+            spec: Comma-separated material:mass_fraction pairs
+        """
+        from db.formulation_storage import FormulationStorage
+        
+        try:
+            fractions = {}
+            for part in spec.split(','):
+                name, fraction = part.rsplit(':', 1)
+                fractions[name.strip()] = float(fraction)
+        except ValueError:
+            print(f"✗ Invalid composition: {spec} (expected material:fraction[,...])")
+            return
+        
+        formulation_id = self._get_material_id(formulation)
+        if not formulation_id:
+            print(f"✗ Material not found: {formulation}")
+            return
+        
+        ids = {}
+        for name in fractions:
+            ids[name] = self._get_material_id(name)
+            if not ids[name]:
+                print(f"✗ Material not found: {name}")
+                return
+        
+        try:
+            FormulationStorage(self.db.connect()).set_composition(
+                formulation_id, {ids[name]: w for name, w in fractions.items()}
+            )
+        except ValueError as e:
+            print(f"✗ {e}")
+            return
+        
+        total = sum(fractions.values())
+        print(f"✓ Stored composition for {formulation}: "
+              + ", ".join(f"{name} {w:.3f}" for name, w in fractions.items()))
+        if total < 1.0 - 1.0e-9:
+            print(f"  ⚠ {1.0 - total:.1%} of the mass is not linked to a database material")
+    
+    def formulation_sweep(self, constituents: str, step: str = '0.01', output: str = None):
+        """
+        Evaluate mixture properties over a composition grid.
+        
+        Args:
+            constituents: Comma-separated constituent names
+            step: Mass fraction increment
+            output: Optional CSV path for every composition
+        """
+        import csv
+        import numpy as np
+        from physics.mixtures import composition_grid, evaluate
+        
+        names = [c.strip() for c in constituents.split(',') if c.strip()]
+        try:
+            step = float(step)
+        except ValueError:
+            print(f"✗ Invalid step: {step}")
+            return
+        
+        table = self._load_constituent_table(names)
+        missing = [n for n in names if n not in table]
+        if missing:
+            print(f"✗ Materials not found: {', '.join(missing)}")
+            return
+        table = table.subset(names)
+        
+        W = composition_grid(len(names), step)
+        result = evaluate(table, W)
+        
+        print(f"\n{'='*80}")
+        print(f"COMPOSITION SWEEP: {' / '.join(names)} (step {step})")
+        print(f"{'='*80}")
+        print(f"Evaluated {len(W)} compositions in {result['elapsed_s']*1000:.2f} ms")
+        
+        for key, label in (('rho0', 'Density (g/cm³)'), ('cp', 'Cp (J/kg/K)'), ('C0', 'C0 (km/s)'), ('s', 's (-)')):
+            values = result[key]
+            if np.isnan(values).all():
+                print(f"  {label:<18} - (missing constituent data)")
+                continue
+            lo, hi = np.nanargmin(values), np.nanargmax(values)
+            fmt = lambda i: "/".join(f"{w:.2f}" for w in W[i])
+            print(f"  {label:<18} {values[lo]:>10.4g} [{fmt(lo)}]  to {values[hi]:>10.4g} [{fmt(hi)}]")
+        
+        if output:
+            with open(output, 'w', newline='') as f:
+                writer = csv.writer(f)
+                writer.writerow(names + ['rho0_g_cc', 'cp_J_kgK', 'C0_km_s', 's'])
+                for row in zip(W, result['rho0'], result['cp'], result['C0'], result['s']):
+                    writer.writerow(list(row[0]) + list(row[1:]))
+            print(f"\n✓ Wrote {len(W)} compositions to: {output}")
+        print(f"{'='*80}\n")
+    
+    def uncertainty(self, material_name: str, model: str, n_samples: str = '10000', output: str = None):
+        """
+        Propagate multi-reference parameter scatter through a model.
+        
+        Every stored entry of a parameter is treated as a sample; large runs
+        are split across all cores with reproducible per-chunk seeds.
+        
+        Args:
+            material_name: Material name
+            model: 'hugoniot', 'eos' or 'jc'
+            n_samples: Number of Monte Carlo samples
+            output: Optional path for the percentile bands (CSV, or a plot for .png/.pdf/.svg)
+        """
+        import numpy as np
+        from physics.uncertainty import MODELS, collect_entries, propagate, write_band
+        
+        try:
+            n_samples = int(n_samples)
+        except ValueError:
+            print(f"✗ Invalid sample count: {n_samples}")
+            return
+        
+        if model not in MODELS:
+            print(f"✗ Unknown model: {model} (expected one of {', '.join(MODELS)})")
+            return
+        
+        # Overrides would reduce preferred-reference properties to one entry
+        material_data = MaterialQuerier(self.db).get_material_by_name(material_name, apply_overrides=False)
+        if not material_data:
+            print(f"✗ Material not found: {material_name}")
+            return
+        
+        entries = collect_entries(material_data, model)
+        if model == 'hugoniot' and not len(entries['s']):
+            try:
+                hugoniots = self._load_hugoniot_table()
+                if material_name in hugoniots:
+                    entries['s'] = np.array([hugoniots.get(material_name)['s']])
+            except Exception:
+                pass
+        
+        workers = (os.cpu_count() or 1) if n_samples >= 100000 else 1
+        
+        try:
+            result = propagate(entries, model, n_samples=n_samples, workers=workers)
+        except ValueError as e:
+            print(f"✗ {material_name}: {e}")
+            return
+        
+        print(f"\n{'='*80}")
+        print(f"UNCERTAINTY: {material_name} {model} ({n_samples} samples, {result['prior']} prior, seed {result['seed']})")
+        print(f"{'='*80}")
+        print("Entries per parameter:")
+        for name, values in entries.items():
+            if len(values) > 1:
+                print(f"  {name:<12} {len(values):>3} entries  [{values.min():.4g} .. {values.max():.4g}]")
+            else:
+                print(f"  {name:<12} {len(values):>3} entry    (fixed)")
+        print(f"Evaluated in {result['elapsed_s']*1000:.1f} ms using {workers} process(es)\n")
+        
+        bands = result['percentiles']
+        print(f"{result['x_name']:>14} {'2.5%':>10} {'16%':>10} {'median':>10} {'84%':>10} {'97.5%':>10}  ({result['y_name']})")
+        for i in np.linspace(0, len(result['x']) - 1, 9).astype(int):
+            print(f"{result['x'][i]:>14.4g} " + " ".join(f"{bands[p][i]:>10.4g}" for p in (2.5, 16.0, 50.0, 84.0, 97.5)))
+        
+        if output:
+            try:
+                write_band(result, output, material_name)
+                print(f"\n✓ Bands written to: {output}")
+            except ImportError:
+                print("\n✗ Plot output requires matplotlib")
+        print(f"{'='*80}\n")
+    
     def close(self):
         """Close database connection."""
         self.db.close()
@@ -737,29 +1446,54 @@ Examples:
   python main.py import-all
   python main.py list
   python main.py query Copper
+  python main.py query-path "EOSModel.Row[*].K0" RDX,TNT,HMX
   python main.py export Copper
   python main.py export-all
   python main.py set-preference Aluminum properties.Thermal.Density 112
   python main.py set-override Aluminum properties.Thermal.Density 2700
   python main.py list-overrides Aluminum
   python main.py clear-overrides Aluminum
+  python main.py import-overrides Aluminum_Overrides.xml
+  python main.py import-overrides overrides.xml Nickel --replace
+  python main.py export-overrides Aluminum
   python main.py import-references
   python main.py list-references
   python main.py query-reference 112
   python main.py material-references Aluminum
+  python main.py impedance-match Copper Aluminum 2.0
+  python main.py impedance-match Copper Aluminum,PMMA 2.0
+  python main.py impedance-match all 1.0,2.0,4.0
+  python main.py hydro Copper:2 Aluminum:6 1.0 2.0 shot.npz
+  python main.py hydro Copper:2 TANTALUM:4 0.8 --strength
+  python main.py hydro benchmark 50000
+  python main.py off-hugoniot release Copper 20,50,100 copper_release.csv
+  python main.py critical-temperature all
+  python main.py formulation set COMP-B RDX:0.60,TNT:0.40
+  python main.py formulation sweep RDX,TNT,HMX 0.01 sweep.csv
+  python main.py uncertainty HMX eos 100000 hmx_eos_band.csv
+  python main.py uncertainty HMX hugoniot 20000 hmx_hugoniot_band.png
         """
     )
     
     parser.add_argument('command', 
                        choices=['init', 'reset', 'import', 'import-all', 
-                               'list', 'query', 'export', 'export-all',
+                               'list', 'query', 'query-path', 'export', 'export-all',
                                'set-preference', 'set-override', 
                                'list-overrides', 'clear-overrides',
+                               'import-overrides', 'export-overrides',
                                'import-references', 'query-reference',
-                               'list-references', 'material-references'],
+                               'list-references', 'material-references',
+                               'impedance-match', 'hydro', 'off-hugoniot',
+                               'critical-temperature', 'formulation', 'uncertainty'],
                        help='Command to execute')
     parser.add_argument('arguments', nargs='*', 
                        help='Additional arguments (material name, property path, value, etc.)')
+    parser.add_argument('--replace', action='store_true',
+                       help='import-overrides: clear existing overrides of the material first')
+    parser.add_argument('--strength', action='store_true',
+                       help='hydro: enable Johnson-Cook strength')
+    parser.add_argument('--burn', action='store_true',
+                       help='hydro: enable Arrhenius burn of energetic layers')
     
     args = parser.parse_args()
     
@@ -790,6 +1524,12 @@ Examples:
                 sys.exit(1)
             cli.query_material(args.arguments[0])
         
+        elif args.command == 'query-path':
+            if not args.arguments or len(args.arguments) < 1:
+                print("✗ Usage: query-path <path_query> [material1,material2,...]")
+                sys.exit(1)
+            cli.query_path(args.arguments[0], args.arguments[1] if len(args.arguments) > 1 else None)
+        
         elif args.command == 'export':
             if not args.arguments or len(args.arguments) < 1:
                 print("✗ Please specify material name")
@@ -830,6 +1570,20 @@ Examples:
             path = args.arguments[1] if len(args.arguments) > 1 else None
             cli.clear_overrides(material, path)
         
+        elif args.command == 'import-overrides':
+            if not args.arguments or len(args.arguments) < 1:
+                print("✗ Usage: import-overrides <file> [material] [--replace]")
+                sys.exit(1)
+            material = args.arguments[1] if len(args.arguments) > 1 else None
+            cli.import_overrides(args.arguments[0], material, replace=args.replace)
+        
+        elif args.command == 'export-overrides':
+            if not args.arguments or len(args.arguments) < 1:
+                print("✗ Usage: export-overrides <material> [output_file]")
+                sys.exit(1)
+            output = args.arguments[1] if len(args.arguments) > 1 else None
+            cli.export_overrides(args.arguments[0], output)
+        
         # References commands
         elif args.command == 'import-references':
             cli.import_references()
@@ -848,6 +1602,66 @@ Examples:
                 print("✗ Please specify material name")
                 sys.exit(1)
             cli.material_references(args.arguments[0])
+        
+        # Physics commands
+        elif args.command == 'impedance-match':
+            if args.arguments and args.arguments[0] == 'all' and len(args.arguments) >= 2:
+                cli.impedance_match('all', args.arguments[1], None)
+            elif not args.arguments or len(args.arguments) < 3:
+                print("✗ Usage: impedance-match <flyer> <target[,layer2,...]> <velocity_km_s>")
+                print("         impedance-match all <velocity_km_s[,v2,...]>")
+                sys.exit(1)
+            else:
+                cli.impedance_match(args.arguments[0], args.arguments[1], args.arguments[2])
+        
+        elif args.command == 'hydro':
+            if args.arguments and args.arguments[0] == 'benchmark':
+                cli.hydro_benchmark(args.arguments[1] if len(args.arguments) > 1 else '20000')
+            elif not args.arguments or len(args.arguments) < 3:
+                print("✗ Usage: hydro <flyer[:mm]> <target[:mm][,layer2[:mm],...]> <velocity_km_s> [t_end_us] [out.npz] [--strength] [--burn]")
+                print("         hydro benchmark [n_cells]")
+                sys.exit(1)
+            else:
+                t_end = args.arguments[3] if len(args.arguments) > 3 else None
+                output = args.arguments[4] if len(args.arguments) > 4 else None
+                cli.hydro(args.arguments[0], args.arguments[1], args.arguments[2], t_end, output,
+                          strength=args.strength, burn=args.burn)
+        
+        elif args.command == 'off-hugoniot':
+            if not args.arguments or len(args.arguments) < 3 or args.arguments[0] not in ('release', 'reshock'):
+                print("✗ Usage: off-hugoniot <release|reshock> <material> <P_GPa[,P2,...]> [out.csv|out.parquet]")
+                sys.exit(1)
+            output = args.arguments[3] if len(args.arguments) > 3 else None
+            cli.off_hugoniot(args.arguments[0], args.arguments[1], args.arguments[2], output)
+        
+        elif args.command == 'critical-temperature':
+            materials = args.arguments[0] if args.arguments else 'all'
+            output_dir = args.arguments[1] if len(args.arguments) > 1 else None
+            cli.critical_temperature_tables(materials, output_dir)
+        
+        elif args.command == 'formulation':
+            action = args.arguments[0] if args.arguments else 'show'
+            if action == 'show':
+                cli.formulation_show(args.arguments[1] if len(args.arguments) > 1 else 'all')
+            elif action == 'set' and len(args.arguments) >= 3:
+                cli.formulation_set(args.arguments[1], args.arguments[2])
+            elif action == 'sweep' and len(args.arguments) >= 2:
+                step = args.arguments[2] if len(args.arguments) > 2 else '0.01'
+                output = args.arguments[3] if len(args.arguments) > 3 else None
+                cli.formulation_sweep(args.arguments[1], step, output)
+            else:
+                print("✗ Usage: formulation show [all|formulation]")
+                print("         formulation set <formulation> <material:fraction[,...]>")
+                print("         formulation sweep <material,material[,...]> [step] [out.csv]")
+                sys.exit(1)
+        
+        elif args.command == 'uncertainty':
+            if not args.arguments or len(args.arguments) < 2:
+                print("✗ Usage: uncertainty <material> <hugoniot|eos|jc> [n_samples] [out.csv|out.png]")
+                sys.exit(1)
+            n_samples = args.arguments[2] if len(args.arguments) > 2 else '10000'
+            output = args.arguments[3] if len(args.arguments) > 3 else None
+            cli.uncertainty(args.arguments[0], args.arguments[1], n_samples, output)
     
     finally:
         cli.close()
@@ -0,0 +1,60 @@
+#!/usr/bin/env python3
+"""
+Run database migration to add indexed property paths.
+
+This script:
+1. Installs the ltree extension, path columns, GiST indexes and triggers
+2. Sets the path of every existing property entry and model parameter
+   in small committed batches
+
+New rows get their paths from the triggers; the script is safe to re-run.
+
+Usage:
+    python migrate_property_paths.py [--batch-size N]
+"""
+
+import argparse
+import sys
+from db.database import DatabaseManager
+from db.property_path_storage import PropertyPathStorage
+from db.reference_key_storage import BATCH_SIZE
+
+
+def print_progress(table, done, total):
+    """Print one progress line per batch."""
+    end = "\n" if done >= total else "\r"
+    print(f"  Backfilling {table}.path: {done}/{total}", end=end, flush=True)
+
+
+def main():
+    """Main entry point."""
+    parser = argparse.ArgumentParser(description="Add indexed property paths")
+    parser.add_argument('--batch-size', type=int, default=BATCH_SIZE,
+                        help=f"Rows per committed batch (default {BATCH_SIZE})")
+    args = parser.parse_args()
+
+    print("=" * 60)
+    print("DATABASE MIGRATION: Property Paths")
+    print("=" * 60)
+
+    db = DatabaseManager()
+    try:
+        storage = PropertyPathStorage(db.connect())
+        if not storage.available:
+            print("\n✗ The ltree extension could not be installed")
+            sys.exit(1)
+        print("✓ Columns, indexes and triggers")
+        storage.backfill(batch_size=args.batch_size, progress=print_progress)
+        print("\n" + "=" * 60)
+        print("MIGRATION COMPLETED SUCCESSFULLY! ✓")
+        print("=" * 60)
+    except Exception as e:
+        print(f"\n✗ Migration failed: {e}")
+        print("  Completed batches are kept; re-run to resume.")
+        sys.exit(1)
+    finally:
+        db.close()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+"""
+Run database migration to add typed reference keys.
+
+This script:
+1. Adds reference_id foreign key columns to property_entries and model_parameters
+2. Creates the material_references bridge table and its triggers
+3. Backfills both in small committed batches
+4. Builds the lookup indexes concurrently and validates the foreign keys
+
+The database stays usable while it runs and the script is safe to re-run.
+
+Usage:
+    python migrate_reference_keys.py [--batch-size N]
+"""
+
+import argparse
+import sys
+from db.database import DatabaseManager
+from db.reference_key_storage import ReferenceKeyStorage, BATCH_SIZE
+
+
+STEPS = {
+    'schema': "Columns, bridge table and triggers",
+    'property_entries': "Backfilling property_entries.reference_id",
+    'model_parameters': "Backfilling model_parameters.reference_id",
+    'material_references': "Backfilling material_references",
+    'indexes': "Building indexes (concurrently)",
+    'validate': "Validating foreign keys",
+}
+
+
+def print_progress(step, done, total):
+    """Print one progress line per batch."""
+    label = STEPS.get(step, step)
+    if total <= 1:
+        print(f"✓ {label}")
+    else:
+        end = "\n" if done >= total else "\r"
+        print(f"  {label}: {done}/{total}", end=end, flush=True)
+
+
+def main():
+    """Main entry point."""
+    parser = argparse.ArgumentParser(description="Add typed reference keys")
+    parser.add_argument('--batch-size', type=int, default=BATCH_SIZE,
+                        help=f"Rows per committed batch (default {BATCH_SIZE})")
+    args = parser.parse_args()
+
+    print("=" * 60)
+    print("DATABASE MIGRATION: Reference Keys")
+    print("=" * 60)
+
+    db = DatabaseManager()
+    try:
+        conn = db.connect()
+        storage = ReferenceKeyStorage(conn)
+        storage.migrate(batch_size=args.batch_size, progress=print_progress)
+
+        report = storage.validation_report()
+        print("\n" + "=" * 60)
+        print("MIGRATION COMPLETED SUCCESSFULLY! ✓")
+        print("=" * 60)
+        print(f"  References:            {report['reference_count']}")
+        print(f"  Materials:             {report['material_count']}")
+        print(f"  Missing citations:     {len(report['missing'])}")
+        print(f"  Unused references:     {len(report['unused'])}")
+    except Exception as e:
+        print(f"\n✗ Migration failed: {e}")
+        print("  Completed batches are kept; re-run to resume.")
+        sys.exit(1)
+    finally:
+        db.close()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,197 @@
+"""
+Overrides XML import/export for Material Database Engine.
+
+File format (one material per file):
+
+    <overrides material="Aluminum" count="2">
+      <override type="value_override">
+        <property>properties.Thermal.Cp</property>
+        <new_value>900</new_value>
+        <unit>J/kg/K</unit>          (optional)
+        <reason>Measured</reason>    (optional)
+        <timestamp>...</timestamp>
+      </override>
+      <override type="reference_preference">
+        <property>properties.Thermal.Density</property>
+        <preferred_ref>113</preferred_ref>
+        <timestamp>...</timestamp>
+      </override>
+    </overrides>
+
+Both directions stream: the importer parses one <override> at a time and
+feeds OverrideStorage.apply_overrides_bulk() (one transaction), and the
+exporter writes rows as they arrive from a server-side cursor.
+
+Files without a type attribute (written by earlier versions) are read as
+value overrides when <new_value> is set; entries with neither a value nor
+a preferred reference are skipped.
+"""
+import xml.etree.ElementTree as ET
+from xml.sax.saxutils import escape, quoteattr
+from typing import Any, Dict, Iterable, Iterator, Optional, Tuple
+
+from db.override_storage import OverrideStorage, OVERRIDE_TYPES
+
+
+def read_overrides_material(file_path: str) -> Optional[str]:
+    """
+    Material name of an overrides file (reads only the root element).
+
+    Args:
+        file_path: Path to overrides XML file
+
+    Returns:
+        Value of the root's material attribute, or None
+    """
+    with open(file_path, 'rb') as f:
+        for _, elem in ET.iterparse(f, events=('start',)):
+            if elem.tag != 'overrides':
+                raise ValueError(f"Not an overrides file: {file_path}")
+            return elem.get('material')
+    return None
+
+
+def _text(elem: ET.Element, tag: str) -> Optional[str]:
+    """Stripped text of a child element; None when missing or empty."""
+    text = elem.findtext(tag)
+    return text.strip() or None if text is not None else None
+
+
+def read_overrides_xml(file_path: str,
+                       stats: Optional[Dict[str, int]] = None) -> Iterator[Tuple[str, str, Dict[str, Any]]]:
+    """
+    Stream the overrides of a file.
+
+    Args:
+        file_path: Path to overrides XML file
+        stats: Optional dict; 'read' and 'skipped' counts are added to it
+
+    Yields:
+        (property_path, override_type, override_data)
+    """
+    if stats is None:
+        stats = {}
+    stats.setdefault('read', 0)
+    stats.setdefault('skipped', 0)
+
+    with open(file_path, 'rb') as f:
+        root = None
+        for event, elem in ET.iterparse(f, events=('start', 'end')):
+            if root is None:
+                root = elem
+                continue
+            if event != 'end' or elem.tag != 'override':
+                continue
+
+            stats['read'] += 1
+            path = _text(elem, 'property')
+            override_type = elem.get('type')
+            if override_type is None:
+                if _text(elem, 'preferred_ref') is not None:
+                    override_type = 'reference_preference'
+                elif _text(elem, 'new_value') is not None:
+                    override_type = 'value_override'
+
+            if override_type == 'reference_preference':
+                data = {'preferred_ref': _text(elem, 'preferred_ref')}
+                valid = data['preferred_ref'] is not None
+            elif override_type == 'value_override':
+                data = {'value': _text(elem, 'new_value'),
+                        'unit': _text(elem, 'unit'),
+                        'reason': _text(elem, 'reason')}
+                valid = data['value'] is not None
+            else:
+                valid = False
+
+            # Parsed overrides are dropped so memory stays flat
+            root.clear()
+            if path is None or not valid:
+                stats['skipped'] += 1
+                continue
+            yield path, override_type, data
+
+
+def import_overrides_xml(storage: OverrideStorage, file_path: str, material_id: int,
+                         replace: bool = False) -> Dict[str, int]:
+    """
+    Apply an overrides file to a material in a single transaction.
+
+    Args:
+        storage: OverrideStorage instance
+        file_path: Path to overrides XML file
+        material_id: Material to apply the overrides to
+        replace: Delete the material's existing overrides first
+
+    Returns:
+        {'read', 'skipped', 'saved', 'deleted'} counts
+    """
+    stats = {}
+    rows = ((material_id, path, override_type, data)
+            for path, override_type, data in read_overrides_xml(file_path, stats))
+    counts = storage.apply_overrides_bulk(rows, replace_materials=[material_id] if replace else ())
+    stats.update(counts)
+    return stats
+
+
+def write_overrides_xml(overrides: Iterable[Dict[str, Any]], material_name: str,
+                        file_path: str, count: Optional[int] = None) -> int:
+    """
+    Write overrides to an XML file as they are iterated.
+
+    Args:
+        overrides: Override dictionaries as from OverrideStorage.iter_overrides()
+        material_name: Material name (root attribute)
+        file_path: Output path
+        count: Number of overrides for the count attribute (omitted if None)
+
+    Returns:
+        Number of overrides written
+    """
+    written = 0
+    with open(file_path, 'w', encoding='utf-8') as f:
+        f.write('<?xml version="1.0" encoding="UTF-8"?>\n')
+        count_attr = f' count="{count}"' if count is not None else ''
+        f.write(f'<overrides material={quoteattr(material_name)}{count_attr}>\n')
+
+        for override in overrides:
+            override_type = override['override_type']
+            if override_type not in OVERRIDE_TYPES:
+                continue
+            data = override.get('override_data') or {}
+
+            f.write(f'  <override type="{override_type}">\n')
+            f.write(f'    <property>{escape(override["property_path"])}</property>\n')
+            if override_type == 'reference_preference':
+                f.write(f'    <preferred_ref>{escape(str(data.get("preferred_ref", "")))}</preferred_ref>\n')
+            else:
+                f.write(f'    <new_value>{escape(str(data.get("value", "")))}</new_value>\n')
+                if data.get('unit'):
+                    f.write(f'    <unit>{escape(str(data["unit"]))}</unit>\n')
+                if data.get('reason'):
+                    f.write(f'    <reason>{escape(str(data["reason"]))}</reason>\n')
+            created_at = override.get('created_at')
+            timestamp = created_at.isoformat() if hasattr(created_at, 'isoformat') else (created_at or '')
+            f.write(f'    <timestamp>{escape(str(timestamp))}</timestamp>\n')
+            f.write('  </override>\n')
+            written += 1
+
+        f.write('</overrides>\n')
+    return written
+
+
+def export_overrides_xml(storage: OverrideStorage, material_id: int, material_name: str,
+                         file_path: str) -> int:
+    """
+    Export a material's stored overrides, streamed from the database.
+
+    Args:
+        storage: OverrideStorage instance
+        material_id: Material ID
+        material_name: Material name
+        file_path: Output path
+
+    Returns:
+        Number of overrides written
+    """
+    return write_overrides_xml(storage.iter_overrides(material_id), material_name, file_path,
+                               count=storage.count_overrides(material_id))
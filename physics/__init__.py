@@ -0,0 +1 @@
+"""Physics module for Material Database Engine."""
@@ -0,0 +1,697 @@
+"""
+1-D Planar Lagrangian Hydrocode
+
+Compact staggered-grid (von Neumann-Richtmyer) shock code for quick
+flyer-plate and gap-test screening with materials taken straight from the
+database through MaterialQuerier.
+
+Features:
+    - Quadratic + linear artificial viscosity
+    - Mie-Grüneisen (linear Us-Up reference), JWL and ideal-gas closures
+    - Optional Johnson-Cook strength (elastic-perfectly-plastic radial return)
+    - Optional single-step Arrhenius burn to JWL detonation products
+    - Free or rigid-wall boundaries, bonded layers (interfaces do not open)
+
+All closures are linear in specific internal energy,
+
+    p(rho, e) = p0(rho) + B(rho) * e
+
+so the energy equation is solved exactly for the new-time pressure
+(no iteration). Every cell update is a NumPy array operation over a
+material slice; the only Python loop is over layers.
+
+Units are SI throughout: m, s, kg/m³, m/s, Pa, J/kg, K.
+
+Time histories are stored column-wise (one array per variable, shaped
+time × station) and written with np.savez_compressed.
+
+Author: Materials Database Team
+"""
+
+from typing import Dict, List, Optional, Any
+import json
+import time
+
+import numpy as np
+
+from physics.material_params import (
+    GAS_CONSTANT, get_density, get_specific_heat, get_mie_gruneisen,
+    get_jwl, get_johnson_cook, get_arrhenius
+)
+
+
+# ============================================================================
+# EQUATIONS OF STATE
+# ============================================================================
+
+class IdealGasEOS:
+    """Ideal gas: p = (gamma - 1) rho e."""
+
+    kind = 'IdealGas'
+
+    def __init__(self, gamma: float):
+        self.gamma = float(gamma)
+
+    def reference(self, rho: np.ndarray):
+        """Return (p0, dp/de) at density rho."""
+        return np.zeros_like(rho), (self.gamma - 1.0) * rho
+
+
+class MieGruneisenEOS:
+    """
+    Mie-Grüneisen EOS referenced to the linear Us-Up Hugoniot:
+
+        eta = 1 - rho0/rho
+        p_H = rho0 c0² eta / (1 - s eta)²,   e_H = p_H eta / (2 rho0)
+        p   = p_H + gamma0 rho0 (e - e_H)
+    """
+
+    kind = 'MieGruneisen'
+
+    def __init__(self, rho0: float, c0: float, s: float, gamma: float):
+        self.rho0 = float(rho0)
+        self.c0 = float(c0)
+        self.s = float(s)
+        self.gamma = float(gamma)
+        # Keep 1 - s*eta away from the Hugoniot singularity
+        self._eta_max = 0.95 / self.s if self.s > 0.0 else 0.95
+
+    def reference(self, rho: np.ndarray):
+        """Return (p0, dp/de) at density rho."""
+        eta = np.minimum(1.0 - self.rho0 / rho, self._eta_max)
+        p_h = self.rho0 * self.c0 ** 2 * eta / (1.0 - self.s * eta) ** 2
+        e_h = 0.5 * p_h * eta / self.rho0
+        dpde = self.gamma * self.rho0
+        return p_h - dpde * e_h, np.full_like(rho, dpde)
+
+
+class JWLEOS:
+    """
+    JWL EOS in terms of relative volume V = rho0/rho:
+
+        p = A (1 - w/(R1 V)) exp(-R1 V) + B (1 - w/(R2 V)) exp(-R2 V) + w rho e
+    """
+
+    kind = 'JWL'
+
+    def __init__(self, rho0: float, A: float, B: float, R1: float, R2: float, w: float):
+        self.rho0 = float(rho0)
+        self.A = float(A)
+        self.B = float(B)
+        self.R1 = float(R1)
+        self.R2 = float(R2)
+        self.w = float(w)
+
+    def reference(self, rho: np.ndarray):
+        """Return (p0, dp/de) at density rho."""
+        v = self.rho0 / rho
+        p0 = (self.A * (1.0 - self.w / (self.R1 * v)) * np.exp(-self.R1 * v)
+              + self.B * (1.0 - self.w / (self.R2 * v)) * np.exp(-self.R2 * v))
+        return p0, self.w * rho
+
+
+# ============================================================================
+# MATERIALS AND LAYERS
+# ============================================================================
+
+class HydroMaterial:
+    """
+    Material closure set for the hydrocode.
+
+    Attributes:
+        name: Material name
+        rho0: Initial density [kg/m³]
+        eos: Closure for the (unreacted) material
+        cv: Specific heat for temperature estimates [J/kg/K]
+        strength: Johnson-Cook constants dict or None
+        burn: Arrhenius kinetics {'Ea', 'lnZ', 'Q'} or None
+        products: JWL closure for detonation products (required with burn)
+    """
+
+    def __init__(self, name: str, rho0: float, eos, cv: float = 1000.0,
+                 strength: Optional[Dict[str, float]] = None,
+                 burn: Optional[Dict[str, float]] = None,
+                 products=None, T0: float = 293.0):
+        if burn is not None and products is None:
+            raise ValueError(f"{name}: burn requires a detonation-products EOS")
+
+        self.name = name
+        self.rho0 = float(rho0)
+        self.eos = eos
+        self.cv = float(cv)
+        self.strength = strength
+        self.burn = burn
+        self.products = products
+        self.T0 = float(T0)
+
+    def __repr__(self):
+        extras = [self.eos.kind]
+        if self.strength:
+            extras.append('JC')
+        if self.burn:
+            extras.append('Arrhenius->JWL')
+        return f"HydroMaterial({self.name}, rho0={self.rho0:g}, {' + '.join(extras)})"
+
+    @classmethod
+    def ideal_gas(cls, name: str, rho0: float, gamma: float = 1.4, cv: float = 718.0) -> 'HydroMaterial':
+        """Create an ideal-gas material (used for verification problems)."""
+        return cls(name, rho0, IdealGasEOS(gamma), cv=cv)
+
+    @classmethod
+    def from_data(cls, name: str, material_data: Dict[str, Any],
+                  overrides: Optional[Dict[str, float]] = None,
+                  strength: bool = False, burn: bool = False,
+                  required: bool = True) -> 'HydroMaterial':
+        """
+        Build closures from a material dictionary.
+
+        The unreacted EOS is Mie-Grüneisen when complete, otherwise the
+        unreacted JWL row. With burn=True the reacted JWL row and the
+        ReactionModelParameter kinetics are required; with required=False
+        strength and burn are instead enabled only when their data exists
+        (e.g. an inert flyer in a burn run).
+
+        Args:
+            name: Material name
+            material_data: Dictionary from MaterialQuerier or parse_material_xml
+            overrides: Replacement MG values ({'rho0', 'c0', 's', 'gamma'} in SI)
+            strength: Enable Johnson-Cook strength
+            burn: Enable Arrhenius burn
+            required: Raise when strength/burn data is missing (else skip it)
+
+        Returns:
+            HydroMaterial
+
+        Raises:
+            ValueError: If required parameters are missing
+        """
+        mg = get_mie_gruneisen(material_data, overrides)
+        rho0 = mg['rho0'] or get_density(material_data)
+        if rho0 is None:
+            raise ValueError(f"{name}: no density available")
+
+        if all(mg[k] is not None for k in ('c0', 's', 'gamma')):
+            eos = MieGruneisenEOS(rho0, mg['c0'], mg['s'], mg['gamma'])
+        else:
+            jwl_u = get_jwl(material_data, 'unreacted')
+            if jwl_u is None:
+                missing = [k for k in ('c0', 's', 'gamma') if mg[k] is None]
+                raise ValueError(f"{name}: incomplete Mie-Grüneisen parameters "
+                                 f"(missing {', '.join(missing)}) and no unreacted JWL row")
+            eos = JWLEOS(rho0, jwl_u['A'], jwl_u['B'], jwl_u['R1'], jwl_u['R2'], jwl_u['w'])
+
+        jc = None
+        if strength:
+            jc = get_johnson_cook(material_data)
+            if jc is None and required:
+                raise ValueError(f"{name}: incomplete Johnson-Cook constants or shear modulus")
+
+        kinetics = None
+        products = None
+        if burn:
+            kinetics = get_arrhenius(material_data)
+            jwl_r = get_jwl(material_data, 'reacted')
+            if kinetics is None or jwl_r is None:
+                if required:
+                    raise ValueError(f"{name}: burn needs ReactionModelParameter (Ea, lnZ, Q_R) "
+                                     f"and a reacted JWL row")
+                kinetics = None
+            else:
+                products = JWLEOS(rho0, jwl_r['A'], jwl_r['B'], jwl_r['R1'], jwl_r['R2'], jwl_r['w'])
+
+        return cls(name, rho0, eos, cv=get_specific_heat(material_data) or 1000.0,
+                   strength=jc, burn=kinetics, products=products)
+
+    @classmethod
+    def from_querier(cls, querier, name: str,
+                     overrides: Optional[Dict[str, float]] = None,
+                     strength: bool = False, burn: bool = False,
+                     required: bool = True) -> 'HydroMaterial':
+        """
+        Build closures for a database material.
+
+        Args:
+            querier: MaterialQuerier instance
+            name: Material name
+            overrides, strength, burn, required: See from_data()
+
+        Raises:
+            ValueError: If the material does not exist or parameters are missing
+        """
+        material_data = querier.get_material_by_name(name)
+        if not material_data:
+            raise ValueError(f"Material not found: {name}")
+        return cls.from_data(name, material_data, overrides, strength, burn, required)
+
+
+class Layer:
+    """Uniform slab of one material."""
+
+    def __init__(self, material: HydroMaterial, thickness: float, n_cells: int,
+                 velocity: float = 0.0, energy: float = 0.0):
+        """
+        Args:
+            material: HydroMaterial
+            thickness: Slab thickness [m]
+            n_cells: Number of cells
+            velocity: Initial velocity [m/s]
+            energy: Initial specific internal energy [J/kg]
+        """
+        self.material = material
+        self.thickness = float(thickness)
+        self.n_cells = int(n_cells)
+        self.velocity = float(velocity)
+        self.energy = float(energy)
+
+
+# ============================================================================
+# TIME HISTORIES
+# ============================================================================
+
+class HydroHistory:
+    """
+    Column-oriented time histories.
+
+    columns holds one array per variable: 't' is (n_samples,), station
+    variables are (n_samples, n_stations), and optional field snapshots
+    ('field_*') are (n_snapshots, n_cells).
+    """
+
+    def __init__(self, columns: Dict[str, np.ndarray], metadata: Optional[Dict[str, Any]] = None):
+        self.columns = columns
+        self.metadata = metadata or {}
+
+    def __getitem__(self, key: str) -> np.ndarray:
+        return self.columns[key]
+
+    def save(self, path: str):
+        """Write histories to a compressed .npz file (one array per column)."""
+        np.savez_compressed(path, __metadata__=np.array(json.dumps(self.metadata)), **self.columns)
+
+    @classmethod
+    def load(cls, path: str) -> 'HydroHistory':
+        """Read histories written by save()."""
+        with np.load(path) as data:
+            columns = {k: data[k] for k in data.files if k != '__metadata__'}
+            metadata = json.loads(str(data['__metadata__'])) if '__metadata__' in data.files else {}
+        return cls(columns, metadata)
+
+
+# ============================================================================
+# SOLVER
+# ============================================================================
+
+class LagrangianHydro:
+    """
+    Staggered-grid Lagrangian solver.
+
+    Node velocities live at half steps, cell quantities at full steps.
+    Layers are stacked left to right starting at x = 0.
+
+    Example:
+        >>> cu = HydroMaterial.from_querier(querier, 'Copper', overrides={'s': 1.49})
+        >>> sim = LagrangianHydro([Layer(cu, 2e-3, 100, 500.0), Layer(cu, 6e-3, 300)])
+        >>> history = sim.run(1.5e-6, stations=[3e-3, 5e-3])
+        >>> history.save('copper_shot.npz')
+    """
+
+    VARIABLES = ('pressure', 'velocity', 'density', 'energy', 'stress', 'reaction')
+
+    def __init__(self, layers: List[Layer], left_boundary: str = 'free',
+                 right_boundary: str = 'free', cfl: float = 0.5,
+                 q_quad: float = 2.0, q_lin: float = 0.1):
+        """
+        Args:
+            layers: Layers from left to right
+            left_boundary, right_boundary: 'free' or 'wall'
+            cfl: Courant number
+            q_quad: Quadratic artificial viscosity coefficient
+            q_lin: Linear artificial viscosity coefficient
+        """
+        for side in (left_boundary, right_boundary):
+            if side not in ('free', 'wall'):
+                raise ValueError(f"Unknown boundary type: {side}")
+
+        self.layers = layers
+        self.left_boundary = left_boundary
+        self.right_boundary = right_boundary
+        self.cfl = float(cfl)
+        self.q_quad = float(q_quad)
+        self.q_lin = float(q_lin)
+
+        n = sum(layer.n_cells for layer in layers)
+        self.n_cells = n
+
+        x = [0.0]
+        rho = np.empty(n)
+        e = np.empty(n)
+        u_cell = np.empty(n)
+        self.groups = []
+        start = 0
+        for layer in layers:
+            dx = layer.thickness / layer.n_cells
+            x.extend(x[-1] + dx * np.arange(1, layer.n_cells + 1))
+            sl = slice(start, start + layer.n_cells)
+            rho[sl] = layer.material.rho0
+            e[sl] = layer.energy
+            u_cell[sl] = layer.velocity
+            self.groups.append((sl, layer.material))
+            start += layer.n_cells
+
+        self.x = np.asarray(x, dtype=float)
+        self.x_initial = self.x.copy()
+        self.rho = rho
+        self.mass = rho * np.diff(self.x)
+        self.e = e
+
+        # Node masses and momentum-conserving initial node velocities
+        self.node_mass = np.zeros(n + 1)
+        self.node_mass[:-1] += 0.5 * self.mass
+        self.node_mass[1:] += 0.5 * self.mass
+        momentum = np.zeros(n + 1)
+        momentum[:-1] += 0.5 * self.mass * u_cell
+        momentum[1:] += 0.5 * self.mass * u_cell
+        self.u = momentum / self.node_mass
+        self._apply_velocity_boundaries()
+
+        self.q = np.zeros(n)
+        self.s_dev = np.zeros(n)
+        self.eps_p = np.zeros(n)
+        self.lam = np.zeros(n)
+        self.p, self.c = self._pressure_and_sound_speed(self.rho, self.e)
+
+        self.time = 0.0
+        self.steps = 0
+        self._dt_prev = None
+
+    # ------------------------------------------------------------------
+    # Closures
+    # ------------------------------------------------------------------
+
+    def _reference(self, sl: slice, material: HydroMaterial, rho: np.ndarray):
+        """
+        Mixed (p0, dp/de) for one material slice.
+
+        With burn, unreacted material sees e - lam*Q (released chemical
+        energy is carried by the products):
+            p = (1-lam) [p0u + Bu (e - lam Q)] + lam [p0r + Br e]
+        """
+        p0, dpde = material.eos.reference(rho)
+        if material.burn is None:
+            return p0, dpde
+
+        lam = self.lam[sl]
+        p0r, dpder = material.products.reference(rho)
+        q_release = material.burn['Q']
+        return ((1.0 - lam) * (p0 - dpde * lam * q_release) + lam * p0r,
+                (1.0 - lam) * dpde + lam * dpder)
+
+    def _pressure_and_sound_speed(self, rho: np.ndarray, e: np.ndarray, h: float = 1.0e-6):
+        """
+        Evaluate pressure and sound speed for all cells.
+
+        c² = dp/drho|e + (p/rho²) dp/de, with dp/drho from a central difference.
+        """
+        p = np.empty_like(rho)
+        c2 = np.empty_like(rho)
+        for sl, material in self.groups:
+            r = rho[sl]
+            p0, dpde = self._reference(sl, material, r)
+            p0_hi, dpde_hi = self._reference(sl, material, r * (1.0 + h))
+            p0_lo, dpde_lo = self._reference(sl, material, r * (1.0 - h))
+            p_hi = p0_hi + dpde_hi * e[sl]
+            p_lo = p0_lo + dpde_lo * e[sl]
+            p[sl] = p0 + dpde * e[sl]
+            c2[sl] = (p_hi - p_lo) / (2.0 * h * r) + p[sl] / r ** 2 * dpde
+            if material.strength is not None:
+                c2[sl] += (4.0 / 3.0) * material.strength['G'] / r
+        return p, np.sqrt(np.maximum(c2, 1.0e-12))
+
+    def _temperature(self, sl: slice, material: HydroMaterial) -> np.ndarray:
+        """Temperature estimate T = T0 + e_thermal / cv (e_thermal excludes released heat)."""
+        e = self.e[sl]
+        if material.burn is not None:
+            e = e - self.lam[sl] * material.burn['Q']
+        return material.T0 + np.maximum(e, 0.0) / material.cv
+
+    # ------------------------------------------------------------------
+    # Time stepping
+    # ------------------------------------------------------------------
+
+    def _apply_velocity_boundaries(self):
+        if self.left_boundary == 'wall':
+            self.u[0] = 0.0
+        if self.right_boundary == 'wall':
+            self.u[-1] = 0.0
+
+    def stable_dt(self) -> float:
+        """CFL time step including the artificial-viscosity signal speed."""
+        dx = np.diff(self.x)
+        du = np.minimum(np.diff(self.u), 0.0)
+        a = self.q_lin * self.c + 2.0 * self.q_quad * np.abs(du)
+        return self.cfl * float(np.min(dx / (a + np.sqrt(a * a + self.c * self.c))))
+
+    def step(self, dt: Optional[float] = None) -> float:
+        """
+        Advance one time step.
+
+        Args:
+            dt: Time step (stable_dt() if None)
+
+        Returns:
+            Time step taken
+        """
+        if dt is None:
+            dt = self.stable_dt()
+        dt_mid = 0.5 * dt if self._dt_prev is None else 0.5 * (dt + self._dt_prev)
+
+        # Momentum: node accelerations from total stress differences
+        sigma = self.s_dev - self.p - self.q
+        force = np.zeros(self.n_cells + 1)
+        force[:-1] += sigma
+        force[1:] -= sigma
+        self.u += force / self.node_mass * dt_mid
+        self._apply_velocity_boundaries()
+
+        # Kinematics
+        self.x += self.u * dt
+        rho_old = self.rho
+        rho_new = self.mass / np.diff(self.x)
+        dv = 1.0 / rho_new - 1.0 / rho_old
+
+        # Artificial viscosity on compression
+        du = np.diff(self.u)
+        self.q = np.where(du < 0.0, rho_new * (self.q_quad * du * du - self.q_lin * self.c * du), 0.0)
+
+        s_mid = self.s_dev.copy()
+        q_release = np.zeros(self.n_cells)
+        for sl, material in self.groups:
+            if material.strength is not None:
+                s_mid[sl] = self._update_strength(sl, material, rho_old[sl], rho_new[sl], dt)
+            if material.burn is not None:
+                q_release[sl] = self._update_burn(sl, material, dt)
+
+        # Energy: exact implicit update since p_new = p0 + B e_new
+        p0 = np.empty(self.n_cells)
+        dpde = np.empty(self.n_cells)
+        for sl, material in self.groups:
+            p0[sl], dpde[sl] = self._reference(sl, material, rho_new[sl])
+        self.e = ((self.e - (0.5 * self.p + 0.5 * p0 + self.q - s_mid) * dv + q_release)
+                  / (1.0 + 0.5 * dpde * dv))
+
+        self.rho = rho_new
+        self.p, self.c = self._pressure_and_sound_speed(self.rho, self.e)
+
+        self.time += dt
+        self.steps += 1
+        self._dt_prev = dt
+        return dt
+
+    def _update_strength(self, sl: slice, material: HydroMaterial,
+                         rho_old: np.ndarray, rho_new: np.ndarray, dt: float) -> np.ndarray:
+        """
+        Johnson-Cook radial return in uniaxial strain.
+
+        Deviatoric axial stress: s += (4/3) G d(eps), limited to |s| <= (2/3) Y
+        with Y = (A + B eps_p^n)(1 + C ln eps_rate*)(1 - T*^M).
+
+        Returns:
+            Time-centered deviatoric stress for the energy update
+        """
+        jc = material.strength
+        d_eps = np.log(rho_old / rho_new)
+        s_old = self.s_dev[sl]
+        s_trial = s_old + (4.0 / 3.0) * jc['G'] * d_eps
+
+        rate = np.maximum(np.abs(d_eps) / dt / jc['strain_rate'], 1.0)
+        yield_stress = (jc['A'] + jc['B'] * self.eps_p[sl] ** jc['n']) * (1.0 + jc['C'] * np.log(rate))
+        if jc['T_melt']:
+            t_star = np.clip((self._temperature(sl, material) - jc['T_ref'])
+                             / (jc['T_melt'] - jc['T_ref']), 0.0, 1.0)
+            yield_stress = yield_stress * (1.0 - t_star ** jc['M'])
+
+        limit = (2.0 / 3.0) * yield_stress
+        excess = np.maximum(np.abs(s_trial) - limit, 0.0)
+        self.eps_p[sl] += excess / (2.0 * jc['G'])
+        self.s_dev[sl] = np.clip(s_trial, -limit, limit)
+        return 0.5 * (s_old + self.s_dev[sl])
+
+    def _update_burn(self, sl: slice, material: HydroMaterial, dt: float) -> np.ndarray:
+        """
+        Single-step Arrhenius burn d(lam)/dt = (1 - lam) Z exp(-Ea / R T),
+        integrated exactly for the current temperature.
+
+        Returns:
+            Heat released this step [J/kg]
+        """
+        kinetics = material.burn
+        temperature = self._temperature(sl, material)
+        log_rate = kinetics['lnZ'] - kinetics['Ea'] / (GAS_CONSTANT * temperature)
+        rate = np.exp(np.minimum(log_rate, 700.0))
+        lam_old = self.lam[sl]
+        lam_new = 1.0 - (1.0 - lam_old) * np.exp(-rate * dt)
+        self.lam[sl] = lam_new
+        return kinetics['Q'] * (lam_new - lam_old)
+
+    # ------------------------------------------------------------------
+    # Driver
+    # ------------------------------------------------------------------
+
+    def cell_centers(self) -> np.ndarray:
+        """Current cell-center positions [m]."""
+        return 0.5 * (self.x[:-1] + self.x[1:])
+
+    def sample(self, cells: np.ndarray) -> Dict[str, np.ndarray]:
+        """Cell-centered state for the given cell indices."""
+        return {
+            'pressure': self.p[cells],
+            'velocity': 0.5 * (self.u[cells] + self.u[cells + 1]),
+            'density': self.rho[cells],
+            'energy': self.e[cells],
+            'stress': (self.s_dev - self.p - self.q)[cells],
+            'reaction': self.lam[cells]
+        }
+
+    def total_energy(self) -> float:
+        """Internal + kinetic energy per unit area [J/m²]."""
+        return float(np.sum(self.mass * self.e) + 0.5 * np.sum(self.node_mass * self.u ** 2))
+
+    def station_cells(self, stations: List[float]) -> np.ndarray:
+        """Map initial (Lagrangian) positions to cell indices."""
+        centers = 0.5 * (self.x_initial[:-1] + self.x_initial[1:])
+        cells = np.searchsorted(centers, np.asarray(stations, dtype=float))
+        return np.clip(cells, 0, self.n_cells - 1)
+
+    def run(self, t_end: float, stations: Optional[List[float]] = None,
+            history_every: int = 10, snapshot_every: Optional[int] = None,
+            max_steps: Optional[int] = None) -> HydroHistory:
+        """
+        Run to t_end and collect station time histories.
+
+        Args:
+            t_end: End time [s]
+            stations: Initial positions of Lagrangian gauges [m]
+            history_every: Record gauges every N steps
+            snapshot_every: Record full cell fields every N steps (off if None)
+            max_steps: Stop after this many steps
+
+        Returns:
+            HydroHistory with 't', station columns, optional 'field_*'
+            snapshots and run statistics in metadata
+        """
+        stations = list(stations) if stations is not None else []
+        cells = self.station_cells(stations) if stations else np.zeros(0, dtype=int)
+
+        samples = {'t': []}
+        samples.update({name: [] for name in self.VARIABLES})
+        snapshots = {'t': [], 'x': []}
+        snapshots.update({name: [] for name in self.VARIABLES})
+
+        def record():
+            samples['t'].append(self.time)
+            for name, values in self.sample(cells).items():
+                samples[name].append(values)
+
+        def snapshot():
+            snapshots['t'].append(self.time)
+            snapshots['x'].append(self.cell_centers())
+            for name, values in self.sample(np.arange(self.n_cells)).items():
+                snapshots[name].append(values)
+
+        record()
+        if snapshot_every:
+            snapshot()
+
+        start_steps = self.steps
+        start = time.perf_counter()
+        while self.time < t_end * (1.0 - 1.0e-12):
+            if max_steps is not None and self.steps - start_steps >= max_steps:
+                break
+            self.step(min(self.stable_dt(), t_end - self.time))
+            n = self.steps - start_steps
+            if n % history_every == 0:
+                record()
+            if snapshot_every and n % snapshot_every == 0:
+                snapshot()
+        elapsed = time.perf_counter() - start
+
+        if samples['t'][-1] != self.time:
+            record()
+
+        columns = {name: np.asarray(values) for name, values in samples.items()}
+        if snapshot_every:
+            columns.update({f"field_{name}": np.asarray(values) for name, values in snapshots.items()})
+
+        n_steps = self.steps - start_steps
+        metadata = {
+            'layers': [{'material': l.material.name, 'thickness_m': l.thickness,
+                        'n_cells': l.n_cells, 'velocity_m_s': l.velocity} for l in self.layers],
+            'stations_m': stations,
+            'steps': n_steps,
+            'elapsed_s': elapsed,
+            'cell_updates_per_s': n_steps * self.n_cells / elapsed if elapsed > 0 else float('nan')
+        }
+        return HydroHistory(columns, metadata)
+
+
+# ============================================================================
+# BENCHMARK
+# ============================================================================
+
+def benchmark(n_cells: int = 20000, n_steps: int = 200,
+              material: Optional[HydroMaterial] = None) -> Dict[str, float]:
+    """
+    Measure solver throughput on a symmetric plate impact.
+
+    Args:
+        n_cells: Total number of cells (split 1:3 flyer:target)
+        n_steps: Number of time steps
+        material: Material for both plates (copper-like MG with JC strength if None)
+
+    Returns:
+        {'n_cells', 'steps', 'elapsed_s', 'cell_updates_per_s'}
+    """
+    if material is None:
+        material = HydroMaterial(
+            'Copper', 8930.0, MieGruneisenEOS(8930.0, 3940.0, 1.49, 2.0), cv=384.0,
+            strength={'A': 90.0e6, 'B': 292.0e6, 'n': 0.31, 'C': 0.025, 'M': 1.09,
+                      'strain_rate': 1.0, 'T_ref': 293.0, 'T_melt': 1356.0, 'G': 46.0e9}
+        )
+
+    n_flyer = n_cells // 4
+    sim = LagrangianHydro([
+        Layer(material, 1.0e-3, n_flyer, velocity=500.0),
+        Layer(material, 3.0e-3, n_cells - n_flyer)
+    ])
+
+    start = time.perf_counter()
+    for _ in range(n_steps):
+        sim.step()
+    elapsed = time.perf_counter() - start
+
+    return {
+        'n_cells': n_cells,
+        'steps': n_steps,
+        'elapsed_s': elapsed,
+        'cell_updates_per_s': n_cells * n_steps / elapsed
+    }
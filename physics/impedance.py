@@ -0,0 +1,373 @@
+"""
+Impedance Matching Solver for Plate-Impact Design
+
+Solves the flyer/target interface state (pressure and particle velocity)
+for symmetric and asymmetric plate impacts using linear Us-Up Hugoniots:
+
+    Us = C0 + s * Up
+    P  = rho0 * Us * Up
+
+Units are chosen so no conversion factors are needed inside the solver:
+    rho0 [g/cm³], C0 [km/s], s [-], velocities [km/s]  ->  P [GPa]
+
+With linear Hugoniots the pressure balance at the interface is a quadratic
+in Up, so every flyer × target × velocity combination is solved in closed
+form with a single broadcasted NumPy expression (no Python loops).
+
+Multi-layer stacks are solved by chaining interfaces with the mirror-image
+approximation: the release/reshock path of a layer shocked to (Up1, P1)
+is its own Hugoniot reflected about Up1, i.e. P = P_H(2*Up1 - Up).
+
+Author: Materials Database Team
+"""
+
+from typing import Dict, List, Optional, Any
+import time
+
+import numpy as np
+
+
+# Unit conversion factors into solver units
+_VELOCITY_TO_KM_S = {
+    'km/s': 1.0, 'mm/us': 1.0, 'mm/μs': 1.0,
+    'm/s': 1.0e-3, 'cm/s': 1.0e-5,
+}
+_DENSITY_TO_G_CC = {
+    'g/cm3': 1.0, 'g/cm^3': 1.0, 'g/cm³': 1.0, 'g/cc': 1.0,
+    'kg/m3': 1.0e-3, 'kg/m^3': 1.0e-3, 'kg/m³': 1.0e-3,
+}
+
+
+def _to_float(value) -> float:
+    """Convert a stored TEXT value to float (NaN if empty or invalid)."""
+    try:
+        return float(value)
+    except (TypeError, ValueError):
+        return float('nan')
+
+
+def _convert(value: float, unit: Optional[str], table: Dict[str, float],
+             si_threshold: float) -> float:
+    """
+    Convert value to solver units using the unit string.
+    When the unit is missing, values above si_threshold are assumed SI.
+    """
+    if unit:
+        factor = table.get(unit.strip().replace(' ', ''))
+        if factor is not None:
+            return value * factor
+    if value > si_threshold:
+        return value * 1.0e-3
+    return value
+
+
+def usup_to_solver_units(usup_params: Dict[str, Any]) -> Optional[Dict[str, float]]:
+    """
+    Convert a VisualizationDataService.get_usup_parameters() result
+    into solver units.
+
+    Args:
+        usup_params: Dictionary with 'C0', 's' and 'rho0' entries
+
+    Returns:
+        {'rho0': g/cm³, 'C0': km/s, 's': -} or None if incomplete
+    """
+    if not usup_params:
+        return None
+
+    if 'C0' not in usup_params or 's' not in usup_params or 'rho0' not in usup_params:
+        return None
+
+    c0 = _to_float(usup_params['C0'].get('value'))
+    s = _to_float(usup_params['s'].get('value'))
+    rho0 = _to_float(usup_params['rho0'].get('value'))
+
+    if not np.isfinite([c0, s, rho0]).all():
+        return None
+
+    return {
+        'rho0': _convert(rho0, usup_params['rho0'].get('unit'), _DENSITY_TO_G_CC, 100.0),
+        'C0': _convert(c0, usup_params['C0'].get('unit'), _VELOCITY_TO_KM_S, 100.0),
+        's': s
+    }
+
+
+def hugoniot_pressure(rho0, C0, s, up):
+    """
+    Principal Hugoniot pressure P(Up) = rho0 * (C0 + s*Up) * Up.
+    All arguments broadcast.
+    """
+    return rho0 * (C0 + s * up) * up
+
+
+def solve_interface(flyer_rho0, flyer_C0, flyer_s,
+                    target_rho0, target_C0, target_s, velocity) -> Dict[str, np.ndarray]:
+    """
+    Solve the impact interface state for broadcastable parameter arrays.
+
+    Pressure balance (flyer moving at V into a stationary target):
+        rho_t (C_t + s_t u) u = rho_f (C_f + s_f (V - u)) (V - u)
+
+    which reduces to A u² + B u + C = 0 with
+        A = rho_t s_t - rho_f s_f
+        B = rho_t C_t + rho_f C_f + 2 rho_f s_f V
+        C = -(rho_f s_f V² + rho_f C_f V)
+
+    The physical root lies in [0, V]; it is evaluated in the cancellation-free
+    form u = -2C / (B + sqrt(B² - 4AC)), which also covers A = 0.
+
+    Args:
+        flyer_*, target_*: Hugoniot parameters (solver units, broadcastable)
+        velocity: Impact velocity [km/s] (broadcastable)
+
+    Returns:
+        Dictionary of broadcast arrays:
+        - up: Interface particle velocity in the target [km/s]
+        - P: Interface pressure [GPa]
+        - us_target: Shock velocity in the target [km/s]
+        - us_flyer: Shock velocity in the flyer (flyer frame) [km/s]
+        - v_ratio_target: Compression V/V0 in the target
+    """
+    rho_f = np.asarray(flyer_rho0, dtype=float)
+    c_f = np.asarray(flyer_C0, dtype=float)
+    s_f = np.asarray(flyer_s, dtype=float)
+    rho_t = np.asarray(target_rho0, dtype=float)
+    c_t = np.asarray(target_C0, dtype=float)
+    s_t = np.asarray(target_s, dtype=float)
+    v = np.asarray(velocity, dtype=float)
+
+    a_f = rho_f * s_f
+    b_f = rho_f * c_f
+
+    quad_a = rho_t * s_t - a_f
+    quad_b = rho_t * c_t + b_f + 2.0 * a_f * v
+    quad_c = -(a_f * v * v + b_f * v)
+
+    disc = np.maximum(quad_b * quad_b - 4.0 * quad_a * quad_c, 0.0)
+    denom = quad_b + np.sqrt(disc)
+
+    with np.errstate(divide='ignore', invalid='ignore'):
+        up = np.where(denom > 0.0, -2.0 * quad_c / denom, 0.0)
+        us_target = c_t + s_t * up
+        pressure = rho_t * us_target * up
+        us_flyer = c_f + s_f * (v - up)
+        v_ratio = np.where(us_target > 0.0, 1.0 - up / us_target, 1.0)
+
+    return {
+        'up': up,
+        'P': pressure,
+        'us_target': us_target,
+        'us_flyer': us_flyer,
+        'v_ratio_target': v_ratio
+    }
+
+
+class HugoniotTable:
+    """
+    Column-oriented table of linear Us-Up parameters for many materials.
+
+    Parameters are stored as float arrays so whole matrices of
+    flyer × target × velocity are solved with one broadcasted call.
+    Materials with incomplete parameters are excluded at build time.
+    """
+
+    def __init__(self, names: List[str], rho0, C0, s):
+        """
+        Initialize table from parallel arrays.
+
+        Args:
+            names: Material names
+            rho0: Initial densities [g/cm³]
+            C0: Bulk sound speeds [km/s]
+            s: Us-Up slopes
+        """
+        self.names = list(names)
+        self.rho0 = np.asarray(rho0, dtype=float)
+        self.C0 = np.asarray(C0, dtype=float)
+        self.s = np.asarray(s, dtype=float)
+        self._index = {name: i for i, name in enumerate(self.names)}
+
+    def __len__(self):
+        return len(self.names)
+
+    def __contains__(self, name: str) -> bool:
+        return name in self._index
+
+    def index_of(self, name: str) -> int:
+        """Get row index for a material name (KeyError if missing)."""
+        if name not in self._index:
+            raise KeyError(f"No Us-Up parameters for material: {name}")
+        return self._index[name]
+
+    def get(self, name: str) -> Dict[str, float]:
+        """Get parameters for one material."""
+        i = self.index_of(name)
+        return {'rho0': float(self.rho0[i]), 'C0': float(self.C0[i]), 's': float(self.s[i])}
+
+    @classmethod
+    def from_records(cls, records: Dict[str, Dict[str, float]]) -> 'HugoniotTable':
+        """
+        Build table from {name: {'rho0', 'C0', 's'}} in solver units.
+        """
+        names = sorted(records.keys())
+        return cls(
+            names,
+            [records[n]['rho0'] for n in names],
+            [records[n]['C0'] for n in names],
+            [records[n]['s'] for n in names]
+        )
+
+    @classmethod
+    def from_service(cls, service, material_ids: Optional[List[int]] = None) -> 'HugoniotTable':
+        """
+        Build table from VisualizationDataService.get_usup_parameters_batch()
+        (one query for the materials, one for their parameters).
+
+        Args:
+            service: VisualizationDataService instance
+            material_ids: Materials to include (all materials if None)
+
+        Returns:
+            HugoniotTable with every material that has complete parameters
+        """
+        if material_ids is None:
+            materials = service.get_all_materials()
+        else:
+            materials = service.get_materials_by_ids(material_ids)
+
+        usup = service.get_usup_parameters_batch([m['material_id'] for m in materials])
+
+        records = {}
+        for material in materials:
+            params = usup_to_solver_units(usup.get(material['material_id']))
+            if params:
+                records[material['name']] = params
+
+        return cls.from_records(records)
+
+
+def solve_matrix(table: HugoniotTable, velocities,
+                 flyers: Optional[List[str]] = None,
+                 targets: Optional[List[str]] = None) -> Dict[str, Any]:
+    """
+    Solve every flyer × target × velocity combination at once.
+
+    Args:
+        table: HugoniotTable with material parameters
+        velocities: Impact velocities [km/s]
+        flyers: Flyer material names (all table materials if None)
+        targets: Target material names (all table materials if None)
+
+    Returns:
+        Dictionary with:
+        - flyers, targets, velocities: Axis labels
+        - up, P, us_target, us_flyer, v_ratio_target: Arrays shaped
+          (n_flyers, n_targets, n_velocities)
+        - elapsed_s: Wall time of the vectorized solve
+    """
+    flyers = flyers if flyers is not None else table.names
+    targets = targets if targets is not None else table.names
+    velocities = np.atleast_1d(np.asarray(velocities, dtype=float))
+
+    fi = np.array([table.index_of(n) for n in flyers], dtype=int)
+    ti = np.array([table.index_of(n) for n in targets], dtype=int)
+
+    start = time.perf_counter()
+    result = solve_interface(
+        table.rho0[fi][:, None, None], table.C0[fi][:, None, None], table.s[fi][:, None, None],
+        table.rho0[ti][None, :, None], table.C0[ti][None, :, None], table.s[ti][None, :, None],
+        velocities[None, None, :]
+    )
+    elapsed = time.perf_counter() - start
+
+    result.update({
+        'flyers': list(flyers),
+        'targets': list(targets),
+        'velocities': velocities,
+        'elapsed_s': elapsed
+    })
+    return result
+
+
+def solve_stack(table: HugoniotTable, flyer: str, layers: List[str],
+                velocities) -> List[Dict[str, Any]]:
+    """
+    Solve a multi-layer target stack by chaining interface solves.
+
+    The first interface is the flyer impacting layer 1 at the impact
+    velocity. Each following interface treats the previous layer as the
+    "flyer" with effective velocity 2*Up (mirror-image approximation of
+    its release or reshock path through the shocked state).
+
+    Args:
+        table: HugoniotTable with material parameters
+        flyer: Flyer material name
+        layers: Target layer names, impact side first
+        velocities: Impact velocities [km/s] (scalar or array)
+
+    Returns:
+        List with one dictionary per interface:
+        {'upstream', 'downstream', 'up', 'P', 'us_target', 'v_ratio_target'}
+    """
+    velocities = np.atleast_1d(np.asarray(velocities, dtype=float))
+
+    interfaces = []
+    upstream = flyer
+    upstream_params = table.get(flyer)
+    effective_velocity = velocities
+
+    for layer in layers:
+        layer_params = table.get(layer)
+        state = solve_interface(
+            upstream_params['rho0'], upstream_params['C0'], upstream_params['s'],
+            layer_params['rho0'], layer_params['C0'], layer_params['s'],
+            effective_velocity
+        )
+        interfaces.append({
+            'upstream': upstream,
+            'downstream': layer,
+            'up': state['up'],
+            'P': state['P'],
+            'us_target': state['us_target'],
+            'v_ratio_target': state['v_ratio_target']
+        })
+
+        # Next interface: this layer's Hugoniot mirrored about its state
+        upstream = layer
+        upstream_params = layer_params
+        effective_velocity = 2.0 * state['up']
+
+    return interfaces
+
+
+def mirror_curves(table: HugoniotTable, flyer: str, target: str, velocity: float,
+                  n_points: int = 200) -> Dict[str, np.ndarray]:
+    """
+    Generate P-Up curves for the impedance-matching diagram.
+
+    Args:
+        table: HugoniotTable with material parameters
+        flyer: Flyer material name
+        target: Target material name
+        velocity: Impact velocity [km/s]
+        n_points: Curve resolution
+
+    Returns:
+        Dictionary with:
+        - up: Particle velocity grid [0, V]
+        - P_target: Target principal Hugoniot
+        - P_flyer: Flyer Hugoniot mirrored about V/2 (P = P_H(V - Up))
+        - up_match, P_match: Intersection (interface state)
+    """
+    f = table.get(flyer)
+    t = table.get(target)
+    up = np.linspace(0.0, velocity, n_points)
+    state = solve_interface(f['rho0'], f['C0'], f['s'], t['rho0'], t['C0'], t['s'], velocity)
+
+    return {
+        'up': up,
+        'P_target': hugoniot_pressure(t['rho0'], t['C0'], t['s'], up),
+        'P_flyer': hugoniot_pressure(f['rho0'], f['C0'], f['s'], velocity - up),
+        'up_match': float(state['up']),
+        'P_match': float(state['P'])
+    }
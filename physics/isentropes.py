@@ -0,0 +1,366 @@
+"""
+Release Isentropes and Reshock Hugoniots (Off-Hugoniot States)
+
+Mie-Grüneisen EOS referenced to the linear Us-Up principal Hugoniot,
+with Gamma/V held constant (Gamma * rho = Gamma0 * rho0):
+
+    P(V, e) = P_H(V) + (Gamma0 / V0) * (e - e_H(V))
+
+Units match physics.impedance (no conversion factors needed):
+    rho0 [g/cm³], V [cm³/g], C0/Up [km/s], P [GPa], e [kJ/g = (km/s)²]
+
+Release isentropes (de = -P dV) are integrated with RK4 for a whole batch
+of Hugoniot starting states at once. Each state is mapped onto a common
+normalized volume coordinate, so one array operation advances every curve.
+The particle velocity along the release follows the Riemann integral
+
+    Up(V) = Up_H + ∫ sqrt(-dP/dV) dV
+
+(a wave facing back into the shocked material, e.g. free-surface or
+low-impedance window release). Reshock Hugoniots centered on a shocked
+state are closed form, because the Rankine-Hugoniot energy equation is
+linear in P for this EOS.
+
+Both are the exact counterparts of the mirror-image approximation used
+in physics.impedance.
+
+Author: Materials Database Team
+"""
+
+from collections import OrderedDict
+from typing import Dict, Optional, Any
+import csv
+import hashlib
+import json
+
+import numpy as np
+
+
+# ============================================================================
+# REFERENCE HUGONIOT
+# ============================================================================
+
+def _reference(V, rho0, C0, s):
+    """
+    Principal Hugoniot pressure and energy with volume derivatives.
+
+    Returns:
+        (P_H, dP_H/dV, e_H, de_H/dV)
+    """
+    V0 = 1.0 / rho0
+    eta = 1.0 - V / V0
+    denom = 1.0 - s * eta
+    p_h = rho0 * C0 ** 2 * eta / denom ** 2
+    dp_h = -rho0 * C0 ** 2 * (1.0 + s * eta) / denom ** 3 / V0
+    e_h = 0.5 * p_h * (V0 - V)
+    de_h = 0.5 * (dp_h * (V0 - V) - p_h)
+    return p_h, dp_h, e_h, de_h
+
+
+def hugoniot_states(rho0: float, C0: float, s: float, up) -> Dict[str, np.ndarray]:
+    """
+    Principal Hugoniot states for particle velocities up.
+
+    Returns:
+        {'up', 'us', 'P', 'V', 'V_ratio', 'e'} arrays
+    """
+    up = np.atleast_1d(np.asarray(up, dtype=float))
+    us = C0 + s * up
+    V0 = 1.0 / rho0
+    V = V0 * (1.0 - up / us)
+    return {
+        'up': up,
+        'us': us,
+        'P': rho0 * us * up,
+        'V': V,
+        'V_ratio': V / V0,
+        'e': 0.5 * up ** 2
+    }
+
+
+def up_at_pressure(rho0: float, C0: float, s: float, P) -> np.ndarray:
+    """Particle velocity on the principal Hugoniot for pressures P [GPa]."""
+    P = np.atleast_1d(np.asarray(P, dtype=float))
+    if s == 0.0:
+        return P / (rho0 * C0)
+    return (np.sqrt(C0 ** 2 + 4.0 * s * P / rho0) - C0) / (2.0 * s)
+
+
+# ============================================================================
+# RELEASE ISENTROPES
+# ============================================================================
+
+def release_isentropes(rho0: float, C0: float, s: float, gamma0: float, up_start,
+                       v_end_ratio: float = 1.1, n_points: int = 200) -> Dict[str, Any]:
+    """
+    Release isentropes from many Hugoniot states in one vectorized batch.
+
+    Args:
+        rho0, C0, s: Linear Us-Up parameters (solver units)
+        gamma0: Ambient Grüneisen coefficient
+        up_start: Hugoniot particle velocities of the starting states [km/s]
+        v_end_ratio: Final V/V0 of every release curve (> 1 reaches tension)
+        n_points: Points per curve
+
+    Returns:
+        Dictionary with:
+        - start: Hugoniot starting states (see hugoniot_states)
+        - V, V_ratio, P, e, up: Arrays shaped (n_states, n_points)
+    """
+    start = hugoniot_states(rho0, C0, s, up_start)
+    V0 = 1.0 / rho0
+    k = gamma0 * rho0
+
+    v_begin = start['V']
+    span = v_end_ratio * V0 - v_begin
+    tau = np.linspace(0.0, 1.0, n_points)
+    h = tau[1] - tau[0]
+
+    def rhs(V, e):
+        p_h, dp_h, e_h, de_h = _reference(V, rho0, C0, s)
+        P = p_h + k * (e - e_h)
+        dpdv = dp_h + k * (-P - de_h)
+        return -P * span, np.sqrt(np.maximum(-dpdv, 0.0)) * span
+
+    n_states = len(v_begin)
+    V_out = v_begin[:, None] + span[:, None] * tau[None, :]
+    e_out = np.empty((n_states, n_points))
+    u_out = np.empty((n_states, n_points))
+
+    e = start['e'].copy()
+    u = start['up'].copy()
+    e_out[:, 0] = e
+    u_out[:, 0] = u
+    for i in range(n_points - 1):
+        V = V_out[:, i]
+        V_half = V + 0.5 * h * span
+        k1e, k1u = rhs(V, e)
+        k2e, k2u = rhs(V_half, e + 0.5 * h * k1e)
+        k3e, k3u = rhs(V_half, e + 0.5 * h * k2e)
+        k4e, k4u = rhs(V_out[:, i + 1], e + h * k3e)
+        e = e + h / 6.0 * (k1e + 2.0 * k2e + 2.0 * k3e + k4e)
+        u = u + h / 6.0 * (k1u + 2.0 * k2u + 2.0 * k3u + k4u)
+        e_out[:, i + 1] = e
+        u_out[:, i + 1] = u
+
+    p_h, _, e_h, _ = _reference(V_out, rho0, C0, s)
+
+    return {
+        'start': start,
+        'V': V_out,
+        'V_ratio': V_out / V0,
+        'P': p_h + k * (e_out - e_h),
+        'e': e_out,
+        'up': u_out
+    }
+
+
+# ============================================================================
+# RESHOCK HUGONIOTS
+# ============================================================================
+
+def reshock_hugoniots(rho0: float, C0: float, s: float, gamma0: float, up_start,
+                      compression: float = 0.15, n_points: int = 200) -> Dict[str, Any]:
+    """
+    Second-shock Hugoniots centered on many Hugoniot states.
+
+    From state 1 (V1, P1, e1) to V2 < V1 the energy jump
+    e2 = e1 + (P1 + P2)(V1 - V2)/2 gives, with the MG EOS,
+
+        P2 = [P_H(V2) + k (e1 + P1 (V1 - V2)/2 - e_H(V2))] / (1 - k (V1 - V2)/2)
+
+    Points beyond the EOS validity (non-positive denominator) are NaN.
+
+    Args:
+        rho0, C0, s: Linear Us-Up parameters (solver units)
+        gamma0: Ambient Grüneisen coefficient
+        up_start: Hugoniot particle velocities of the centering states [km/s]
+        compression: Additional fractional compression V2 = V1 (1 - x), x in [0, compression]
+        n_points: Points per curve
+
+    Returns:
+        Dictionary with start states and (n_states, n_points) arrays
+        V, V_ratio, P, e, up (Up decreases across a reflected reshock)
+    """
+    start = hugoniot_states(rho0, C0, s, up_start)
+    V0 = 1.0 / rho0
+    k = gamma0 * rho0
+
+    V1 = start['V'][:, None]
+    P1 = start['P'][:, None]
+    e1 = start['e'][:, None]
+    V2 = V1 * (1.0 - np.linspace(0.0, compression, n_points)[None, :])
+    dv = V1 - V2
+
+    p_h, _, e_h, _ = _reference(V2, rho0, C0, s)
+    denom = 1.0 - 0.5 * k * dv
+    valid = (denom > 0.0) & (1.0 - s * (1.0 - V2 / V0) > 0.0)
+
+    with np.errstate(divide='ignore', invalid='ignore'):
+        P2 = np.where(valid, (p_h + k * (e1 + 0.5 * P1 * dv - e_h)) / denom, np.nan)
+        e2 = e1 + 0.5 * (P1 + P2) * dv
+        u2 = start['up'][:, None] - np.sqrt(np.maximum((P2 - P1) * dv, 0.0))
+
+    return {
+        'start': start,
+        'V': V2,
+        'V_ratio': V2 / V0,
+        'P': P2,
+        'e': e2,
+        'up': np.where(valid, u2, np.nan)
+    }
+
+
+# ============================================================================
+# CACHED ENGINE
+# ============================================================================
+
+def parameter_hash(params: Dict[str, float], **options) -> str:
+    """Stable hash of EOS parameters and curve options."""
+    payload = {k: round(float(v), 12) for k, v in params.items()}
+    for key, value in options.items():
+        if isinstance(value, np.ndarray) or isinstance(value, (list, tuple)):
+            value = [round(float(v), 12) for v in np.atleast_1d(value)]
+        payload[key] = value
+    return hashlib.sha1(json.dumps(payload, sort_keys=True).encode('utf-8')).hexdigest()
+
+
+class OffHugoniotEngine:
+    """
+    Release/reshock generator with a per-(material, parameter hash) LRU cache.
+
+    Example:
+        >>> engine = OffHugoniotEngine()
+        >>> params = {'rho0': 8.93, 'C0': 3.94, 's': 1.49, 'gamma0': 2.0}
+        >>> family = engine.release('Copper', params, pressures=[20, 50, 100])
+        >>> write_family_csv(family, 'copper_release.csv')
+    """
+
+    def __init__(self, max_entries: int = 64):
+        self.max_entries = max_entries
+        self._cache = OrderedDict()
+        self.hits = 0
+        self.misses = 0
+
+    def _get(self, key, compute):
+        if key in self._cache:
+            self._cache.move_to_end(key)
+            self.hits += 1
+            return self._cache[key]
+
+        self.misses += 1
+        family = compute()
+        self._cache[key] = family
+        if len(self._cache) > self.max_entries:
+            self._cache.popitem(last=False)
+        return family
+
+    def _start_states(self, params: Dict[str, float], up_start, pressures):
+        if up_start is None:
+            if pressures is None:
+                raise ValueError("Provide starting particle velocities or pressures")
+            up_start = up_at_pressure(params['rho0'], params['C0'], params['s'], pressures)
+        return np.atleast_1d(np.asarray(up_start, dtype=float))
+
+    def release(self, material: str, params: Dict[str, float], up_start=None,
+                pressures=None, v_end_ratio: float = 1.1, n_points: int = 200) -> Dict[str, Any]:
+        """
+        Release isentrope family (cached).
+
+        Args:
+            material: Material name (cache namespace)
+            params: {'rho0', 'C0', 's', 'gamma0'} in solver units
+            up_start: Starting Hugoniot particle velocities [km/s]
+            pressures: Starting Hugoniot pressures [GPa] (used if up_start is None)
+            v_end_ratio, n_points: See release_isentropes()
+        """
+        up = self._start_states(params, up_start, pressures)
+        key = (material, 'release',
+               parameter_hash(params, up=up, v_end_ratio=v_end_ratio, n_points=n_points))
+        return self._get(key, lambda: dict(release_isentropes(
+            params['rho0'], params['C0'], params['s'], params['gamma0'], up,
+            v_end_ratio=v_end_ratio, n_points=n_points), kind='release', material=material))
+
+    def reshock(self, material: str, params: Dict[str, float], up_start=None,
+                pressures=None, compression: float = 0.15, n_points: int = 200) -> Dict[str, Any]:
+        """Reshock Hugoniot family (cached). Arguments as in release()."""
+        up = self._start_states(params, up_start, pressures)
+        key = (material, 'reshock',
+               parameter_hash(params, up=up, compression=compression, n_points=n_points))
+        return self._get(key, lambda: dict(reshock_hugoniots(
+            params['rho0'], params['C0'], params['s'], params['gamma0'], up,
+            compression=compression, n_points=n_points), kind='reshock', material=material))
+
+    def clear(self, material: Optional[str] = None):
+        """Drop cached curves (all, or for one material)."""
+        if material is None:
+            self._cache.clear()
+            return
+        for key in [k for k in self._cache if k[0] == material]:
+            del self._cache[key]
+
+
+# ============================================================================
+# OUTPUT
+# ============================================================================
+
+FAMILY_COLUMNS = ['material', 'kind', 'curve', 'P_start', 'Up_start',
+                  'V_ratio', 'P', 'Up', 'e']
+
+
+def family_to_columns(family: Dict[str, Any]) -> Dict[str, np.ndarray]:
+    """
+    Flatten a curve family to long-format columns (one row per point).
+
+    Returns:
+        Dictionary keyed by FAMILY_COLUMNS
+    """
+    n_states, n_points = family['P'].shape
+    curve = np.repeat(np.arange(n_states), n_points)
+    return {
+        'material': np.full(curve.size, family.get('material', ''), dtype=object),
+        'kind': np.full(curve.size, family.get('kind', ''), dtype=object),
+        'curve': curve,
+        'P_start': family['start']['P'][curve],
+        'Up_start': family['start']['up'][curve],
+        'V_ratio': family['V_ratio'].ravel(),
+        'P': family['P'].ravel(),
+        'Up': family['up'].ravel(),
+        'e': family['e'].ravel()
+    }
+
+
+def write_family_csv(family: Dict[str, Any], file_path: str):
+    """Write a curve family as long-format CSV."""
+    columns = family_to_columns(family)
+    with open(file_path, 'w', newline='') as f:
+        writer = csv.writer(f)
+        writer.writerow(FAMILY_COLUMNS)
+        writer.writerows(zip(*[columns[name] for name in FAMILY_COLUMNS]))
+
+
+def write_family_parquet(family: Dict[str, Any], file_path: str):
+    """
+    Write a curve family as Parquet.
+
+    Raises:
+        ImportError: If pyarrow is not installed
+    """
+    try:
+        import pyarrow as pa
+        import pyarrow.parquet as pq
+    except ImportError as e:
+        raise ImportError("Parquet output requires pyarrow (pip install pyarrow)") from e
+
+    columns = family_to_columns(family)
+    table = pa.table({name: list(columns[name]) if columns[name].dtype == object else columns[name]
+                      for name in FAMILY_COLUMNS})
+    pq.write_table(table, file_path, compression='zstd')
+
+
+def write_family(family: Dict[str, Any], file_path: str):
+    """Write a curve family, choosing Parquet or CSV from the file extension."""
+    if str(file_path).lower().endswith('.parquet'):
+        write_family_parquet(family, file_path)
+    else:
+        write_family_csv(family, file_path)
@@ -0,0 +1,322 @@
+"""
+Material Parameter Extraction for Physics Solvers
+
+Pulls numeric model parameters out of the nested dictionaries returned by
+MaterialQuerier.get_material_by_name() / parse_material_xml() and converts
+them to SI units:
+
+    density [kg/m³], velocity [m/s], pressure/stress [Pa],
+    specific energy [J/kg], specific heat [J/kg/K], temperature [K],
+    activation energy [J/mol], heat release [J/kg]
+
+Values are stored as TEXT with per-entry units and several references per
+property. Unless a specific entry index is requested, the first entry with
+a usable value (lowest index) is taken, which is the same entry the
+exporter writes first.
+
+Author: Materials Database Team
+"""
+
+from typing import Dict, List, Optional, Any
+
+import numpy as np
+
+
+# Unit conversion factors into SI
+_SI_FACTORS = {
+    # density
+    'kg/m3': 1.0, 'kg/m^3': 1.0, 'kg/m³': 1.0,
+    'g/cm3': 1.0e3, 'g/cm^3': 1.0e3, 'g/cm³': 1.0e3, 'g/cc': 1.0e3,
+    # velocity
+    'm/s': 1.0, 'km/s': 1.0e3, 'mm/us': 1.0e3, 'mm/μs': 1.0e3, 'cm/s': 1.0e-2,
+    # pressure
+    'Pa': 1.0, 'kPa': 1.0e3, 'MPa': 1.0e6, 'GPa': 1.0e9, 'kbar': 1.0e8, 'Mbar': 1.0e11,
+    # specific energy / heat
+    'J/kg': 1.0, 'kJ/kg': 1.0e3, 'MJ/kg': 1.0e6, 'J/g': 1.0e3, 'cal/g': 4184.0,
+    'J/kg/K': 1.0, 'J/kgK': 1.0, 'J/kg-K': 1.0, 'kJ/kg/K': 1.0e3, 'kJ/kg-K': 1.0e3, 'J/g/K': 1.0e3,
+    'cal/g-°C': 4184.0, 'cal/g-K': 4184.0,
+    # molar energy
+    'J/mol': 1.0, 'kJ/mol': 1.0e3, 'cal/mol': 4.184, 'kcal/mol': 4184.0,
+    # thermal conductivity
+    'W/m/K': 1.0, 'W/mK': 1.0, 'W/m-K': 1.0, 'cal/sec-cm-°C': 418.4, 'cal/s-cm-K': 418.4,
+    # rates / dimensionless
+    '1/s': 1.0, '1': 1.0, 'K': 1.0,
+}
+
+# JWL energy is given per unit initial volume (Mbar = 1e11 J/m³)
+_VOLUMETRIC_ENERGY_FACTORS = {'Mbar': 1.0e11, 'GPa': 1.0e9, 'J/m3': 1.0, 'J/m^3': 1.0}
+
+GAS_CONSTANT = 8.314462618  # J/mol/K
+
+
+def to_si(value, unit: Optional[str] = None) -> float:
+    """
+    Convert a stored TEXT value to an SI float.
+
+    Args:
+        value: Stored value (string or number)
+        unit: Unit string from the database (None or unknown = already SI)
+
+    Returns:
+        Float value in SI units, NaN if empty or not numeric
+    """
+    try:
+        number = float(value)
+    except (TypeError, ValueError):
+        return float('nan')
+
+    if unit:
+        number *= _SI_FACTORS.get(unit.strip().replace(' ', ''), 1.0)
+    return number
+
+
+def entry_values(entries: Any, unit: Optional[str] = None) -> List[float]:
+    """
+    Get every usable value of a multi-reference property in SI units.
+
+    Args:
+        entries: List of {'value', 'unit', 'ref', 'index'} dicts, a
+                 {'unit', 'entries': [...]} property dict or a single entry
+        unit: Fallback unit when entries carry none
+
+    Returns:
+        List of finite floats ordered by entry index
+    """
+    if entries is None:
+        return []
+
+    if isinstance(entries, dict) and 'entries' in entries:
+        unit = entries.get('unit') or unit
+        entries = entries['entries']
+    elif isinstance(entries, dict):
+        entries = [entries]
+
+    ordered = sorted(entries, key=lambda e: int(e.get('index') or 0))
+
+    values = []
+    for entry in ordered:
+        number = to_si(entry.get('value'), entry.get('unit') or unit)
+        if np.isfinite(number):
+            values.append(number)
+    return values
+
+
+def first_value(entries: Any, unit: Optional[str] = None) -> Optional[float]:
+    """Get the first usable value of a property in SI units (None if absent)."""
+    values = entry_values(entries, unit)
+    return values[0] if values else None
+
+
+def _param(params: Dict[str, Any], name: str) -> Optional[float]:
+    """Get a single {'value', 'unit'} model parameter in SI (None if absent)."""
+    entry = params.get(name) if params else None
+    if not isinstance(entry, dict):
+        return None
+    number = to_si(entry.get('value'), entry.get('unit'))
+    return number if np.isfinite(number) else None
+
+
+def _eos_row(material_data: Dict[str, Any], index: int) -> Dict[str, Any]:
+    """Get EOS row parameters by row index (empty dict if absent)."""
+    eos = material_data.get('models', {}).get('EOSModel') or {}
+    for row in eos.get('rows', []):
+        if str(row.get('index')) == str(index):
+            return row.get('parameters', {})
+    return {}
+
+
+def _thermo(material_data: Dict[str, Any]) -> Dict[str, Any]:
+    """Get ElasticModel ThermoMechanical parameters."""
+    elastic = material_data.get('models', {}).get('ElasticModel') or {}
+    return elastic.get('ThermoMechanical') or {}
+
+
+# ============================================================================
+# PROPERTY GETTERS
+# ============================================================================
+
+def get_density(material_data: Dict[str, Any]) -> Optional[float]:
+    """
+    Initial density [kg/m³] from ThermoMechanical, Mechanical or
+    (10-category files) Physical_Properties TMD.
+    """
+    value = first_value(_thermo(material_data).get('Density'))
+    if value is None:
+        mechanical = material_data.get('properties', {}).get('Mechanical', {})
+        value = first_value(mechanical.get('Density'))
+    if value is None:
+        physical = material_data.get('properties', {}).get('Physical_Properties', {})
+        value = first_value(physical.get('TMD'))
+    return value
+
+
+def get_specific_heat(material_data: Dict[str, Any]) -> Optional[float]:
+    """
+    Specific heat [J/kg/K], preferring Cv over Cp.
+
+    Entries below 10 are taken to be J/g/K (several files mix both).
+    """
+    thermal = material_data.get('properties', {}).get('Thermal', {})
+    for name in ('Cv', 'Cp'):
+        for value in entry_values(thermal.get(name)):
+            return value * 1.0e3 if value < 10.0 else value
+    return None
+
+
+def get_isobaric_heat(material_data: Dict[str, Any]) -> Optional[float]:
+    """
+    Isobaric specific heat [J/kg/K] from ThermoMechanical SpecificHeatIsobaric,
+    Thermal Cp or (10-category files) Thermal_Properties Cp_estimated.
+
+    Entries below 10 are taken to be J/g/K.
+    """
+    properties = material_data.get('properties', {})
+    candidates = (
+        _thermo(material_data).get('SpecificHeatIsobaric'),
+        properties.get('Thermal', {}).get('Cp'),
+        properties.get('Thermal_Properties', {}).get('Cp_estimated')
+    )
+    for entries in candidates:
+        for value in entry_values(entries):
+            return value * 1.0e3 if value < 10.0 else value
+    return None
+
+
+def get_thermal_conductivity(material_data: Dict[str, Any]) -> Optional[float]:
+    """
+    Thermal conductivity [W/m/K] from ThermoMechanical, Thermal or
+    (10-category files) Thermal_Properties k.
+    """
+    properties = material_data.get('properties', {})
+    candidates = (
+        _thermo(material_data).get('ThermalConductivity'),
+        properties.get('Thermal', {}).get('ThermalConductivity'),
+        properties.get('Thermal_Properties', {}).get('k')
+    )
+    for entries in candidates:
+        value = first_value(entries)
+        if value is not None:
+            return value
+    return None
+
+
+def get_mie_gruneisen(material_data: Dict[str, Any],
+                      overrides: Optional[Dict[str, float]] = None) -> Dict[str, Optional[float]]:
+    """
+    Mie-Grüneisen parameters with a linear Us-Up reference Hugoniot.
+
+    Lookup order per parameter:
+        rho0:  EOS row 3 Rho, then Density
+        c0:    EOS row 3 Cs, then SoundSpeed, then sqrt(K0/rho0) from row 1
+        s:     EOS row 3 s, then (K0' + 1)/4 from row 1
+        gamma: EOS row 3 Gamma, then GruneisenCoefficient, then 2s - 1
+
+    Args:
+        material_data: Material dictionary from MaterialQuerier
+        overrides: Values that replace database lookups ({'s': 1.49, ...})
+
+    Returns:
+        {'rho0', 'c0', 's', 'gamma'} in SI (missing entries are None)
+    """
+    overrides = overrides or {}
+    row1 = _eos_row(material_data, 1)
+    row3 = _eos_row(material_data, 3)
+    thermo = _thermo(material_data)
+
+    rho0 = _param(row3, 'Rho') or get_density(material_data)
+
+    c0 = _param(row3, 'Cs') or first_value(thermo.get('SoundSpeed'))
+    k0 = _param(row1, 'K0')
+    if c0 is None and k0 and rho0:
+        c0 = float(np.sqrt(k0 / rho0))
+
+    s = _param(row3, 's')
+    k0_prime = _param(row1, 'K0Prime')
+    if s is None and k0_prime is not None:
+        s = 0.25 * (k0_prime + 1.0)
+
+    params = {'rho0': rho0, 'c0': c0, 's': s}
+    params.update({k: v for k, v in overrides.items() if k in ('rho0', 'c0', 's')})
+
+    gamma = overrides.get('gamma') or _param(row3, 'Gamma') or first_value(thermo.get('GruneisenCoefficient'))
+    if gamma is None and params['s'] is not None:
+        gamma = 2.0 * params['s'] - 1.0
+    params['gamma'] = gamma
+
+    return params
+
+
+def get_jwl(material_data: Dict[str, Any], phase: str = 'reacted') -> Optional[Dict[str, float]]:
+    """
+    JWL parameters from EOS row 6.
+
+    Args:
+        material_data: Material dictionary from MaterialQuerier
+        phase: 'reacted' (detonation products) or 'unreacted'
+
+    Returns:
+        {'A', 'B' [Pa], 'R1', 'R2', 'w', 'E0' [J/m³] (may be None)} or None
+        when A, B, R1, R2 or w is missing
+    """
+    params = _eos_row(material_data, 6).get(phase) or {}
+
+    jwl = {name: _param(params, name) for name in ('A', 'B', 'R1', 'R2', 'w')}
+    if any(v is None for v in jwl.values()):
+        return None
+
+    e0 = params.get('E0') or {}
+    try:
+        jwl['E0'] = float(e0.get('value')) * _VOLUMETRIC_ENERGY_FACTORS.get(e0.get('unit') or 'J/m3', 1.0)
+    except (TypeError, ValueError):
+        jwl['E0'] = None
+
+    return jwl
+
+
+def get_johnson_cook(material_data: Dict[str, Any]) -> Optional[Dict[str, Optional[float]]]:
+    """
+    Johnson-Cook strength constants and shear modulus.
+
+    Returns:
+        {'A', 'B' [Pa], 'n', 'C', 'M', 'strain_rate' [1/s], 'T_ref', 'T_melt' [K],
+         'G' [Pa]} or None when A or the shear modulus is missing
+    """
+    plastic = material_data.get('models', {}).get('ElastoPlastic') or {}
+    constants = plastic.get('JohnsonCookModelConstants') or {}
+
+    jc = {
+        'A': _param(constants, 'A'),
+        'B': _param(constants, 'B') or 0.0,
+        'n': _param(constants, 'n') or 1.0,
+        'C': _param(constants, 'C') or 0.0,
+        'M': _param(constants, 'M') or 1.0,
+        'strain_rate': _param(constants, 'StrainRate') or 1.0,
+        'T_ref': _param(constants, 'ReferenceTemperature') or 293.0,
+        'T_melt': _param(constants, 'MeltingTemperature')
+                  or first_value(_thermo(material_data).get('MeltingTemperature')),
+        'G': first_value(plastic.get('ShearModulus'))
+    }
+
+    if jc['A'] is None or jc['G'] is None:
+        return None
+    return jc
+
+
+def get_arrhenius(material_data: Dict[str, Any]) -> Optional[Dict[str, float]]:
+    """
+    Single-step Arrhenius kinetics from ReactionModelParameter.
+
+    Returns:
+        {'Ea' [J/mol], 'lnZ' [ln(1/s)], 'Q' [J/kg]} or None if incomplete
+    """
+    reaction = material_data.get('models', {}).get('ReactionModel') or {}
+    params = reaction.get('ReactionModelParameter') or {}
+
+    kinetics = {
+        'Ea': _param(params, 'Ea'),
+        'lnZ': _param(params, 'lnZ'),
+        'Q': _param(params, 'Q_R')
+    }
+    if any(v is None for v in kinetics.values()):
+        return None
+    return kinetics
@@ -0,0 +1,307 @@
+"""
+Mixture Rules for Formulated Explosives
+
+Derives formulation properties from constituent data and mass fractions w_i:
+
+    density:   1/rho0 = sum w_i / rho0_i            (volume additivity)
+    Cp:        cp = sum w_i cp_i                     (mass average)
+    Hugoniot:  V(P) = sum w_i V_i(P)                 (pressure equilibrium)
+
+For the Hugoniot every constituent is put on its own linear Us-Up Hugoniot
+at a common pressure P; the mixture state then follows from the jump
+conditions, up = sqrt(P (V0 - V)) and Us = V0 sqrt(P / (V0 - V)), and a
+linear Us-Up fit over the pressure grid gives the mixture C0 and s.
+
+Constituents are held in a column-oriented table and compositions in an
+(n_compositions × n_constituents) weight matrix, so a sweep over thousands
+of compositions is a handful of matrix products with no Python loops.
+
+Units follow the impedance solver: rho0 [g/cm³], C0 [km/s], P [GPa];
+cp is in J/kg/K.
+
+Author: Materials Database Team
+"""
+
+from typing import Dict, List, Optional, Any
+import itertools
+import time
+
+import numpy as np
+
+from physics.material_params import get_density, get_isobaric_heat, get_mie_gruneisen
+
+
+# Nominal compositions (mass fractions) of formulations in xml/.
+# Binders that are not in the database are left out, so fractions may sum
+# to less than one: Comp B 60/40 RDX/TNT (+1% wax), C-4 91% RDX,
+# PBX-9404 94% HMX (+ nitrocellulose / CEF).
+DEFAULT_COMPOSITIONS = {
+    'COMP-B': {'RDX': 0.60, 'TNT': 0.40},
+    'COMP-C4': {'RDX': 0.91},
+    'PBX-9404': {'HMX': 0.94},
+}
+
+# Pressures used to build and fit mixture Hugoniots [GPa]
+DEFAULT_PRESSURES = np.linspace(1.0, 40.0, 40)
+
+PROPERTY_NAMES = ('rho0', 'cp', 'C0', 's')
+
+
+class ConstituentTable:
+    """
+    Column-oriented constituent properties.
+
+    Missing values are stored as NaN; a mixture property is NaN whenever a
+    constituent with non-zero weight lacks the corresponding input.
+    """
+
+    def __init__(self, names: List[str], rho0, cp, C0, s):
+        """
+        Initialize table from parallel arrays.
+
+        Args:
+            names: Constituent names
+            rho0: Densities [g/cm³]
+            cp: Isobaric specific heats [J/kg/K]
+            C0: Bulk sound speeds [km/s]
+            s: Us-Up slopes
+        """
+        self.names = list(names)
+        self.rho0 = np.asarray(rho0, dtype=float)
+        self.cp = np.asarray(cp, dtype=float)
+        self.C0 = np.asarray(C0, dtype=float)
+        self.s = np.asarray(s, dtype=float)
+        self._index = {name: i for i, name in enumerate(self.names)}
+
+    def __len__(self):
+        return len(self.names)
+
+    def __contains__(self, name: str) -> bool:
+        return name in self._index
+
+    def index_of(self, name: str) -> int:
+        """Get column index for a constituent name (KeyError if missing)."""
+        if name not in self._index:
+            raise KeyError(f"No constituent data for material: {name}")
+        return self._index[name]
+
+    def subset(self, names: List[str]) -> 'ConstituentTable':
+        """Table restricted to (and ordered as) the given constituents."""
+        idx = [self.index_of(n) for n in names]
+        return ConstituentTable(names, self.rho0[idx], self.cp[idx], self.C0[idx], self.s[idx])
+
+    @classmethod
+    def from_material_data(cls, materials: Dict[str, Dict[str, Any]],
+                           hugoniot_overrides: Optional[Dict[str, Dict[str, float]]] = None
+                           ) -> 'ConstituentTable':
+        """
+        Build table from material dictionaries.
+
+        Args:
+            materials: {name: material data} (MaterialQuerier.get_materials_batch())
+            hugoniot_overrides: {name: {'rho0', 'C0', 's'}} in solver units
+                                (e.g. HugoniotTable records) taking precedence
+                                over EOS parameters
+
+        Returns:
+            ConstituentTable with one column per material (sorted by name)
+        """
+        hugoniot_overrides = hugoniot_overrides or {}
+        names = sorted(materials)
+        columns = {key: [] for key in PROPERTY_NAMES}
+
+        for name in names:
+            data = materials[name]
+            rho = get_density(data)
+            mg = get_mie_gruneisen(data)
+            override = hugoniot_overrides.get(name, {})
+
+            columns['rho0'].append(rho * 1.0e-3 if rho else np.nan)
+            columns['cp'].append(get_isobaric_heat(data) or np.nan)
+            columns['C0'].append(override.get('C0') or (mg['c0'] * 1.0e-3 if mg['c0'] else np.nan))
+            columns['s'].append(override.get('s') or mg['s'] or np.nan)
+
+        return cls(names, **columns)
+
+
+# ============================================================================
+# COMPOSITIONS
+# ============================================================================
+
+def composition_matrix(table: ConstituentTable,
+                       compositions: List[Dict[str, float]]) -> Dict[str, np.ndarray]:
+    """
+    Convert composition dictionaries to a normalized weight matrix.
+
+    Fractions are renormalized over the constituents present in the
+    database; the original total is returned as coverage.
+
+    Args:
+        table: Constituent table
+        compositions: [{constituent: mass fraction}, ...]
+
+    Returns:
+        {'W': (n, n_constituents) weights summing to one, 'coverage': (n,)}
+    """
+    W = np.zeros((len(compositions), len(table)))
+    for i, composition in enumerate(compositions):
+        for name, fraction in composition.items():
+            W[i, table.index_of(name)] = fraction
+
+    coverage = W.sum(axis=1)
+    with np.errstate(invalid='ignore'):
+        return {'W': W / coverage[:, None], 'coverage': coverage}
+
+
+def composition_grid(n_constituents: int, step: float = 0.01) -> np.ndarray:
+    """
+    Every composition of n constituents on a simplex grid.
+
+    Args:
+        n_constituents: Number of constituents
+        step: Mass fraction increment (1/step must be an integer)
+
+    Returns:
+        (n_compositions, n_constituents) weight matrix
+    """
+    n = int(round(1.0 / step))
+    if n_constituents == 1:
+        return np.ones((1, 1))
+
+    # Stars and bars: choose n_constituents - 1 bar positions among n + n_constituents - 1
+    bars = np.array(list(itertools.combinations(range(n + n_constituents - 1), n_constituents - 1)))
+    edges = np.hstack([np.full((len(bars), 1), -1), bars, np.full((len(bars), 1), n + n_constituents - 1)])
+    return (np.diff(edges, axis=1) - 1) / n
+
+
+# ============================================================================
+# MIXTURE RULES
+# ============================================================================
+
+def _weighted(W: np.ndarray, values: np.ndarray) -> np.ndarray:
+    """
+    W @ values with NaN wherever a weighted constituent value is missing.
+    values may be (n_constituents,) or (n_constituents, n_points).
+    """
+    missing = np.isnan(values)
+    result = W @ np.where(missing, 0.0, values)
+    incomplete = (W > 0.0).astype(float) @ missing.astype(float) > 0.0
+    return np.where(incomplete, np.nan, result)
+
+
+def mixture_density(W: np.ndarray, rho0) -> np.ndarray:
+    """Volume-additive density for every composition row of W."""
+    return 1.0 / _weighted(W, 1.0 / np.asarray(rho0, dtype=float))
+
+
+def mixture_heat(W: np.ndarray, cp) -> np.ndarray:
+    """Mass-averaged specific heat for every composition row of W."""
+    return _weighted(W, np.asarray(cp, dtype=float))
+
+
+def constituent_volumes(table: ConstituentTable, pressures) -> np.ndarray:
+    """
+    Specific volume [cm³/g] of every constituent on its Hugoniot.
+
+    Returns:
+        (n_constituents, n_pressures) array
+    """
+    P = np.atleast_1d(np.asarray(pressures, dtype=float))[None, :]
+    rho0, C0, s = table.rho0[:, None], table.C0[:, None], table.s[:, None]
+
+    with np.errstate(divide='ignore', invalid='ignore'):
+        up = np.where(s > 0.0,
+                      (np.sqrt(C0 ** 2 + 4.0 * s * P / rho0) - C0) / (2.0 * s),
+                      P / (rho0 * C0))
+        return (1.0 - up / (C0 + s * up)) / rho0
+
+
+def fit_usup(up: np.ndarray, us: np.ndarray) -> Dict[str, np.ndarray]:
+    """
+    Least-squares linear Us = C0 + s Up fit for every row.
+
+    Returns:
+        {'C0', 's', 'rms'} arrays (NaN for rows with missing points)
+    """
+    n = up.shape[1]
+    mean_up = up.mean(axis=1)
+    mean_us = us.mean(axis=1)
+    du = up - mean_up[:, None]
+    s = (du * (us - mean_us[:, None])).sum(axis=1) / (du ** 2).sum(axis=1)
+    c0 = mean_us - s * mean_up
+    rms = np.sqrt(((us - c0[:, None] - s[:, None] * up) ** 2).sum(axis=1) / n)
+    return {'C0': c0, 's': s, 'rms': rms}
+
+
+def mixture_hugoniot(table: ConstituentTable, W: np.ndarray, pressures=None) -> Dict[str, np.ndarray]:
+    """
+    Pressure-equilibrium mixture Hugoniots and their linear Us-Up fits.
+
+    Args:
+        table: Constituent table (columns matching W)
+        W: (n_compositions, n_constituents) mass fractions
+        pressures: Pressure grid [GPa] (DEFAULT_PRESSURES if None)
+
+    Returns:
+        Dictionary with P (n_pressures,), V, up, Us (n_compositions, n_pressures)
+        and the fitted C0, s, rms (n_compositions,)
+    """
+    P = DEFAULT_PRESSURES if pressures is None else np.atleast_1d(np.asarray(pressures, dtype=float))
+
+    V0 = _weighted(W, 1.0 / table.rho0)
+    V = _weighted(W, constituent_volumes(table, P))
+    dV = V0[:, None] - V
+
+    with np.errstate(divide='ignore', invalid='ignore'):
+        up = np.sqrt(P * dV)
+        us = V0[:, None] * np.sqrt(P / dV)
+
+    result = {'P': P, 'V': V, 'up': up, 'Us': us}
+    result.update(fit_usup(up, us))
+    return result
+
+
+def evaluate(table: ConstituentTable, W: np.ndarray, pressures=None) -> Dict[str, Any]:
+    """
+    All mixture properties for every composition row of W.
+
+    Returns:
+        {'rho0', 'cp', 'C0', 's', 'hugoniot', 'elapsed_s'}
+    """
+    start = time.perf_counter()
+    hugoniot = mixture_hugoniot(table, W, pressures)
+    result = {
+        'rho0': mixture_density(W, table.rho0),
+        'cp': mixture_heat(W, table.cp),
+        'C0': hugoniot['C0'],
+        's': hugoniot['s'],
+        'hugoniot': hugoniot
+    }
+    result['elapsed_s'] = time.perf_counter() - start
+    return result
+
+
+def compare_measured(derived: Dict[str, float], measured: Dict[str, Optional[float]]) -> List[Dict[str, Any]]:
+    """
+    Derived versus measured values for one formulation.
+
+    Args:
+        derived: {'rho0', 'cp', 'C0', 's'} from evaluate() for one row
+        measured: Same keys from the formulation's own data (None if absent)
+
+    Returns:
+        List of {'property', 'derived', 'measured', 'difference_pct'} rows
+    """
+    rows = []
+    for key in PROPERTY_NAMES:
+        d = derived.get(key)
+        m = measured.get(key)
+        d = None if d is None or not np.isfinite(d) else float(d)
+        m = None if m is None or not np.isfinite(m) else float(m)
+        rows.append({
+            'property': key,
+            'derived': d,
+            'measured': m,
+            'difference_pct': 100.0 * (d - m) / m if d is not None and m else None
+        })
+    return rows
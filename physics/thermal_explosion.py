@@ -0,0 +1,249 @@
+"""
+Thermal Explosion Critical Temperatures (Frank-Kamenetskii)
+
+Steady-state Frank-Kamenetskii theory for single-step Arrhenius kinetics:
+a charge of characteristic size a (slab half-thickness, cylinder or
+sphere radius) held at wall temperature T explodes when
+
+    delta = a² rho Q Z Ea exp(-Ea / R T) / (k R T²)
+
+exceeds delta_c (0.88 slab, 2.00 infinite cylinder, 3.32 sphere).
+The critical temperature solves
+
+    Ea / (R Tc) + 2 ln Tc = ln(a² rho Q Z Ea / (k R delta_c))
+
+which is monotone in u = 1/T on the physical branch, so every
+material × geometry × size combination is solved by one broadcasted
+Newton iteration in u. The adiabatic induction time at Tc,
+
+    t_ad = cp R Tc² exp(Ea / R Tc) / (Q Ea Z)
+
+is tabulated alongside as a time scale for the cook-off.
+
+Inputs (SI): Ea [J/mol], lnZ [ln(1/s)], Q [J/kg] from ReactionModelParameter,
+k [W/m/K], rho [kg/m³], cp [J/kg/K] from ThermoMechanical/Thermal data.
+Formulations without their own kinetics or thermal data borrow the missing
+inputs from their dominant explosive constituent; the source of every
+input is recorded in the table.
+
+Author: Materials Database Team
+"""
+
+from typing import Dict, List, Optional, Any
+import csv
+import json
+
+import numpy as np
+
+from physics.material_params import (
+    GAS_CONSTANT, get_arrhenius, get_density, get_isobaric_heat, get_thermal_conductivity
+)
+from physics.isentropes import parameter_hash
+
+
+# Critical Frank-Kamenetskii parameter per geometry
+GEOMETRIES = {'slab': 0.88, 'cylinder': 2.00, 'sphere': 3.32}
+
+# Energetic materials covered by the regenerate-all command
+ENERGETICS = ['HMX', 'RDX', 'PETN', 'TATB', 'CL-20', 'TNT', 'COMP-B', 'COMP-C4', 'PBX-9404']
+
+# Dominant explosive constituent of formulations (Comp B 60/40 RDX/TNT,
+# C-4 91% RDX, PBX-9404 94% HMX); used only for inputs the formulation lacks
+SURROGATES = {'COMP-B': 'RDX', 'COMP-C4': 'RDX', 'PBX-9404': 'HMX'}
+
+INPUT_NAMES = ('Ea', 'lnZ', 'Q', 'k', 'rho', 'cp')
+
+TABLE_COLUMNS = ['material', 'geometry', 'size_m', 'Tc_K', 'Tc_C', 'induction_s',
+                 'kinetics_source', 'thermal_source']
+
+# Default characteristic sizes: 1 mm to 1 m
+DEFAULT_SIZES = np.geomspace(1.0e-3, 1.0, 31)
+
+
+def fk_inputs(material_data: Dict[str, Any]) -> Dict[str, Optional[float]]:
+    """
+    Extract Frank-Kamenetskii inputs from a material dictionary.
+
+    Returns:
+        {'Ea', 'lnZ', 'Q', 'k', 'rho', 'cp'} in SI (missing entries are None)
+    """
+    kinetics = get_arrhenius(material_data) or {}
+    return {
+        'Ea': kinetics.get('Ea'),
+        'lnZ': kinetics.get('lnZ'),
+        'Q': kinetics.get('Q'),
+        'k': get_thermal_conductivity(material_data),
+        'rho': get_density(material_data),
+        'cp': get_isobaric_heat(material_data)
+    }
+
+
+def resolve_inputs(inputs: Dict[str, Dict[str, Optional[float]]],
+                   surrogates: Optional[Dict[str, str]] = None) -> Dict[str, Dict[str, Any]]:
+    """
+    Fill missing inputs from surrogate materials and drop incomplete ones.
+
+    Kinetics (Ea, lnZ, Q) are always taken together from one material.
+
+    Args:
+        inputs: {material: fk_inputs(...)}
+        surrogates: {material: surrogate material} (SURROGATES if None)
+
+    Returns:
+        {material: {'values': {...}, 'sources': {input: material}, 'missing': [...]}}
+    """
+    surrogates = SURROGATES if surrogates is None else surrogates
+    resolved = {}
+
+    for name, values in inputs.items():
+        values = dict(values)
+        sources = {key: name for key in INPUT_NAMES if values.get(key) is not None}
+        donor = inputs.get(surrogates.get(name)) if name in surrogates else None
+
+        if donor:
+            groups = [('Ea', 'lnZ', 'Q'), ('k',), ('rho',), ('cp',)]
+            for group in groups:
+                if any(values.get(key) is None for key in group) and all(donor.get(key) is not None for key in group):
+                    for key in group:
+                        values[key] = donor[key]
+                        sources[key] = surrogates[name]
+
+        resolved[name] = {
+            'values': values,
+            'sources': sources,
+            'missing': [key for key in INPUT_NAMES if values.get(key) is None]
+        }
+
+    return resolved
+
+
+def critical_temperature(Ea, lnZ, Q, k, rho, size, delta_c,
+                         iterations: int = 50, tol: float = 1.0e-12) -> np.ndarray:
+    """
+    Frank-Kamenetskii critical temperature for broadcastable inputs.
+
+    Args:
+        Ea, lnZ, Q, k, rho: Kinetic and thermal inputs (SI, broadcastable)
+        size: Characteristic size a [m]
+        delta_c: Critical FK parameter for the geometry
+
+    Returns:
+        Critical temperature [K] (NaN where no subcritical branch exists)
+    """
+    Ea, lnZ, Q, k, rho, size, delta_c = np.broadcast_arrays(
+        *[np.asarray(v, dtype=float) for v in (Ea, lnZ, Q, k, rho, size, delta_c)]
+    )
+    b = Ea / GAS_CONSTANT
+    with np.errstate(divide='ignore', invalid='ignore'):
+        rhs = 2.0 * np.log(size) + np.log(rho * Q * Ea / (k * GAS_CONSTANT * delta_c)) + lnZ
+
+    # g(u) = b u - 2 ln u - rhs on the branch u > 2/b (T < Ea / 2R)
+    u = np.maximum((rhs - 2.0 * np.log(500.0)) / b, 2.0 / b * 1.5)
+    active = np.isfinite(u)
+    for _ in range(iterations):
+        g = b * u - 2.0 * np.log(u) - rhs
+        step = g / (b - 2.0 / u)
+        u = np.where(active, np.maximum(u - step, 0.5 * (u + 2.0 / b)), u)
+        active &= np.abs(step) > tol * u
+        if not active.any():
+            break
+
+    g = b * u - 2.0 * np.log(u) - rhs
+    solved = np.isfinite(u) & (np.abs(g) < 1.0e-6 * np.maximum(np.abs(rhs), 1.0))
+    return np.where(solved, 1.0 / u, np.nan)
+
+
+def induction_time(Ea, lnZ, Q, cp, T) -> np.ndarray:
+    """Adiabatic induction time [s] at temperature T (broadcastable)."""
+    Ea, lnZ, Q, cp, T = [np.asarray(v, dtype=float) for v in (Ea, lnZ, Q, cp, T)]
+    with np.errstate(over='ignore', invalid='ignore'):
+        return cp * GAS_CONSTANT * T ** 2 / (Q * Ea) * np.exp(Ea / (GAS_CONSTANT * T) - lnZ)
+
+
+def build_tables(resolved: Dict[str, Dict[str, Any]], sizes=None,
+                 geometries: Optional[List[str]] = None) -> Dict[str, np.ndarray]:
+    """
+    Critical temperature tables for every complete material in one batch.
+
+    Args:
+        resolved: Output of resolve_inputs()
+        sizes: Characteristic sizes [m] (DEFAULT_SIZES if None)
+        geometries: Geometry names (all of GEOMETRIES if None)
+
+    Returns:
+        Long-format columns: material, geometry, size_m, Tc_K, Tc_C,
+        induction_s, kinetics_source, thermal_source
+    """
+    sizes = DEFAULT_SIZES if sizes is None else np.atleast_1d(np.asarray(sizes, dtype=float))
+    geometries = list(GEOMETRIES) if geometries is None else geometries
+    names = [name for name, entry in resolved.items() if not entry['missing']]
+
+    if not names:
+        return {key: np.array([]) for key in TABLE_COLUMNS}
+
+    params = {key: np.array([resolved[n]['values'][key] for n in names])[:, None, None]
+              for key in INPUT_NAMES}
+    delta_c = np.array([GEOMETRIES[g] for g in geometries])[None, :, None]
+    size_grid = sizes[None, None, :]
+
+    tc = critical_temperature(params['Ea'], params['lnZ'], params['Q'], params['k'],
+                              params['rho'], size_grid, delta_c)
+    t_ind = induction_time(params['Ea'], params['lnZ'], params['Q'], params['cp'], tc)
+
+    shape = tc.shape
+    material_idx = np.broadcast_to(np.arange(len(names))[:, None, None], shape).ravel()
+    geometry_idx = np.broadcast_to(np.arange(len(geometries))[None, :, None], shape).ravel()
+
+    def source(name, keys):
+        return ','.join(sorted({resolved[name]['sources'][k] for k in keys}))
+
+    return {
+        'material': np.array(names, dtype=object)[material_idx],
+        'geometry': np.array(geometries, dtype=object)[geometry_idx],
+        'size_m': np.broadcast_to(size_grid, shape).ravel(),
+        'Tc_K': tc.ravel(),
+        'Tc_C': tc.ravel() - 273.15,
+        'induction_s': t_ind.ravel(),
+        'kinetics_source': np.array([source(n, ('Ea', 'lnZ', 'Q')) for n in names], dtype=object)[material_idx],
+        'thermal_source': np.array([source(n, ('k', 'rho', 'cp')) for n in names], dtype=object)[material_idx]
+    }
+
+
+def input_hash(entry: Dict[str, Any]) -> str:
+    """Hash of resolved inputs (used to detect data changes)."""
+    values = {key: value for key, value in entry['values'].items() if value is not None}
+    return parameter_hash(values, sources=json.dumps(entry['sources'], sort_keys=True))
+
+
+def collect_inputs(materials: Dict[str, Dict[str, Any]]) -> Dict[str, Dict[str, Optional[float]]]:
+    """
+    Extract inputs of many materials loaded in one batch.
+
+    Args:
+        materials: {material: material dictionary}, e.g. from
+                   MaterialQuerier.get_materials_by_names()
+
+    Returns:
+        {material: fk_inputs(...)} for materials whose data could be read
+    """
+    inputs = {}
+    for name, data in materials.items():
+        try:
+            inputs[name] = fk_inputs(data)
+        except Exception as e:
+            print(f"  ⚠ {name}: {e}")
+    return inputs
+
+
+def table_rows(columns: Dict[str, np.ndarray], material: Optional[str] = None) -> List[tuple]:
+    """Row tuples in TABLE_COLUMNS order (optionally for one material)."""
+    mask = slice(None) if material is None else columns['material'] == material
+    return list(zip(*[columns[name][mask] for name in TABLE_COLUMNS]))
+
+
+def write_table_csv(columns: Dict[str, np.ndarray], file_path: str, material: Optional[str] = None):
+    """Write critical temperature tables as long-format CSV."""
+    with open(file_path, 'w', newline='') as f:
+        writer = csv.writer(f)
+        writer.writerow(TABLE_COLUMNS)
+        writer.writerows(table_rows(columns, material))
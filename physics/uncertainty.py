@@ -0,0 +1,374 @@
+"""
+Monte Carlo Uncertainty Propagation Across Multi-Reference Entries
+
+Most properties carry several entries from different references (HMX has
+ten IsothermalBulkModulus values between 5.3 and 16.5 GPa). Instead of
+picking one, every entry of a parameter is treated as a sample of that
+parameter, samples are drawn in vectorized batches and pushed through
+the model evaluators, and percentile bands are returned.
+
+Priors built from the entries of one parameter:
+    empirical: draw the stored entries with equal weight (default)
+    normal:    normal distribution with the entries' mean and std
+    uniform:   uniform between the smallest and largest entry
+
+Parameters with a single entry are held fixed unless single_entry_cv
+assigns them a relative standard deviation.
+
+Sampling is split into fixed-size chunks whose seeds are spawned from one
+SeedSequence, so results depend only on (seed, chunk_size) and not on the
+number of worker processes.
+
+Models (all vectorized over the sample axis):
+    hugoniot: P(Up) = rho0 (C0 + s Up) Up               [GPa vs km/s]
+    eos:      Murnaghan isotherm P = K0/K0' ((V0/V)^K0' - 1)   [GPa vs V/V0]
+    jc:       Johnson-Cook flow stress vs plastic strain       [MPa]
+
+Author: Materials Database Team
+"""
+
+from concurrent.futures import ProcessPoolExecutor
+from typing import Dict, List, Optional, Any
+import csv
+import time
+
+import numpy as np
+
+from physics.material_params import _eos_row, _thermo, entry_values
+
+
+PRIORS = ('empirical', 'normal', 'uniform')
+
+PERCENTILES = (2.5, 16.0, 50.0, 84.0, 97.5)
+
+DEFAULT_CHUNK_SIZE = 2000
+
+
+# ============================================================================
+# PARAMETER ENTRIES
+# ============================================================================
+
+def _entries(*candidates) -> np.ndarray:
+    """Entries of the first candidate property that has any usable value."""
+    for entries in candidates:
+        values = entry_values(entries)
+        if values:
+            return np.array(values)
+    return np.array([])
+
+
+def _pooled(*candidates) -> np.ndarray:
+    """Entries of every candidate property pooled together."""
+    values = []
+    for entries in candidates:
+        values.extend(entry_values(entries))
+    return np.array(values)
+
+
+def collect_entries(material_data: Dict[str, Any], model: str) -> Dict[str, np.ndarray]:
+    """
+    Collect every stored entry of the parameters a model needs (SI units).
+
+    Args:
+        material_data: Material dictionary (load without overrides so that
+                       reference preferences do not hide entries)
+        model: 'hugoniot', 'eos' or 'jc'
+
+    Returns:
+        {parameter: array of entries} (empty arrays for missing parameters)
+    """
+    thermo = _thermo(material_data)
+    row1 = _eos_row(material_data, 1)
+    row3 = _eos_row(material_data, 3)
+    mechanical = material_data.get('properties', {}).get('Mechanical', {})
+
+    if model == 'hugoniot':
+        s = _entries(row3.get('s'))
+        if not len(s):
+            s = 0.25 * (_entries(row1.get('K0Prime')) + 1.0)
+        return {
+            'rho0': _entries(row3.get('Rho'), thermo.get('Density'), mechanical.get('Density')),
+            'c0': _pooled(row3.get('Cs'), thermo.get('SoundSpeed')),
+            's': s
+        }
+
+    if model == 'eos':
+        k0_prime = _entries(row1.get('K0Prime'))
+        if not len(k0_prime):
+            k0_prime = 4.0 * _entries(row3.get('s')) - 1.0
+        return {
+            'K0': _entries(thermo.get('IsothermalBulkModulus'), row1.get('K0')),
+            'K0_prime': k0_prime
+        }
+
+    if model == 'jc':
+        plastic = material_data.get('models', {}).get('ElastoPlastic') or {}
+        constants = plastic.get('JohnsonCookModelConstants') or {}
+        return {
+            'A': _entries(constants.get('A')),
+            'B': _entries(constants.get('B')),
+            'n': _entries(constants.get('n')),
+            'C': _entries(constants.get('C')),
+            'M': _entries(constants.get('M')),
+            'strain_rate': _entries(constants.get('StrainRate')),
+            'T_ref': _entries(constants.get('ReferenceTemperature')),
+            'T_melt': _pooled(constants.get('MeltingTemperature'), thermo.get('MeltingTemperature'))
+        }
+
+    raise ValueError(f"Unknown model: {model} (expected one of {', '.join(MODELS)})")
+
+
+# Defaults used when a Johnson-Cook entry is absent (same as get_johnson_cook)
+_JC_DEFAULTS = {'B': 0.0, 'n': 1.0, 'C': 0.0, 'M': 1.0, 'strain_rate': 1.0, 'T_ref': 293.0}
+
+
+def _fill_defaults(model: str, entries: Dict[str, np.ndarray]) -> Dict[str, np.ndarray]:
+    """Apply model defaults and raise ValueError for missing required parameters."""
+    entries = dict(entries)
+    if model == 'jc':
+        for name, default in _JC_DEFAULTS.items():
+            if not len(entries[name]):
+                entries[name] = np.array([default])
+
+    missing = [name for name, values in entries.items() if not len(values)]
+    if missing:
+        raise ValueError(f"Missing {model} parameters: {', '.join(missing)}")
+    return entries
+
+
+# ============================================================================
+# SAMPLING
+# ============================================================================
+
+def draw_samples(entries: Dict[str, np.ndarray], n: int, rng: np.random.Generator,
+                 prior: str = 'empirical', single_entry_cv: float = 0.0) -> Dict[str, np.ndarray]:
+    """
+    Draw n samples of every parameter.
+
+    Args:
+        entries: {parameter: stored entries}
+        n: Number of samples
+        rng: NumPy random generator
+        prior: 'empirical', 'normal' or 'uniform'
+        single_entry_cv: Relative std assigned to single-entry parameters
+
+    Returns:
+        {parameter: (n,) samples}
+    """
+    if prior not in PRIORS:
+        raise ValueError(f"Unknown prior: {prior} (expected one of {', '.join(PRIORS)})")
+
+    samples = {}
+    for name, values in entries.items():
+        values = np.asarray(values, dtype=float)
+        if len(values) == 1 or np.ptp(values) == 0.0:
+            if single_entry_cv > 0.0:
+                samples[name] = rng.normal(values[0], abs(values[0]) * single_entry_cv, n)
+            else:
+                samples[name] = np.full(n, values[0])
+        elif prior == 'empirical':
+            samples[name] = rng.choice(values, n)
+        elif prior == 'normal':
+            samples[name] = rng.normal(values.mean(), values.std(ddof=1), n)
+        else:
+            samples[name] = rng.uniform(values.min(), values.max(), n)
+    return samples
+
+
+# ============================================================================
+# MODEL EVALUATORS (samples along axis 0, grid along axis 1)
+# ============================================================================
+
+def evaluate_hugoniot(samples: Dict[str, np.ndarray], up) -> np.ndarray:
+    """Hugoniot pressure [GPa] at particle velocities up [km/s]."""
+    rho0 = samples['rho0'][:, None] * 1.0e-3
+    c0 = samples['c0'][:, None] * 1.0e-3
+    s = samples['s'][:, None]
+    up = np.asarray(up, dtype=float)[None, :]
+    return rho0 * (c0 + s * up) * up
+
+
+def evaluate_eos(samples: Dict[str, np.ndarray], v_ratio) -> np.ndarray:
+    """Murnaghan isotherm pressure [GPa] at V/V0."""
+    k0 = samples['K0'][:, None] * 1.0e-9
+    k0_prime = samples['K0_prime'][:, None]
+    v_ratio = np.asarray(v_ratio, dtype=float)[None, :]
+    return k0 / k0_prime * (v_ratio ** -k0_prime - 1.0)
+
+
+def evaluate_jc(samples: Dict[str, np.ndarray], strain, strain_rate: float = 1.0,
+                temperature: Optional[float] = None) -> np.ndarray:
+    """
+    Johnson-Cook flow stress [MPa] at plastic strains.
+
+    Args:
+        samples: Sampled constants
+        strain: Plastic strain grid
+        strain_rate: Plastic strain rate [1/s]
+        temperature: Temperature [K] (reference temperature if None)
+    """
+    strain = np.asarray(strain, dtype=float)[None, :]
+    a, b, n, c, m = (samples[k][:, None] for k in ('A', 'B', 'n', 'C', 'M'))
+    t_ref = samples['T_ref'][:, None]
+    t_melt = samples['T_melt'][:, None]
+    t = t_ref if temperature is None else temperature
+
+    homologous = np.clip((t - t_ref) / (t_melt - t_ref), 0.0, 1.0)
+    rate = 1.0 + c * np.log(max(strain_rate, 1.0e-12) / samples['strain_rate'][:, None])
+    return (a + b * strain ** n) * rate * (1.0 - homologous ** m) * 1.0e-6
+
+
+MODELS = {
+    'hugoniot': {'evaluate': evaluate_hugoniot, 'x_name': 'up_km_s', 'y_name': 'P_GPa',
+                 'grid': np.linspace(0.0, 3.0, 61)},
+    'eos': {'evaluate': evaluate_eos, 'x_name': 'V_over_V0', 'y_name': 'P_GPa',
+            'grid': np.linspace(1.0, 0.7, 61)},
+    'jc': {'evaluate': evaluate_jc, 'x_name': 'plastic_strain', 'y_name': 'stress_MPa',
+           'grid': np.linspace(0.0, 0.5, 51)},
+}
+
+
+# ============================================================================
+# PROPAGATION
+# ============================================================================
+
+def _run_chunk(model: str, entries: Dict[str, np.ndarray], n: int, seed_sequence,
+               prior: str, single_entry_cv: float, grid: np.ndarray,
+               options: Dict[str, Any]) -> np.ndarray:
+    """Draw and evaluate one chunk (module level so worker processes can pickle it)."""
+    rng = np.random.default_rng(seed_sequence)
+    samples = draw_samples(entries, n, rng, prior, single_entry_cv)
+    return MODELS[model]['evaluate'](samples, grid, **options)
+
+
+def propagate(entries: Dict[str, np.ndarray], model: str, n_samples: int = 10000,
+              seed: int = 0, prior: str = 'empirical', single_entry_cv: float = 0.0,
+              grid=None, percentiles=PERCENTILES, chunk_size: int = DEFAULT_CHUNK_SIZE,
+              workers: int = 1, **options) -> Dict[str, Any]:
+    """
+    Propagate parameter uncertainty through a model.
+
+    Args:
+        entries: collect_entries() output for the model
+        model: 'hugoniot', 'eos' or 'jc'
+        n_samples: Total number of Monte Carlo samples
+        seed: Root seed (results are reproducible for a given seed and chunk_size)
+        prior: 'empirical', 'normal' or 'uniform'
+        single_entry_cv: Relative std assigned to single-entry parameters
+        grid: Model input grid (model default if None)
+        percentiles: Percentiles to report
+        chunk_size: Samples per chunk
+        workers: Worker processes (1 evaluates chunks in this process)
+        **options: Extra evaluator arguments (jc: strain_rate, temperature)
+
+    Returns:
+        Dictionary with:
+        - model, x_name, y_name, x: Grid and axis names
+        - percentiles: {percentile: (n_grid,) array}
+        - mean, std: (n_grid,) arrays
+        - n_samples, seed, prior, entry_counts, elapsed_s
+
+    Raises:
+        ValueError: If a required parameter has no entries
+    """
+    if model not in MODELS:
+        raise ValueError(f"Unknown model: {model} (expected one of {', '.join(MODELS)})")
+
+    entries = _fill_defaults(model, entries)
+    grid = MODELS[model]['grid'] if grid is None else np.asarray(grid, dtype=float)
+
+    sizes = [chunk_size] * (n_samples // chunk_size)
+    if n_samples % chunk_size:
+        sizes.append(n_samples % chunk_size)
+    seeds = np.random.SeedSequence(seed).spawn(len(sizes))
+    args = [(model, entries, n, ss, prior, single_entry_cv, grid, options) for n, ss in zip(sizes, seeds)]
+
+    start = time.perf_counter()
+    if workers > 1 and len(args) > 1:
+        with ProcessPoolExecutor(max_workers=workers) as pool:
+            chunks = list(pool.map(_run_chunk, *zip(*args)))
+    else:
+        chunks = [_run_chunk(*a) for a in args]
+    values = np.concatenate(chunks, axis=0)
+
+    bands = np.nanpercentile(values, percentiles, axis=0)
+
+    return {
+        'model': model,
+        'x_name': MODELS[model]['x_name'],
+        'y_name': MODELS[model]['y_name'],
+        'x': grid,
+        'percentiles': {p: band for p, band in zip(percentiles, bands)},
+        'mean': np.nanmean(values, axis=0),
+        'std': np.nanstd(values, axis=0),
+        'n_samples': n_samples,
+        'seed': seed,
+        'prior': prior,
+        'entry_counts': {name: len(v) for name, v in entries.items()},
+        'elapsed_s': time.perf_counter() - start
+    }
+
+
+def band_columns(result: Dict[str, Any]) -> Dict[str, np.ndarray]:
+    """Long-format columns: grid, mean, std and one column per percentile."""
+    columns = {result['x_name']: result['x'], 'mean': result['mean'], 'std': result['std']}
+    for p, band in result['percentiles'].items():
+        columns[f"p{p:g}"] = band
+    return columns
+
+
+def write_band_csv(result: Dict[str, Any], file_path: str, material: str = ''):
+    """Write percentile bands as CSV (one row per grid point)."""
+    columns = band_columns(result)
+    with open(file_path, 'w', newline='') as f:
+        writer = csv.writer(f)
+        writer.writerow(['material', 'model', 'quantity'] + list(columns))
+        for row in zip(*columns.values()):
+            writer.writerow([material, result['model'], result['y_name']] + [float(v) for v in row])
+
+
+def plot_band(ax, result: Dict[str, Any], color: str = 'C0', label: str = ''):
+    """
+    Draw median, 68% and 95% bands on a matplotlib axis.
+
+    Uses the 2.5/16/50/84/97.5 percentiles when present.
+    """
+    bands = result['percentiles']
+    x = result['x']
+    if 2.5 in bands and 97.5 in bands:
+        ax.fill_between(x, bands[2.5], bands[97.5], color=color, alpha=0.15, linewidth=0)
+    if 16.0 in bands and 84.0 in bands:
+        ax.fill_between(x, bands[16.0], bands[84.0], color=color, alpha=0.3, linewidth=0)
+    if 50.0 in bands:
+        ax.plot(x, bands[50.0], color=color, label=label or None)
+    ax.set_xlabel(result['x_name'])
+    ax.set_ylabel(result['y_name'])
+
+
+# Output formats written as figures by write_band()
+PLOT_EXTENSIONS = ('.png', '.pdf', '.svg')
+
+
+def write_band_plot(result: Dict[str, Any], file_path: str, material: str = ''):
+    """Plot the median, 68% and 95% bands to an image or PDF file."""
+    from matplotlib.figure import Figure
+    from matplotlib.backends.backend_agg import FigureCanvasAgg
+
+    figure = Figure(figsize=(7, 5))
+    FigureCanvasAgg(figure)
+    ax = figure.add_subplot(111)
+    plot_band(ax, result, label=f"{material} median".strip())
+    ax.set_title(f"{material} {result['model']} ({result['n_samples']} samples)".strip())
+    ax.grid(True, alpha=0.3)
+    if material:
+        ax.legend(loc='best')
+    figure.tight_layout()
+    figure.savefig(file_path, dpi=150)
+
+
+def write_band(result: Dict[str, Any], file_path: str, material: str = ''):
+    """Write percentile bands, as a plot for .png/.pdf/.svg paths and as CSV otherwise."""
+    if str(file_path).lower().endswith(PLOT_EXTENSIONS):
+        write_band_plot(result, file_path, material)
+    else:
+        write_band_csv(result, file_path, material)
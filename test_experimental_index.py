@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+"""
+Test Script: Experimental Data Index and Binary Cache
+
+Tests that:
+1. Material lookups match the exact-case prefix, then case-insensitively
+2. New and removed files are picked up after the directory changes
+3. YAML is parsed once; later loads (and new indexes) read the .npz cache
+4. Editing a file invalidates its cached arrays
+5. Both YAML layouts are supported and files without data are skipped
+6. Concurrent lookups and loads are consistent and the memory cache is bounded
+"""
+
+import importlib.util
+import os
+import tempfile
+import time
+from concurrent.futures import ThreadPoolExecutor
+from pathlib import Path
+
+import numpy as np
+
+# Load directly: the data_types package imports PyQt6
+_spec = importlib.util.spec_from_file_location(
+    'experimental_index',
+    Path(__file__).parent / 'Visualization/final_visualization/data_types/experimental_index.py')
+experimental_index = importlib.util.module_from_spec(_spec)
+_spec.loader.exec_module(experimental_index)
+ExperimentalDataIndex = experimental_index.ExperimentalDataIndex
+
+
+POINTS_YAML = """metadata:
+  material_name: Copper
+  source_file: LASL
+points:
+{points}
+"""
+
+
+def write_points(path, pairs):
+    points = "\n".join(f"  - {{Up: {up}, Us: {us}}}" for up, us in pairs)
+    path.write_text(POINTS_YAML.format(points=points))
+
+
+def touch_dir(path):
+    """Force a visible directory mtime change on coarse-timestamp filesystems."""
+    stamp = time.time_ns() + 1_000_000_000
+    os.utime(path, ns=(stamp, stamp))
+
+
+def test_experimental_index():
+    """Test experimental data index."""
+
+    print("\n" + "="*70)
+    print("Experimental Data Index Test")
+    print("="*70 + "\n")
+
+    with tempfile.TemporaryDirectory() as tmp:
+        data = Path(tmp) / "Experimental_data"
+        data.mkdir()
+        write_points(data / "Copper_LASL.yaml", [(0.5, 4.7), (1.0, 5.4)])
+        write_points(data / "Copper_Mitchell.yaml", [(1.5, 6.1)])
+        write_points(data / "copperfoam.yaml", [(0.2, 1.1)])
+        (data / "Aluminum_old.yaml").write_text(
+            "Experimental_data:\n  Up: [1.0, 2.0]\n  Us: [6.7, 8.1]\n  Source: Marsh\n")
+        (data / "Nickel.yaml").write_text("metadata:\n  material_name: Nickel\n")
+        (data / "Copper_notes.txt").write_text("not data")
+
+        index = ExperimentalDataIndex(data)
+
+        # Test 1: Lookup
+        print("Test 1: Prefix lookup, exact case first")
+        print("-" * 70)
+        names = [p.name for p in index.files_for("Copper")]
+        ok = names == ["Copper_LASL.yaml", "Copper_Mitchell.yaml"]
+        ok = ok and [p.name for p in index.files_for("COPPER")] == \
+            ["Copper_LASL.yaml", "Copper_Mitchell.yaml", "copperfoam.yaml"]
+        ok = ok and not index.has_material("Tungsten")
+        print(f"  Copper: {names}")
+        print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+        assert ok
+
+        # Test 2: Directory changes
+        print("Test 2: Index follows added and removed files")
+        print("-" * 70)
+        version = index.version
+        write_points(data / "Tungsten_LASL.yaml", [(0.3, 4.2)])
+        (data / "Copper_Mitchell.yaml").unlink()
+        touch_dir(data)
+        ok = index.version != version and index.has_material("Tungsten")
+        ok = ok and [p.name for p in index.files_for("Copper")] == ["Copper_LASL.yaml"]
+        print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+        assert ok
+
+        # Test 3: Cache
+        print("Test 3: YAML parsed once, then read from .npz")
+        print("-" * 70)
+        first = index.load(data / "Copper_LASL.yaml")
+        index.load(data / "Copper_LASL.yaml")
+        fresh = ExperimentalDataIndex(data)
+        cached = fresh.load(data / "Copper_LASL.yaml")
+        ok = index.parse_count == 1 and fresh.parse_count == 0
+        ok = ok and np.array_equal(cached['Us'], [4.7, 5.4]) and cached['metadata']['source'] == 'LASL'
+        ok = ok and first['Up'].dtype == np.float64 and len(list((data / ".cache").glob("*.npz"))) == 1
+        print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+        assert ok
+
+        # Test 4: Invalidation
+        print("Test 4: Edited file is parsed again")
+        print("-" * 70)
+        write_points(data / "Copper_LASL.yaml", [(0.5, 4.7), (1.0, 5.4), (2.0, 6.9)])
+        edited = fresh.load(data / "Copper_LASL.yaml")
+        ok = fresh.parse_count == 1 and list(edited['Up']) == [0.5, 1.0, 2.0]
+        print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+        assert ok
+
+        # Test 5: Layouts
+        print("Test 5: Legacy layout and files without data")
+        print("-" * 70)
+        legacy = index.load(data / "Aluminum_old.yaml")
+        ok = list(legacy['Us']) == [6.7, 8.1] and legacy['metadata']['source'] == 'Marsh'
+        ok = ok and index.load(data / "Nickel.yaml") is None
+        parses = fresh.parse_count
+        ok = ok and fresh.load(data / "Nickel.yaml") is None and fresh.parse_count == parses
+        print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+        assert ok
+
+        # Test 6: Threads and memory bound
+        print("Test 6: Concurrent use, bounded memory cache")
+        print("-" * 70)
+        for i in range(40):
+            write_points(data / f"Alloy{i:02d}.yaml", [(0.5 + i, 4.0 + i)])
+        touch_dir(data)
+        shared = ExperimentalDataIndex(data, Path(tmp) / "threads_cache")
+        shared.MEMORY_LIMIT = 16
+
+        def lookup(i):
+            files = shared.files_for(f"Alloy{i % 40:02d}")
+            return len(files) == 1 and shared.load(files[0])['Up'][0] == 0.5 + i % 40
+
+        with ThreadPoolExecutor(max_workers=8) as pool:
+            results = list(pool.map(lookup, range(400)))
+        ok = all(results) and len(shared._memory) <= 16
+        print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+        assert ok
+
+
+if __name__ == "__main__":
+    test_experimental_index()
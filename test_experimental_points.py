@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+"""
+Test Script: Single-Query Experimental Points
+
+Tests that:
+1. Aggregated dataset rows decode into contiguous columns with offsets
+2. Dataset slices are views and missing values are NaN
+3. pair() keeps x/y aligned when either value is missing
+4. get_experimental_arrays() issues one query for any number of materials
+5. get_experimental_data_with_points() keeps its grouped layout
+"""
+
+import numpy as np
+
+from Visualization.experimental_points import ExperimentalPoints
+from Visualization.visualization_service import VisualizationDataService
+
+
+def make_dataset(dataset_id, material, exp_type, up, us, p=None):
+    n = len(up)
+    return {'dataset_id': dataset_id, 'material_name': material, 'experiment_type': exp_type,
+            'source_file': 'lasl.yaml', 'yaml_filename': 'lasl.yaml', 'description': None,
+            'notes': None, 'created_at': None, 'point_count': n,
+            'rho0': [8.93] * n if n else None, 'us': us or None, 'up': up or None,
+            'p': p or ([None] * n if n else None), 'v': None, 'rho': None,
+            'v_over_v0': [1.0 - u / s if u is not None and s else None for u, s in zip(up, us)] or None,
+            'experiment_label': [f'Shot {i}' for i in range(n)] or None}
+
+
+class FakeService(VisualizationDataService):
+    """Service with _execute_query() answered from aggregated rows."""
+
+    def __init__(self, rows):
+        self._connection = None
+        self.rows = rows
+        self.queries = []
+
+    def _execute_query(self, query, params=None):
+        self.queries.append((query, params))
+        patterns = params[0] if params else ['%%']
+        return [row for row in self.rows
+                if any(pat.strip('%') in row['material_name'].lower() for pat in patterns)]
+
+
+ROWS = [
+    make_dataset(1, 'Copper', 'Shock Hugoniot', [0.5, 1.0, 1.5], [4.7, 5.4, 6.1], [21.0, 48.0, 82.0]),
+    make_dataset(2, 'Copper', 'Shock Hugoniot', [2.0, None], [6.8, 7.5]),
+    make_dataset(3, 'Copper', 'Sound Speed', [], []),
+    make_dataset(4, 'Aluminum', 'Shock Hugoniot', [1.0], [6.7]),
+]
+
+
+def test_experimental_points():
+    """Test columnar experimental points."""
+
+    print("\n" + "="*70)
+    print("Single-Query Experimental Points Test")
+    print("="*70 + "\n")
+
+    points = ExperimentalPoints.from_aggregated_rows(ROWS)
+
+    # Test 1: Offsets
+    print("Test 1: Contiguous columns with dataset offsets")
+    print("-" * 70)
+    ok = list(points.offsets) == [0, 3, 5, 5, 6] and len(points) == 6 and points.n_datasets == 4
+    ok = ok and points['us'].dtype == np.float64 and points['us'].flags['C_CONTIGUOUS']
+    ok = ok and list(points.dataset_index) == [0, 0, 0, 1, 1, 3]
+    ok = ok and 'us' not in points.datasets[0] and points.datasets[0]['point_count'] == 3
+    print(f"  Offsets: {list(points.offsets)}")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 2: Views and NaN
+    print("Test 2: Dataset slices are views, missing values are NaN")
+    print("-" * 70)
+    second = points.dataset(1)
+    ok = np.shares_memory(second['us'], points['us']) and list(second['us']) == [6.8, 7.5]
+    ok = ok and np.isnan(second['up'][1]) and np.all(np.isnan(second['p']))
+    ok = ok and list(second['experiment_label']) == ['Shot 0', 'Shot 1'] and second['info']['dataset_id'] == 2
+    ok = ok and len(points.dataset(2)['us']) == 0
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 3: Paired filtering
+    print("Test 3: pair() keeps x/y aligned")
+    print("-" * 70)
+    up, us = points.pair('up', 'us')
+    p, up_p = points.pair('p', 'up')
+    ok = list(up) == [0.5, 1.0, 1.5, 2.0, 1.0] and list(us) == [4.7, 5.4, 6.1, 6.8, 6.7]
+    ok = ok and list(p) == [21.0, 48.0, 82.0] and list(up_p) == [0.5, 1.0, 1.5]
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 4: One query
+    print("Test 4: One query for several materials")
+    print("-" * 70)
+    service = FakeService(ROWS)
+    both = service.get_experimental_arrays(['Copper', 'aluminum'], 'Shock Hugoniot')
+    query, params = service.queries[-1]
+    ok = len(service.queries) == 1 and both.n_datasets == 4
+    ok = ok and params == (['%copper%', '%aluminum%'], 'Shock Hugoniot') and 'LIKE ANY' in query
+    ok = ok and 'array_agg(p.us::float8 ORDER BY p.point_order)' in query
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 5: Grouped layout
+    print("Test 5: get_experimental_data_with_points() grouped layout")
+    print("-" * 70)
+    service = FakeService(ROWS)
+    grouped = service.get_experimental_data_with_points('Copper')
+    hugoniot = grouped['Shock Hugoniot']
+    ok = len(service.queries) == 1 and sorted(grouped) == ['Shock Hugoniot', 'Sound Speed']
+    ok = ok and [d['dataset_info']['dataset_id'] for d in hugoniot] == [1, 2]
+    ok = ok and hugoniot[0]['points'][1]['us'] == 5.4 and hugoniot[1]['points'][1]['up'] is None
+    ok = ok and grouped['Sound Speed'][0]['points'] == []
+    records = ExperimentalPoints.from_records(hugoniot[0]['points'] + hugoniot[1]['points'])
+    ok = ok and list(records.offsets) == [0, 3, 5] and np.array_equal(records['up'], points['up'][:5], equal_nan=True)
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+
+if __name__ == "__main__":
+    test_experimental_points()
@@ -0,0 +1,183 @@
+#!/usr/bin/env python3
+"""
+Test Script: 1-D Lagrangian Hydrocode
+
+Tests that:
+1. Sod shock tube matches the exact Riemann solution
+2. Symmetric Mie-Grüneisen plate impact reaches the analytic Hugoniot state
+3. Total energy is conserved
+4. Database closures build from the HMX XML file (MG, JC, JWL, Arrhenius);
+   with required=False, burn is skipped for an inert material
+5. Time histories round-trip through the compressed columnar file
+6. Throughput benchmark (cell-updates per second)
+"""
+
+import os
+import tempfile
+
+import numpy as np
+
+from parser.xml_parser import parse_material_xml
+from physics.hydrocode import (
+    HydroMaterial, HydroHistory, Layer, LagrangianHydro, MieGruneisenEOS, benchmark
+)
+from physics.impedance import solve_interface
+
+
+def exact_riemann(left, right, gamma, x, t, x0=0.5):
+    """Exact ideal-gas Riemann solution (density, velocity, pressure) at x, t."""
+    rho_l, u_l, p_l = left
+    rho_r, u_r, p_r = right
+    c_l = np.sqrt(gamma * p_l / rho_l)
+    c_r = np.sqrt(gamma * p_r / rho_r)
+
+    def wave(p, rho_k, p_k, c_k):
+        if p > p_k:
+            a = 2.0 / ((gamma + 1.0) * rho_k)
+            b = (gamma - 1.0) / (gamma + 1.0) * p_k
+            return (p - p_k) * np.sqrt(a / (p + b))
+        return 2.0 * c_k / (gamma - 1.0) * ((p / p_k) ** ((gamma - 1.0) / (2.0 * gamma)) - 1.0)
+
+    # Bisection on the star pressure
+    lo, hi = 1.0e-8, 10.0 * max(p_l, p_r)
+    for _ in range(200):
+        mid = 0.5 * (lo + hi)
+        if wave(mid, rho_l, p_l, c_l) + wave(mid, rho_r, p_r, c_r) + u_r - u_l > 0.0:
+            hi = mid
+        else:
+            lo = mid
+    p_star = 0.5 * (lo + hi)
+    u_star = 0.5 * (u_l + u_r) + 0.5 * (wave(p_star, rho_r, p_r, c_r) - wave(p_star, rho_l, p_l, c_l))
+
+    # Left rarefaction, right shock (Sod configuration)
+    rho_star_l = rho_l * (p_star / p_l) ** (1.0 / gamma)
+    c_star_l = c_l * (p_star / p_l) ** ((gamma - 1.0) / (2.0 * gamma))
+    g = (gamma - 1.0) / (gamma + 1.0)
+    rho_star_r = rho_r * (p_star / p_r + g) / (g * p_star / p_r + 1.0)
+    shock_speed = u_r + c_r * np.sqrt((gamma + 1.0) / (2.0 * gamma) * p_star / p_r
+                                      + (gamma - 1.0) / (2.0 * gamma))
+
+    xi = (x - x0) / t
+    rho = np.empty_like(x)
+    head, tail = u_l - c_l, u_star - c_star_l
+    fan = (xi >= head) & (xi < tail)
+    rho[xi < head] = rho_l
+    rho[fan] = rho_l * (2.0 / (gamma + 1.0) + (gamma - 1.0) / ((gamma + 1.0) * c_l)
+                        * (u_l - xi[fan])) ** (2.0 / (gamma - 1.0))
+    rho[(xi >= tail) & (xi < u_star)] = rho_star_l
+    rho[(xi >= u_star) & (xi < shock_speed)] = rho_star_r
+    rho[xi >= shock_speed] = rho_r
+    return rho, p_star, u_star
+
+
+def test_hydrocode():
+    """Test Lagrangian hydrocode against analytic solutions."""
+
+    print("\n" + "="*70)
+    print("Lagrangian Hydrocode Test")
+    print("="*70 + "\n")
+
+    # Test 1: Sod shock tube
+    print("Test 1: Sod shock tube vs exact Riemann solution")
+    print("-" * 70)
+    gamma = 1.4
+    gas_l = HydroMaterial.ideal_gas('left', 1.0, gamma)
+    gas_r = HydroMaterial.ideal_gas('right', 0.125, gamma)
+    n = 400
+    sim = LagrangianHydro([
+        Layer(gas_l, 0.5, n // 2, energy=1.0 / ((gamma - 1.0) * 1.0)),
+        Layer(gas_r, 0.5, n // 2, energy=0.1 / ((gamma - 1.0) * 0.125))
+    ], left_boundary='wall', right_boundary='wall')
+    sim.run(0.2)
+    x = sim.cell_centers()
+    rho_exact, p_star, u_star = exact_riemann((1.0, 0.0, 1.0), (0.125, 0.0, 0.1), gamma, x, 0.2)
+    l1 = float(np.mean(np.abs(sim.rho - rho_exact)))
+    contact = n // 2
+    plateau = sim.p[contact - 5:contact + 5]
+    ok = l1 < 0.01 and np.allclose(plateau, p_star, rtol=0.02)
+    print(f"  L1 density error: {l1:.5f}, p* exact {p_star:.5f}, "
+          f"code {float(np.mean(plateau)):.5f}")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 2: Symmetric plate impact
+    print("Test 2: Copper symmetric impact vs analytic Hugoniot state")
+    print("-" * 70)
+    copper = HydroMaterial('Copper', 8930.0, MieGruneisenEOS(8930.0, 3940.0, 1.49, 2.0))
+    velocity = 1000.0
+    sim = LagrangianHydro([
+        Layer(copper, 2.0e-3, 200, velocity=velocity),
+        Layer(copper, 6.0e-3, 600)
+    ])
+    e_start = sim.total_energy()
+    t_end = 0.6e-6
+    history = sim.run(t_end, stations=[3.0e-3], history_every=5)
+    state = solve_interface(8.93, 3.94, 1.49, 8.93, 3.94, 1.49, velocity / 1000.0)
+    p_exact = float(state['P']) * 1.0e9
+    p_gauge = float(history['pressure'][-1, 0])
+    shock_front = sim.x_initial[1:][sim.p > 0.5 * p_exact].max()
+    front_exact = 2.0e-3 + float(state['us_target']) * 1000.0 * t_end
+    ok = abs(p_gauge / p_exact - 1.0) < 0.01 and abs(shock_front - front_exact) < 0.05e-3
+    print(f"  P exact {p_exact/1e9:.3f} GPa, gauge {p_gauge/1e9:.3f} GPa")
+    print(f"  Shock front exact {front_exact*1e3:.3f} mm, code {shock_front*1e3:.3f} mm")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 3: Energy conservation
+    print("Test 3: Total energy conservation")
+    print("-" * 70)
+    drift = abs(sim.total_energy() / e_start - 1.0)
+    ok = drift < 5.0e-3
+    print(f"  Relative drift: {drift:.2e}")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 4: Closures from XML data
+    print("Test 4: HMX closures from XML (JC strength + Arrhenius burn)")
+    print("-" * 70)
+    hmx_data = parse_material_xml(os.path.join(os.path.dirname(__file__), 'xml', 'HMX.xml'))
+    hmx = HydroMaterial.from_data('HMX', hmx_data, strength=True, burn=True)
+    sim = LagrangianHydro([
+        Layer(copper, 1.0e-3, 50, velocity=1500.0),
+        Layer(hmx, 2.0e-3, 200)
+    ])
+    sim.run(0.3e-6)
+    ok = (np.isfinite(sim.p).all() and bool(np.all((sim.lam >= 0.0) & (sim.lam <= 1.0)))
+          and hmx.products is not None and hmx.strength['G'] > 0.0)
+    copper_data = parse_material_xml(os.path.join(os.path.dirname(__file__), 'xml', 'Copper.xml'))
+    inert = HydroMaterial.from_data('Copper', copper_data, {'s': 1.49}, burn=True, required=False)
+    ok = ok and inert.burn is None and inert.products is None
+    try:
+        HydroMaterial.from_data('Copper', copper_data, {'s': 1.49}, burn=True)
+        ok = False
+    except ValueError:
+        pass
+    print(f"  {hmx}")
+    print(f"  Peak pressure {sim.p.max()/1e9:.2f} GPa, max reaction {sim.lam.max():.3f}")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 5: History round-trip
+    print("Test 5: Compressed columnar history round-trip")
+    print("-" * 70)
+    with tempfile.TemporaryDirectory() as tmp:
+        path = os.path.join(tmp, 'history.npz')
+        history.save(path)
+        loaded = HydroHistory.load(path)
+    ok = (np.array_equal(loaded['pressure'], history['pressure'])
+          and loaded.metadata['steps'] == history.metadata['steps'])
+    print(f"  {len(loaded['t'])} samples x {loaded['pressure'].shape[1]} station(s)")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 6: Benchmark
+    print("Test 6: Throughput benchmark")
+    print("-" * 70)
+    stats = benchmark(n_cells=20000, n_steps=100)
+    print(f"  {stats['n_cells']} cells x {stats['steps']} steps in {stats['elapsed_s']:.3f} s")
+    print(f"  {stats['cell_updates_per_s']/1e6:.2f} M cell-updates/s")
+    print(f"  Result: PASS ✓\n")
+
+
+if __name__ == "__main__":
+    test_hydrocode()
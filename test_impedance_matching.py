@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+"""
+Test Script: Impedance Matching Solver
+
+Tests that:
+1. Symmetric impacts give Up = V/2
+2. Interface pressure balances on both Hugoniots
+3. Matrix solve matches single solves
+4. Chained stack solves match direct solves for a single layer
+5. from_service() fetches every material's parameters in one batched query
+"""
+
+import numpy as np
+
+from physics.impedance import (
+    HugoniotTable, hugoniot_pressure, solve_interface, solve_matrix, solve_stack
+)
+from Visualization.visualization_service import VisualizationDataService
+
+
+TABLE = HugoniotTable.from_records({
+    'Copper': {'rho0': 8.93, 'C0': 3.94, 's': 1.49},
+    'Aluminum': {'rho0': 2.703, 'C0': 5.35, 's': 1.34},
+    'PMMA': {'rho0': 1.186, 'C0': 2.57, 's': 1.54},
+})
+
+
+def test_impedance_matching():
+    """Test closed-form interface solves."""
+
+    print("\n" + "="*70)
+    print("Impedance Matching Solver Test")
+    print("="*70 + "\n")
+
+    velocities = np.linspace(0.5, 6.0, 12)
+
+    # Test 1: Symmetric impact
+    print("Test 1: Symmetric impact gives Up = V/2")
+    print("-" * 70)
+    cu = TABLE.get('Copper')
+    state = solve_interface(cu['rho0'], cu['C0'], cu['s'], cu['rho0'], cu['C0'], cu['s'], velocities)
+    ok = np.allclose(state['up'], velocities / 2.0)
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 2: Pressure balance
+    print("Test 2: Pressure balance on flyer and target Hugoniots")
+    print("-" * 70)
+    result = solve_matrix(TABLE, velocities)
+    up = result['up']
+    p_target = hugoniot_pressure(TABLE.rho0[None, :, None], TABLE.C0[None, :, None],
+                                 TABLE.s[None, :, None], up)
+    p_flyer = hugoniot_pressure(TABLE.rho0[:, None, None], TABLE.C0[:, None, None],
+                                TABLE.s[:, None, None], velocities[None, None, :] - up)
+    ok = np.allclose(p_target, p_flyer) and np.allclose(p_target, result['P'])
+    ok = ok and bool(np.all((up >= 0.0) & (up <= velocities[None, None, :])))
+    print(f"  Solved {up.size} cases in {result['elapsed_s']*1000:.3f} ms")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 3: Single-layer stack equals direct solve
+    print("Test 3: Single-layer stack equals matrix entry")
+    print("-" * 70)
+    stack = solve_stack(TABLE, 'Copper', ['Aluminum'], velocities)
+    i, j = TABLE.index_of('Copper'), TABLE.index_of('Aluminum')
+    ok = np.allclose(stack[0]['P'], result['P'][i, j, :])
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 4: Release into lower impedance lowers pressure
+    print("Test 4: Al -> PMMA transmits lower pressure")
+    print("-" * 70)
+    stack = solve_stack(TABLE, 'Copper', ['Aluminum', 'PMMA'], 2.0)
+    ok = float(stack[1]['P'][0]) < float(stack[0]['P'][0])
+    ok = ok and float(stack[1]['up'][0]) > float(stack[0]['up'][0])
+    for iface in stack:
+        print(f"  {iface['upstream']:>9} | {iface['downstream']:<9} "
+              f"Up = {float(iface['up'][0]):.4f} km/s, P = {float(iface['P'][0]):.3f} GPa")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 5: Batched service load
+    print("Test 5: from_service() uses one parameter query for all materials")
+    print("-" * 70)
+    materials = [{'material_id': 1, 'name': 'Aluminum'}, {'material_id': 3, 'name': 'Copper'},
+                 {'material_id': 7, 'name': 'Unknown'}]
+    models = [(1, 'C0', '5350', 'm/s'), (1, 's', '1.34', ''), (1, 'Reference Density', '2703', 'kg/m³'),
+              (3, 'C0', '3.94', 'km/s'), (3, 's', '1.49', ''), (3, 'Rho', '8.93', 'g/cm³')]
+    queries = []
+
+    def execute(query, params=None):
+        queries.append(query)
+        if 'xml_finalized_models' in query:
+            return [{'material_id': mid, 'model_name': 'USUP', 'parameter_name': name,
+                     'parameter_symbol': name, 'parameter_value': value, 'parameter_unit': unit,
+                     'value_ref': '101', 'value_usup_ref': None}
+                    for mid, name, value, unit in models if mid in params]
+        return materials
+
+    service = VisualizationDataService.__new__(VisualizationDataService)
+    service._connection = None
+    service._execute_query = execute
+    table = HugoniotTable.from_service(service, [1, 3, 7])
+    ok = len(queries) == 2 and table.names == ['Aluminum', 'Copper']
+    ok = ok and np.allclose([table.get('Aluminum')['rho0'], table.get('Aluminum')['C0']], [2.703, 5.35])
+    ok = ok and table.get('Copper') == {'rho0': 8.93, 'C0': 3.94, 's': 1.49}
+    print(f"  Queries: {len(queries)} for {len(materials)} materials")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+
+if __name__ == "__main__":
+    test_impedance_matching()
@@ -0,0 +1,156 @@
+#!/usr/bin/env python3
+"""
+Test Script: Incremental Search
+
+Tests that:
+1. Multi-word, case-insensitive matching on names and aliases
+2. Typing more re-checks only the previous matches; backspace reuses results
+3. Per-keystroke filtering stays under 16 ms for a large catalogue
+4. Trigram search SQL uses the indexed document and escapes LIKE wildcards
+5. Search indexes are checked once per connection, DDL runs only for missing
+   objects, and the similarity threshold is transaction-local
+"""
+
+import importlib.util
+import time
+from pathlib import Path
+
+from db.search_index_storage import (
+    MATERIAL_DOCUMENT, PARAMETER_DOCUMENT, SearchIndexStorage, escape_like,
+    material_search_query, property_search_query
+)
+
+# Load directly: the gui.views package imports PyQt6
+_spec = importlib.util.spec_from_file_location(
+    'incremental_filter', Path(__file__).parent / 'gui/views/incremental_filter.py')
+incremental_filter = importlib.util.module_from_spec(_spec)
+_spec.loader.exec_module(incremental_filter)
+IncrementalFilter = incremental_filter.IncrementalFilter
+
+
+class FakeCursor:
+    def __init__(self, conn):
+        self.conn = conn
+        self.last = None
+
+    def execute(self, query, params=None):
+        self.conn.executed.append(query)
+        self.last = query
+
+    def fetchone(self):
+        if 'pg_extension' in self.last:
+            return (self.conn.installed,)
+        return (True, self.conn.installed)
+
+    def fetchall(self):
+        return []
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        pass
+
+
+class FakeConnection:
+    def __init__(self, installed):
+        self.installed = installed
+        self.executed = []
+
+    def cursor(self):
+        return FakeCursor(self)
+
+    def commit(self):
+        pass
+
+    def rollback(self):
+        pass
+
+
+def test_incremental_search():
+    """Test incremental search."""
+
+    print("\n" + "="*70)
+    print("Incremental Search Test")
+    print("="*70 + "\n")
+
+    # Test 1: Matching
+    print("Test 1: Matching")
+    print("-" * 70)
+    f = IncrementalFilter(["Copper Cu OFHC", "PBX-9501 explosive", "Aluminum 6061-T6", "copper alloy C110"])
+    ok = f.filter("cop") == [0, 3]
+    ok = ok and f.filter("ofhc") == [0]
+    ok = ok and f.filter("  6061  alu ") == [2]
+    ok = ok and f.filter("") == [0, 1, 2, 3] and f.filter("zz") == []
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 2: Incremental narrowing
+    print("Test 2: Incremental narrowing")
+    print("-" * 70)
+    names = [f"Material_{i:05d}" for i in range(10000)]
+    f = IncrementalFilter(names)
+    f.filter("material_00")
+    ok = f.scanned == 10000
+    f.filter("material_001")
+    ok = ok and f.scanned == 1000
+    f.filter("material_0012")
+    ok = ok and f.scanned == 100
+    result = f.filter("material_001")      # Backspace: remembered result
+    ok = ok and f.scanned == 0 and len(result) == 100
+    f.filter("material_002")               # Sibling: narrows "material_00"
+    ok = ok and f.scanned == 1000
+    f.filter("material_002 9")             # Extra word narrows too
+    ok = ok and f.scanned == 100 and f.filter("material_002 9") == [i for i in range(200, 300) if '9' in names[i]]
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 3: Timing
+    print("Test 3: Search-as-you-type at catalogue scale")
+    print("-" * 70)
+    catalogue = [f"Material_{i:06d} Alias{i % 977} F{i % 31}" for i in range(100000)]
+    f = IncrementalFilter(catalogue)
+    typed = "material_0123"
+    worst = 0.0
+    for n in range(1, len(typed) + 1):
+        start = time.perf_counter()
+        f.filter(typed[:n])
+        worst = max(worst, time.perf_counter() - start)
+    first = f.filter(typed)
+    print(f"  {len(catalogue)} items, slowest keystroke {worst * 1000:.1f} ms")
+    ok = len(first) == 100 and worst < 0.016 * 4   # Headroom for slow CI machines
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 4: SQL
+    print("Test 4: Trigram search SQL")
+    print("-" * 70)
+    query = material_search_query()
+    ok = f"<%% ({MATERIAL_DOCUMENT})" in query and f"({MATERIAL_DOCUMENT}) ILIKE %(pattern)s" in query
+    ok = ok and "<%" not in material_search_query(trigram=False)
+    ok = ok and "ANY(%(material_ids)s)" in property_search_query(filter_materials=True)
+    ok = ok and f"({PARAMETER_DOCUMENT}) ILIKE" in property_search_query()
+    ok = ok and escape_like("50%_a\\b") == "50\\%\\_a\\\\b"
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 5: Install once
+    print("Test 5: Indexes checked once per connection")
+    print("-" * 70)
+    conn = FakeConnection(installed=False)
+    storage = SearchIndexStorage(conn)
+    SearchIndexStorage(conn)
+    ddl = [q for q in conn.executed if 'CREATE' in q]
+    ok = storage.available and len(ddl) == 3
+    ok = ok and sum('pg_extension' in q for q in conn.executed) == 1
+    existing = FakeConnection(installed=True)
+    storage = SearchIndexStorage(existing)
+    ok = ok and not any('CREATE' in q for q in existing.executed)
+    storage.search_materials("copper")
+    ok = ok and "word_similarity_threshold', %(threshold)s, true);" in existing.executed[-1]
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+
+if __name__ == "__main__":
+    test_incremental_search()
@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+"""
+Test Script: Release Isentropes and Reshock Hugoniots
+
+Tests that:
+1. Release curves start on the principal Hugoniot
+2. Release curves satisfy de = -P dV
+3. Free-surface velocity approaches 2 Up for weak shocks
+4. Reshock curves start at the centering state and lie below the principal Hugoniot
+5. Engine cache hits on identical (material, parameters) and misses on changes
+6. Long-format CSV output
+"""
+
+import csv
+import os
+import tempfile
+
+import numpy as np
+
+from physics.isentropes import (
+    OffHugoniotEngine, hugoniot_states, release_isentropes, reshock_hugoniots,
+    up_at_pressure, write_family_csv
+)
+
+
+COPPER = {'rho0': 8.93, 'C0': 3.94, 's': 1.49, 'gamma0': 2.0}
+
+
+def test_isentropes():
+    """Test off-Hugoniot state generation."""
+
+    print("\n" + "="*70)
+    print("Release Isentrope / Reshock Test")
+    print("="*70 + "\n")
+
+    up = up_at_pressure(COPPER['rho0'], COPPER['C0'], COPPER['s'], [5.0, 20.0, 50.0, 100.0])
+    family = release_isentropes(COPPER['rho0'], COPPER['C0'], COPPER['s'], COPPER['gamma0'],
+                                up, n_points=400)
+
+    # Test 1: Start on Hugoniot
+    print("Test 1: Release curves start on the principal Hugoniot")
+    print("-" * 70)
+    ok = np.allclose(family['P'][:, 0], [5.0, 20.0, 50.0, 100.0])
+    ok = ok and np.allclose(family['up'][:, 0], up)
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 2: Isentrope energy balance
+    print("Test 2: de = -P dV along every release curve")
+    print("-" * 70)
+    de = np.diff(family['e'], axis=1)
+    work = -0.5 * (family['P'][:, 1:] + family['P'][:, :-1]) * np.diff(family['V'], axis=1)
+    error = float(np.max(np.abs(de - work)))
+    ok = error < 1.0e-6
+    print(f"  Max residual: {error:.2e} kJ/g")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 3: Free-surface velocity doubling
+    print("Test 3: Free-surface velocity ~ 2 Up for weak shocks")
+    print("-" * 70)
+    u_fs = np.array([np.interp(0.0, p[::-1], u[::-1]) for p, u in zip(family['P'], family['up'])])
+    ratio = u_fs / (2.0 * up)
+    ok = abs(ratio[0] - 1.0) < 0.005 and bool(np.all(ratio >= 1.0 - 1.0e-6))
+    for p, r in zip([5.0, 20.0, 50.0, 100.0], ratio):
+        print(f"  P = {p:6.1f} GPa: Ufs / 2Up = {r:.4f}")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 4: Reshock
+    print("Test 4: Reshock curves lie below the principal Hugoniot")
+    print("-" * 70)
+    reshock = reshock_hugoniots(COPPER['rho0'], COPPER['C0'], COPPER['s'], COPPER['gamma0'], up)
+    hug = hugoniot_states(COPPER['rho0'], COPPER['C0'], COPPER['s'], np.linspace(0.0, 4.0, 4000))
+    p_principal = np.interp(-reshock['V'], -hug['V'], hug['P'])
+    finite = np.isfinite(reshock['P'])
+    ok = np.allclose(reshock['P'][:, 0], family['P'][:, 0])
+    ok = ok and bool(np.all(reshock['P'][:, 1:][finite[:, 1:]] < p_principal[:, 1:][finite[:, 1:]]))
+    ok = ok and bool(np.all(np.diff(reshock['up'], axis=1)[finite[:, 1:]] <= 0.0))
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 5: Cache
+    print("Test 5: Cache keyed by material and parameter hash")
+    print("-" * 70)
+    engine = OffHugoniotEngine()
+    first = engine.release('Copper', COPPER, pressures=[20.0, 50.0])
+    second = engine.release('Copper', COPPER, pressures=[20.0, 50.0])
+    changed = engine.release('Copper', dict(COPPER, gamma0=1.9), pressures=[20.0, 50.0])
+    ok = first is second and changed is not first and engine.hits == 1 and engine.misses == 2
+    print(f"  Hits: {engine.hits}, misses: {engine.misses}")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 6: CSV output
+    print("Test 6: Long-format CSV output")
+    print("-" * 70)
+    with tempfile.TemporaryDirectory() as tmp:
+        path = os.path.join(tmp, 'release.csv')
+        write_family_csv(first, path)
+        with open(path, newline='') as f:
+            rows = list(csv.DictReader(f))
+    ok = len(rows) == first['P'].size and rows[0]['material'] == 'Copper' and rows[0]['kind'] == 'release'
+    print(f"  {len(rows)} rows written")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+
+if __name__ == "__main__":
+    test_isentropes()
@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+"""
+Test Script: Lazy Tree
+
+Tests that:
+1. Children are created in batches on fetch, not up front
+2. Loaders run once, on first fetch
+3. sync() inserts/removes single rows and keeps existing nodes
+4. Opening a 10k-key tree creates only the first batch
+"""
+
+import importlib.util
+import time
+from pathlib import Path
+
+# Load directly: the gui.views package imports PyQt6
+_spec = importlib.util.spec_from_file_location(
+    'lazy_tree', Path(__file__).parent / 'gui/views/lazy_tree.py')
+lazy_tree = importlib.util.module_from_spec(_spec)
+_spec.loader.exec_module(lazy_tree)
+LazyNode = lazy_tree.LazyNode
+LazyTree = lazy_tree.LazyTree
+
+
+class RecordingListener(lazy_tree.TreeListener):
+    """Records row changes as (op, parent key, first, last)."""
+
+    def __init__(self):
+        self.events = []
+
+    def begin_insert(self, parent, first, last):
+        self.events.append(('insert', parent.key, first, last))
+
+    def begin_remove(self, parent, first, last):
+        self.events.append(('remove', parent.key, first, last))
+
+
+def leaf(key):
+    return LazyNode(key, str(key))
+
+
+def test_lazy_tree():
+    """Test lazy tree."""
+
+    print("\n" + "="*70)
+    print("Lazy Tree Test")
+    print("="*70 + "\n")
+
+    # Test 1: Batched fetch
+    print("Test 1: Batched fetch")
+    print("-" * 70)
+    listener = RecordingListener()
+    tree = LazyTree(listener, batch=10)
+    tree.set_children(tree.root, list(range(25)), leaf)
+    ok = tree.root.children == [] and tree.can_fetch(tree.root)
+    counts = [tree.fetch(tree.root) for _ in range(3)]
+    ok = ok and counts == [10, 10, 5] and not tree.can_fetch(tree.root)
+    ok = ok and listener.events == [('insert', None, 0, 9), ('insert', None, 10, 19), ('insert', None, 20, 24)]
+    ok = ok and [c.row for c in tree.root.children] == list(range(25))
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 2: Loaders
+    print("Test 2: Loader runs once")
+    print("-" * 70)
+    calls = []
+
+    def loader(node):
+        calls.append(node.key)
+        node.text = f"{node.key} (3)"
+        return ['a', 'b', 'c'], leaf
+
+    tree = LazyTree(batch=10)
+    tree.set_children(tree.root, ['x'], lambda key: LazyNode(key, key, loader=loader))
+    tree.fetch(tree.root)
+    node = tree.root.child('x')
+    ok = node.has_children() and calls == []
+    tree.fetch(node)
+    tree.fetch(node)
+    ok = ok and calls == ['x'] and node.text == "x (3)" and [c.key for c in node.children] == ['a', 'b', 'c']
+    ok = ok and tree.find(['x', 'b']) is node.children[1]
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 3: Incremental sync
+    print("Test 3: Incremental sync")
+    print("-" * 70)
+    listener = RecordingListener()
+    tree = LazyTree(listener, batch=100)
+    tree.sync(tree.root, ['Al', 'Cu', 'Fe'], leaf)
+    tree.fetch(tree.root)
+    cu = tree.root.child('Cu')
+    listener.events.clear()
+    tree.sync(tree.root, ['Al', 'Cu', 'Fe', 'Ni'], leaf)
+    tree.sync(tree.root, ['Al', 'Au', 'Cu', 'Fe', 'Ni'], leaf)
+    tree.sync(tree.root, ['Al', 'Au', 'Cu', 'Ni'], leaf)
+    ok = listener.events == [('insert', None, 3, 3), ('insert', None, 1, 1), ('remove', None, 3, 3)]
+    ok = ok and tree.root.child('Cu') is cu and cu.row == 2
+    ok = ok and [c.key for c in tree.root.children] == ['Al', 'Au', 'Cu', 'Ni']
+    tree.sync(tree.root, [], leaf)
+    ok = ok and tree.root.children == [] and not tree.can_fetch(tree.root)
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 4: Large trees
+    print("Test 4: 10k materials")
+    print("-" * 70)
+    names = [f"Material_{i:05d}" for i in range(10000)]
+    tree = LazyTree()
+    start = time.perf_counter()
+    tree.sync(tree.root, names, leaf)
+    tree.fetch(tree.root)
+    elapsed = (time.perf_counter() - start) * 1000
+    ok = tree.created == tree.BATCH and len(tree.root.pending) == 10000 - tree.BATCH
+    # Filtering within the loaded range keeps the rest pending
+    tree.sync(tree.root, names[::2], leaf)
+    ok = ok and len(tree.root.children) == tree.BATCH // 2 and tree.created == tree.BATCH
+    print(f"  {tree.created} nodes created, opened in {elapsed:.1f} ms")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+
+if __name__ == "__main__":
+    test_lazy_tree()
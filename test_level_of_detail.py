@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+"""
+Test Script: Level-of-Detail Decimation
+
+Tests that:
+1. LTTB keeps the endpoints and peaks within the point budget
+2. Min/max bucketing keeps every spike
+3. Dense scatters are binned and per-point colors follow the kept points
+4. Zooming recomputes the reduction and reveals full-resolution points
+5. full_resolution() draws every point for exports, then restores
+"""
+
+import importlib.util
+import time
+from pathlib import Path
+
+import numpy as np
+import matplotlib
+matplotlib.use('Agg')
+import matplotlib.pyplot as plt
+
+_spec = importlib.util.spec_from_file_location(
+    'level_of_detail', Path(__file__).parent / 'Visualization/level_of_detail.py')
+lod_module = importlib.util.module_from_spec(_spec)
+_spec.loader.exec_module(lod_module)
+
+
+def test_level_of_detail():
+    """Test level-of-detail decimation."""
+
+    print("\n" + "="*70)
+    print("Level-of-Detail Decimation Test")
+    print("="*70 + "\n")
+
+    rng = np.random.default_rng(7)
+    x = np.linspace(0.0, 10.0, 500_000)
+    y = np.sin(x) + 0.01 * rng.standard_normal(len(x))
+    y[123_456] = 25.0
+
+    # Test 1: LTTB
+    print("Test 1: LTTB keeps endpoints and peaks")
+    print("-" * 70)
+    start = time.perf_counter()
+    idx = lod_module.lttb_indices(x, y, 1000)
+    elapsed = time.perf_counter() - start
+    ok = len(idx) == 1000 and idx[0] == 0 and idx[-1] == len(x) - 1
+    ok = ok and np.all(np.diff(idx) > 0) and 123_456 in idx
+    print(f"  500k -> {len(idx)} points in {elapsed*1000:.1f} ms")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 2: Min/max
+    print("Test 2: Min/max bucketing keeps spikes")
+    print("-" * 70)
+    spiky = y.copy()
+    spiky[400_000] = -30.0
+    idx = lod_module.minmax_indices(spiky, 1000)
+    ok = len(idx) <= 1004 and 123_456 in idx and 400_000 in idx
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 3: Scatter binning
+    print("Test 3: Dense scatter binned with per-point colors")
+    print("-" * 70)
+    fig, ax = plt.subplots()
+    lod = lod_module.level_of_detail(fig)
+    px = rng.standard_normal(200_000)
+    py = rng.standard_normal(200_000)
+    values = np.arange(len(px), dtype=float)
+    scatter = lod.scatter(ax, px, py, c=values, s=4)
+    shown = lod.shown_points(scatter)
+    kept = np.asarray(scatter.get_offsets())
+    ok = 0 < shown < 50_000 and len(scatter.get_array()) == shown
+    # Colors stay attached to their points
+    first = int(scatter.get_array()[0])
+    ok = ok and np.allclose(kept[0], (px[first], py[first]))
+    print(f"  200000 -> {shown} points")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 4: Zoom
+    print("Test 4: Zoom recomputes for the new view")
+    print("-" * 70)
+    line, = lod.line(ax, x, y, '-')
+    ok = lod.shown_points(line) <= lod.max_line_points + 4
+    ax.set_xlim(2.0, 2.01)
+    ax.set_ylim(-0.05, 0.05)
+    visible = np.count_nonzero((x >= 2.0) & (x <= 2.01))
+    ok = ok and lod.shown_points(line) >= visible
+    ok = ok and np.all(np.isin(x[(x >= 2.0) & (x <= 2.01)], line.get_xdata()))
+    zoomed = np.count_nonzero((px >= 2.0) & (px <= 2.01) & (np.abs(py) <= 0.05))
+    ok = ok and lod.shown_points(scatter) <= zoomed + 4
+    print(f"  Line points in view: {lod.shown_points(line)}")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 5: Export
+    print("Test 5: full_resolution() for exports")
+    print("-" * 70)
+    with lod_module.full_resolution(fig):
+        ok = lod.shown_points(line) == len(x) and len(line.get_xdata()) == len(x)
+        ok = ok and len(scatter.get_offsets()) == len(px)
+    ok = ok and len(line.get_xdata()) < len(x)
+    plain = plt.figure()
+    with lod_module.full_resolution(plain):
+        pass
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+    plt.close('all')
+
+
+if __name__ == "__main__":
+    test_level_of_detail()
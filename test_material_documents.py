@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+"""
+Test Script: Material Document Cache
+
+Tests that:
+1. Every normalized table gets version-bumping triggers
+2. Current documents are returned with one query (no table walk)
+3. Stale or hash-mismatched documents are rebuilt and saved, without
+   committing a transaction the caller has open
+4. Documents keep key order through the JSON round trip
+"""
+
+import json
+
+from db.material_document_storage import (
+    get_create_sql, MaterialDocumentStorage, SOURCE_TABLES
+)
+from db.query import MaterialQuerier
+
+
+class FakeCursor:
+    def __init__(self, conn):
+        self.conn = conn
+
+    def execute(self, query, params=None):
+        self.conn.executed.append((query, params))
+
+    def fetchone(self):
+        return self.conn.row
+
+    def fetchall(self):
+        return [(1,) + self.conn.row] if self.conn.row else []
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        pass
+
+
+class FakeConnection:
+    def __init__(self, row, status=0):
+        self.row = row
+        self.status = status
+        self.executed = []
+        self.commits = 0
+
+    def cursor(self):
+        return FakeCursor(self)
+
+    def get_transaction_status(self):
+        return self.status
+
+    def commit(self):
+        self.commits += 1
+
+
+DOCUMENT = {
+    'metadata': {'id': 'CU-001', 'name': 'Copper'},
+    'properties': {'Thermal': {'Density': {'unit': 'kg/m^3', 'entries': []}}},
+    'models': {'EOSModel': {'rows': []}, 'ElasticModel': {}},
+}
+
+
+def make_querier(row, status=0):
+    querier = MaterialQuerier.__new__(MaterialQuerier)
+    querier.conn = FakeConnection(row, status)
+    querier.documents = MaterialDocumentStorage.__new__(MaterialDocumentStorage)
+    querier.documents.conn = querier.conn
+    querier.documents.available = True
+    querier.assembled = 0
+
+    def assemble(material_id):
+        querier.assembled += 1
+        return json.loads(json.dumps(DOCUMENT))
+
+    querier._assemble_material = assemble
+    return querier
+
+
+def test_material_documents():
+    """Test the material document cache."""
+
+    print("\n" + "="*70)
+    print("Material Document Cache Test")
+    print("="*70 + "\n")
+
+    # Test 1: Schema
+    print("Test 1: Invalidation triggers")
+    print("-" * 70)
+    sql = get_create_sql()
+    ok = len(SOURCE_TABLES) == 7 and "document JSON," in sql
+    ok = ok and all(f"CREATE TRIGGER {table}_documents_delete" in sql for table in SOURCE_TABLES)
+    ok = ok and all(f"CREATE TRIGGER {table}_documents_update_old" in sql for table in SOURCE_TABLES)
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 2: Fresh document
+    print("Test 2: Current document")
+    print("-" * 70)
+    querier = make_querier((DOCUMENT, 7, True))
+    data = querier._load_documents([1])[1]
+    query, _ = querier.conn.executed[0]
+    ok = data == DOCUMENT and querier.assembled == 0 and len(querier.conn.executed) == 1
+    ok = ok and "md5(document::text) = content_hash" in query and "built_version = version" in query
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 3: Stale document
+    print("Test 3: Stale document is rebuilt")
+    print("-" * 70)
+    querier = make_querier((DOCUMENT, 9, False))
+    data = querier._load_documents([1])[1]
+    query, params = querier.conn.executed[-2]
+    ok = data == DOCUMENT and querier.assembled == 1 and querier.conn.commits == 1
+    ok = ok and "INSERT INTO material_documents" in query and params['version'] == 9
+    ok = ok and querier.conn.executed[-1][0] == "RELEASE SAVEPOINT store_documents"
+    missing = make_querier(None)
+    missing._load_documents([1])
+    ok = ok and missing.assembled == 1 and missing.conn.executed[-2][1]['version'] == 0
+    # Inside a caller's transaction (status INTRANS): saved, not committed
+    in_transaction = make_querier((DOCUMENT, 9, False), status=2)
+    in_transaction._load_documents([1])
+    ok = ok and in_transaction.conn.commits == 0
+    ok = ok and "INSERT INTO material_documents" in in_transaction.conn.executed[-2][0]
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 4: Key order
+    print("Test 4: Key order preserved")
+    print("-" * 70)
+    stored = params['doc']
+    ok = list(json.loads(stored)['models']) == ['EOSModel', 'ElasticModel']
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+
+if __name__ == "__main__":
+    test_material_documents()
@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+"""
+Test Script: Formulation Mixture Rules
+
+Tests that:
+1. A single-constituent "mixture" reproduces the constituent exactly
+2. Density follows volume additivity and Cp the mass average
+3. Mixture Hugoniot states are in pressure equilibrium and satisfy the jump conditions
+4. Missing constituent data gives NaN only where that constituent is weighted
+5. Composition grids cover the simplex and sweeps evaluate thousands of compositions
+6. The formulation table is checked once per connection and created only when missing
+"""
+
+import time
+
+import numpy as np
+
+from db.formulation_storage import FormulationStorage
+from physics.mixtures import (
+    ConstituentTable, composition_grid, composition_matrix, constituent_volumes, evaluate
+)
+
+
+# RDX, TNT, HMX (g/cm³, J/kg/K, km/s, -)
+TABLE = ConstituentTable(['RDX', 'TNT', 'HMX'],
+                         rho0=[1.806, 1.654, 1.900],
+                         cp=[1590.0, 1604.0, 1800.0],
+                         C0=[2.78, 1.55, 2.74],
+                         s=[1.90, 2.25, 2.425])
+
+
+class FakeCursor:
+    def __init__(self, conn):
+        self.conn = conn
+
+    def execute(self, query, params=None):
+        self.conn.executed.append(query)
+
+    def fetchone(self):
+        return (self.conn.present,)
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        pass
+
+
+class FakeConnection:
+    def __init__(self, present):
+        self.present = present
+        self.executed = []
+
+    def cursor(self):
+        return FakeCursor(self)
+
+    def commit(self):
+        pass
+
+
+def test_mixtures():
+    """Test mixture rule engine."""
+
+    print("\n" + "="*70)
+    print("Formulation Mixture Rule Test")
+    print("="*70 + "\n")
+
+    # Test 1: Pure constituents
+    print("Test 1: Pure constituents reproduce their own data")
+    print("-" * 70)
+    pure = evaluate(TABLE, np.eye(3))
+    ok = np.allclose(pure['rho0'], TABLE.rho0) and np.allclose(pure['cp'], TABLE.cp)
+    ok = ok and np.allclose(pure['C0'], TABLE.C0) and np.allclose(pure['s'], TABLE.s)
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 2: Density and Cp rules
+    print("Test 2: Comp B 60/40 density and Cp")
+    print("-" * 70)
+    weights = composition_matrix(TABLE, [{'RDX': 0.6, 'TNT': 0.4}, {'HMX': 0.94}])
+    comp_b = evaluate(TABLE, weights['W'])
+    rho_expected = 1.0 / (0.6 / 1.806 + 0.4 / 1.654)
+    ok = abs(comp_b['rho0'][0] - rho_expected) < 1.0e-12
+    ok = ok and abs(comp_b['cp'][0] - (0.6 * 1590.0 + 0.4 * 1604.0)) < 1.0e-9
+    ok = ok and np.allclose(weights['coverage'], [1.0, 0.94]) and abs(comp_b['rho0'][1] - 1.9) < 1.0e-12
+    print(f"  rho0 = {comp_b['rho0'][0]:.4f} g/cm³, cp = {comp_b['cp'][0]:.1f} J/kg/K")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 3: Pressure equilibrium and jump conditions
+    print("Test 3: Mixture Hugoniot in pressure equilibrium")
+    print("-" * 70)
+    hug = comp_b['hugoniot']
+    V_parts = constituent_volumes(TABLE, hug['P'])
+    V0 = 1.0 / comp_b['rho0'][0]
+    ok = np.allclose(hug['V'][0], 0.6 * V_parts[0] + 0.4 * V_parts[1])
+    ok = ok and np.allclose(hug['P'], hug['Us'][0] * hug['up'][0] / V0)
+    ok = ok and np.allclose(hug['V'][0], V0 * (1.0 - hug['up'][0] / hug['Us'][0]))
+    ok = ok and TABLE.C0[1] < comp_b['C0'][0] < TABLE.C0[0]
+    print(f"  Fit: C0 = {comp_b['C0'][0]:.3f} km/s, s = {comp_b['s'][0]:.3f} (rms {hug['rms'][0]:.2e})")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 4: Missing data
+    print("Test 4: Missing constituent data propagates only where weighted")
+    print("-" * 70)
+    partial = ConstituentTable(TABLE.names, TABLE.rho0, TABLE.cp, [2.78, np.nan, 2.74], TABLE.s)
+    result = evaluate(partial, np.array([[0.6, 0.4, 0.0], [0.5, 0.0, 0.5]]))
+    ok = np.isnan(result['C0'][0]) and np.isfinite(result['C0'][1]) and np.isfinite(result['rho0']).all()
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 5: Composition sweep
+    print("Test 5: Simplex grid sweep")
+    print("-" * 70)
+    W = composition_grid(3, 0.01)
+    start = time.perf_counter()
+    sweep = evaluate(TABLE, W)
+    elapsed = time.perf_counter() - start
+    ok = len(W) == 5151 and np.allclose(W.sum(axis=1), 1.0) and (W >= 0.0).all()
+    ok = ok and len(np.unique(np.round(W * 100).astype(int), axis=0)) == len(W)
+    ok = ok and np.isfinite(sweep['C0']).all()
+    print(f"  {len(W)} compositions in {elapsed*1000:.2f} ms")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 6: One-time schema check
+    print("Test 6: Formulation table checked once per connection")
+    print("-" * 70)
+    conn = FakeConnection(present=False)
+    FormulationStorage(conn)
+    FormulationStorage(conn)
+    creates = [q for q in conn.executed if 'CREATE TABLE' in q]
+    checks = [q for q in conn.executed if 'to_regclass' in q]
+    ok = len(checks) == 1 and len(creates) == 1
+    existing = FakeConnection(present=True)
+    FormulationStorage(existing)
+    ok = ok and not any('CREATE TABLE' in q for q in existing.executed)
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+
+if __name__ == "__main__":
+    test_mixtures()
@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+"""
+Test Script: Shared XML Model Index
+
+Tests that:
+1. build() parses every XML file once; lookups are case-insensitive
+2. Touching a file without changing it does not re-parse it
+3. Edited, added and removed files are picked up
+4. Concurrent lookups parse each file once
+5. Malformed XML is recorded on the entry instead of raising
+"""
+
+import importlib.util
+import os
+import tempfile
+import time
+from concurrent.futures import ThreadPoolExecutor
+from pathlib import Path
+
+# Load directly: the data_types package imports PyQt6
+_spec = importlib.util.spec_from_file_location(
+    'model_index', Path(__file__).parent / 'Visualization/final_visualization/data_types/model_index.py')
+model_index = importlib.util.module_from_spec(_spec)
+_spec.loader.exec_module(model_index)
+XMLModelIndex = model_index.XMLModelIndex
+
+
+MODEL_XML = """<Material>
+  <Properties>
+    <Property name="Shock_Hugoniot">
+      <Parameters>
+        <Parameter name="C0">{c0}</Parameter>
+        <Parameter name="S">{s}</Parameter>
+      </Parameters>
+    </Property>
+  </Properties>
+  <Models>
+    <Model type="JohnsonCook"><Parameter name="A">90</Parameter></Model>
+  </Models>
+</Material>
+"""
+
+
+def touch_dir(path):
+    """Force a visible directory mtime change on coarse-timestamp filesystems."""
+    stamp = time.time_ns() + 1_000_000_000
+    os.utime(path, ns=(stamp, stamp))
+
+
+def test_model_index():
+    """Test shared XML model index."""
+
+    print("\n" + "="*70)
+    print("Shared XML Model Index Test")
+    print("="*70 + "\n")
+
+    with tempfile.TemporaryDirectory() as tmp:
+        xml_dir = Path(tmp)
+        (xml_dir / "Copper.xml").write_text(MODEL_XML.format(c0=3.94, s=1.49))
+        (xml_dir / "aluminum.xml").write_text(MODEL_XML.format(c0=5.35, s=1.34))
+        (xml_dir / "Broken.xml").write_text("<Material><Property>")
+        (xml_dir / "readme.txt").write_text("not xml")
+
+        index = XMLModelIndex(xml_dir).build()
+
+        # Test 1: One pass
+        print("Test 1: One parse per file, O(1) lookups")
+        print("-" * 70)
+        copper = index.get("copper")
+        ok = index.parse_count == 3 and sorted(index.materials()) == ["Broken", "Copper", "aluminum"]
+        ok = ok and copper.properties[0] == ("Shock_Hugoniot", [("C0", "3.94"), ("S", "1.49")])
+        ok = ok and copper.model_types() == ["JohnsonCook"] and index.get("Aluminum").material == "aluminum"
+        ok = ok and index.get("Tungsten") is None and index.parse_count == 3
+        print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+        assert ok
+
+        # Test 2: Touch
+        print("Test 2: Unchanged content is not re-parsed")
+        print("-" * 70)
+        stamp = time.time_ns() + 2_000_000_000
+        os.utime(xml_dir / "Copper.xml", ns=(stamp, stamp))
+        ok = index.get("Copper") is copper and index.parse_count == 3
+        print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+        assert ok
+
+        # Test 3: Changes
+        print("Test 3: Edited, added and removed files")
+        print("-" * 70)
+        (xml_dir / "Copper.xml").write_text(MODEL_XML.format(c0=3.93, s=1.50))
+        edited = index.get("Copper")
+        ok = edited.properties[0][1][0] == ("C0", "3.93") and edited.content_hash != copper.content_hash
+        (xml_dir / "Nickel.xml").write_text(MODEL_XML.format(c0=4.44, s=1.60))
+        (xml_dir / "aluminum.xml").unlink()
+        touch_dir(xml_dir)
+        ok = ok and index.get("Nickel") is not None and index.get("aluminum") is None
+        print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+        assert ok
+
+        # Test 4: Threads
+        print("Test 4: Concurrent lookups parse once")
+        print("-" * 70)
+        for i in range(20):
+            (xml_dir / f"M{i}.xml").write_text(MODEL_XML.format(c0=i, s=1.0))
+        fresh = XMLModelIndex(xml_dir)
+        with ThreadPoolExecutor(max_workers=8) as pool:
+            found = list(pool.map(lambda i: fresh.get(f"m{i % 20}"), range(200)))
+        ok = all(entry is not None for entry in found) and fresh.parse_count == 20
+        print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+        assert ok
+
+        # Test 5: Malformed XML
+        print("Test 5: Parse errors recorded on the entry")
+        print("-" * 70)
+        broken = index.get("Broken")
+        ok = broken is not None and broken.error and broken.properties == []
+        print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+        assert ok
+
+
+if __name__ == "__main__":
+    test_model_index()
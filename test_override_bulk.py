@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+"""
+Test Script: Bulk Override Edits and Overrides XML
+
+Tests that:
+1. The override table is checked once per connection
+2. Bulk edits are batched multi-row statements in one transaction
+3. A failing bulk edit rolls back everything
+4. Overrides XML round-trips through the streaming exporter and importer
+5. Entries without a value (older exports) are skipped
+"""
+
+import os
+import tempfile
+import datetime
+
+import db.override_storage as override_storage
+from db.override_storage import OverrideStorage, BATCH_SIZE
+from overrides.override_xml import (
+    read_overrides_material, import_overrides_xml, write_overrides_xml
+)
+
+
+class FakeCursor:
+    def __init__(self, conn):
+        self.conn = conn
+
+    def execute(self, query, params=None):
+        self.conn.executed.append((query, params))
+
+    def fetchone(self):
+        return (True,)
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        pass
+
+
+class FakeConnection:
+    def __init__(self):
+        self.executed = []
+        self.batches = []
+        self.commits = 0
+        self.rollbacks = 0
+
+    def cursor(self):
+        return FakeCursor(self)
+
+    def commit(self):
+        self.commits += 1
+
+    def rollback(self):
+        self.rollbacks += 1
+
+
+def record_values(cur, sql, rows, template=None, page_size=100):
+    """Stands in for psycopg2.extras.execute_values."""
+    cur.conn.batches.append(('INSERT' in sql, list(rows)))
+
+
+override_storage.execute_values = record_values
+
+
+def test_override_bulk():
+    """Test bulk override edits and overrides XML."""
+
+    print("\n" + "="*70)
+    print("Bulk Override Edits Test")
+    print("="*70 + "\n")
+
+    # Test 1: One-time schema check
+    print("Test 1: Schema checked once per connection")
+    print("-" * 70)
+    conn = FakeConnection()
+    OverrideStorage(conn)
+    OverrideStorage(conn)
+    storage = OverrideStorage(conn)
+    checks = [q for q, _ in conn.executed if 'to_regclass' in q]
+    ok = len(checks) == 1 and not any('CREATE TABLE' in q for q, _ in conn.executed)
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 2: Batches in one transaction
+    print("Test 2: Multi-row statements, one commit")
+    print("-" * 70)
+    conn.commits = 0
+    n = 2 * BATCH_SIZE + 10
+    rows = [(1, f'properties.Thermal.P{i}', 'value_override', {'value': str(i), 'unit': None, 'reason': None})
+            for i in range(n)]
+    rows.append((1, 'properties.Thermal.P0', 'value_override', {'value': 'last', 'unit': None, 'reason': None}))
+    rows.append((1, 'properties.Thermal.Density', None, None))
+    counts = storage.apply_overrides_bulk(iter(rows))
+    inserts = [batch for is_insert, batch in conn.batches if is_insert]
+    deletes = [batch for is_insert, batch in conn.batches if not is_insert]
+    saved = {row[1]: row[3] for batch in inserts for row in batch}
+    ok = conn.commits == 1 and len(inserts) == 3 and counts == {'saved': n + 1, 'deleted': 2}
+    ok = ok and '"last"' in saved['properties.Thermal.P0']
+    ok = ok and sorted(deletes[0]) == [(1, 'properties.Thermal.Density', 'reference_preference'),
+                                       (1, 'properties.Thermal.Density', 'value_override')]
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 3: Rollback
+    print("Test 3: Failed bulk edit is rolled back")
+    print("-" * 70)
+    conn.commits = 0
+    try:
+        storage.apply_overrides_bulk([(1, 'properties.Thermal.Cp', 'bogus', {})])
+        failed = False
+    except ValueError:
+        failed = True
+    ok = failed and conn.rollbacks == 1 and conn.commits == 0
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 4: XML round trip
+    print("Test 4: Export and re-import overrides XML")
+    print("-" * 70)
+    stored = [
+        {'property_path': 'properties.Thermal.Cp', 'override_type': 'value_override',
+         'override_data': {'value': '900', 'unit': 'J/kg/K', 'reason': 'Measured <DSC>'},
+         'created_at': datetime.datetime(2026, 1, 2, 3, 4, 5)},
+        {'property_path': 'properties.Thermal.Density', 'override_type': 'reference_preference',
+         'override_data': {'preferred_ref': '113'}, 'created_at': None},
+    ]
+    path = os.path.join(tempfile.mkdtemp(), 'Al & Co_Overrides.xml')
+    written = write_overrides_xml(iter(stored), 'Al & Co', path, count=2)
+    conn.batches = []
+    stats = import_overrides_xml(storage, path, 7, replace=True)
+    imported = [row for _, batch in conn.batches for row in batch]
+    ok = written == 2 and read_overrides_material(path) == 'Al & Co'
+    ok = ok and stats['saved'] == 2 and stats['skipped'] == 0
+    ok = ok and any('DELETE' in q and p == ([7],) for q, p in conn.executed)
+    ok = ok and imported[0][:3] == (7, 'properties.Thermal.Cp', 'value_override')
+    ok = ok and 'Measured <DSC>' in imported[0][3]
+    ok = ok and imported[1][:3] == (7, 'properties.Thermal.Density', 'reference_preference')
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 5: Older export without values
+    print("Test 5: Entries without a value are skipped")
+    print("-" * 70)
+    stats = import_overrides_xml(storage, 'Aluminum_Overrides.xml', 1)
+    ok = read_overrides_material('Aluminum_Overrides.xml') == 'Aluminum'
+    ok = ok and stats['read'] == 2 and stats['skipped'] == 2 and stats['saved'] == 0
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+
+if __name__ == "__main__":
+    test_override_bulk()
@@ -0,0 +1,193 @@
+#!/usr/bin/env python3
+"""
+Test Script: Server-Side Override Resolution
+
+Tests that:
+1. The resolution functions join overrides by stored path
+2. Resolved rows patch a material exactly like OverrideManager does
+3. EOS row, nested and Phase paths are resolved; unknown paths are skipped
+4. Batch loads resolve overrides of all materials with one query
+5. The functions are installed once, and only when their version differs
+"""
+
+import copy
+
+from db.override_resolution_storage import (
+    get_functions_sql, apply_effective_values, OverrideResolutionStorage, FUNCTIONS_VERSION
+)
+from db.query import MaterialQuerier
+from overrides.override_manager import OverrideManager
+
+
+MATERIAL = {
+    'metadata': {'id': 'AL-001', 'name': 'Aluminum'},
+    'properties': {
+        'Phase': {'State': 'solid'},
+        'Thermal': {
+            'Density': {'unit': 'kg/m^3', 'entries': [
+                {'value': '2700', 'ref': '112', 'index': 1},
+                {'value': '2712', 'ref': '113', 'index': 2},
+            ]},
+            'Cp': {'unit': 'J/kg/K', 'entries': [{'value': '897', 'ref': '112', 'index': 1}]},
+        },
+    },
+    'models': {
+        'ElasticModel': {'ThermoMechanical': {
+            'Density': [{'value': '2.7', 'unit': 'g/cc', 'ref': '112', 'index': 1}],
+        }},
+        'ElastoPlastic': {
+            'ShearModulus': [{'value': '26', 'unit': 'GPa', 'ref': '112', 'index': 1}],
+        },
+        'EOSModel': {'rows': [
+            {'index': '1', 'parameters': {
+                'K0': {'value': '76', 'unit': 'GPa', 'ref': '112', 'index': 1},
+                'unreacted': {'K0': {'value': '70', 'unit': 'GPa', 'ref': '112'}},
+            }},
+        ]},
+    },
+}
+
+
+def row(path, value, unit, ref, index, source):
+    return {'material_id': 1, 'path': path, 'value': value, 'unit': unit,
+            'ref_id': ref, 'entry_index': index, 'source': source}
+
+
+class FakeCursor:
+    def __init__(self, conn):
+        self.conn = conn
+
+    def execute(self, query, params=None):
+        self.conn.executed.append((query, params))
+
+    def fetchall(self):
+        return self.conn.rows
+
+    def fetchone(self):
+        return (self.conn.version,)
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        pass
+
+
+class FakeConnection:
+    def __init__(self, rows, version=None):
+        self.rows = rows
+        self.version = version
+        self.executed = []
+
+    def cursor(self):
+        return FakeCursor(self)
+
+    def commit(self):
+        pass
+
+    def rollback(self):
+        pass
+
+
+class FakePaths:
+    available = True
+
+    def complete(self):
+        return True
+
+
+def test_override_resolution():
+    """Test server-side override resolution."""
+
+    print("\n" + "="*70)
+    print("Server-Side Override Resolution Test")
+    print("="*70 + "\n")
+
+    # Test 1: SQL
+    print("Test 1: Resolution functions")
+    print("-" * 70)
+    sql = get_functions_sql()
+    ok = "FUNCTION effective_material_values(ids INTEGER[])" in sql
+    ok = ok and "FUNCTION material_override_values(ids INTEGER[])" in sql
+    ok = ok and "text2ltree(path_labels(property_path))" in sql and "e.path = o.path" in sql
+    ok = ok and "AND source <> 'stored'" in sql and "'USER_OVERRIDE'" in sql
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 2: Same result as OverrideManager
+    print("Test 2: Parity with OverrideManager")
+    print("-" * 70)
+    manager = OverrideManager()
+    manager.set_preferred_reference(1, 'properties.Thermal.Density', '113')
+    manager.set_value_override(1, 'properties.Thermal.Cp', '900')
+    manager.set_value_override(1, 'models.ElasticModel.ThermoMechanical.Density', '2.71', 'g/cc')
+    manager.set_value_override(1, 'models.ElastoPlastic.ShearModulus', '27')
+    expected = manager.apply_overrides(1, MATERIAL)
+
+    rows = [
+        row('models.ElasticModel.ThermoMechanical.Density', '2.71', 'g/cc', 'USER_OVERRIDE', 1, 'override'),
+        row('models.ElastoPlastic.ShearModulus', '27', 'GPa', 'USER_OVERRIDE', 1, 'override'),
+        row('properties.Thermal.Cp', '900', 'J/kg/K', 'USER_OVERRIDE', 1, 'override'),
+        row('properties.Thermal.Density', '2712', 'kg/m^3', '113', 2, 'preferred'),
+    ]
+    actual = copy.deepcopy(MATERIAL)
+    updated = apply_effective_values(actual, rows)
+    ok = updated == 4 and actual == expected
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 3: Other path shapes
+    print("Test 3: EOS rows, nested and Phase paths")
+    print("-" * 70)
+    actual = copy.deepcopy(MATERIAL)
+    updated = apply_effective_values(actual, [
+        row('models.EOSModel.Row.1.K0', '77', 'GPa', 'USER_OVERRIDE', 1, 'override'),
+        row('models.EOSModel.Row.1.unreacted.K0', '71', 'GPa', 'USER_OVERRIDE', 1, 'override'),
+        row('models.EOSModel.Row.9.K0', '1', 'GPa', 'USER_OVERRIDE', 1, 'override'),
+        row('properties.Phase.State', 'liquid', None, 'USER_OVERRIDE', 1, 'override'),
+    ])
+    parameters = actual['models']['EOSModel']['rows'][0]['parameters']
+    ok = updated == 3 and parameters['K0']['value'] == '77'
+    ok = ok and parameters['unreacted']['K0']['value'] == '71'
+    ok = ok and actual['properties']['Phase']['State'] == 'liquid'
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 4: Batch
+    print("Test 4: One query for many materials")
+    print("-" * 70)
+    querier = MaterialQuerier.__new__(MaterialQuerier)
+    querier.conn = FakeConnection([
+        (1, 'properties.Thermal.Cp', '900', 'J/kg/K', 'USER_OVERRIDE', 1, 'override'),
+        (2, 'models.ElastoPlastic.ShearModulus', '27', 'GPa', 'USER_OVERRIDE', 1, 'override'),
+    ])
+    querier.resolution = OverrideResolutionStorage.__new__(OverrideResolutionStorage)
+    querier.resolution.conn = querier.conn
+    querier.resolution.available = True
+    materials = {1: copy.deepcopy(MATERIAL), 2: copy.deepcopy(MATERIAL), 3: copy.deepcopy(MATERIAL)}
+    querier._apply_overrides(materials)
+    ok = len(querier.conn.executed) == 1 and querier.conn.executed[0][1] == ([1, 2, 3],)
+    ok = ok and materials[1]['properties']['Thermal']['Cp']['entries'][0]['value'] == '900'
+    ok = ok and materials[2]['models']['ElastoPlastic']['ShearModulus'][0]['value'] == '27'
+    ok = ok and materials[3] == MATERIAL
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 5: Install once
+    print("Test 5: Functions installed once per version")
+    print("-" * 70)
+    current = FakeConnection([], version=FUNCTIONS_VERSION)
+    OverrideResolutionStorage(current, FakePaths())
+    OverrideResolutionStorage(current, FakePaths())
+    ok = len(current.executed) == 1 and "to_regprocedure" in current.executed[0][0]
+    outdated = FakeConnection([], version='old')
+    storage = OverrideResolutionStorage(outdated, FakePaths())
+    queries = [q for q, _ in outdated.executed]
+    ok = ok and storage.available and "pg_advisory_xact_lock" in queries[1]
+    ok = ok and queries[3] == get_functions_sql() and "COMMENT ON FUNCTION" in queries[4]
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+
+if __name__ == "__main__":
+    test_override_resolution()
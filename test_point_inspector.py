@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+"""
+Test Script: KD-Tree Point Inspector
+
+Tests that:
+1. KD-tree nearest-point queries match a brute-force scan
+2. Queries respect the pick radius
+3. Hovering a point reports its dataset, reference and values
+4. The index is rebuilt only after zoom or data changes
+5. Removed point sets are no longer picked
+"""
+
+import importlib.util
+import time
+from pathlib import Path
+
+import numpy as np
+import matplotlib
+matplotlib.use('Agg')
+import matplotlib.pyplot as plt
+from matplotlib.backend_bases import MouseEvent
+
+_spec = importlib.util.spec_from_file_location(
+    'point_inspector', Path(__file__).parent / 'Visualization/point_inspector.py')
+point_inspector = importlib.util.module_from_spec(_spec)
+_spec.loader.exec_module(point_inspector)
+KDTree = point_inspector.KDTree
+PointInspector = point_inspector.PointInspector
+
+
+def test_point_inspector():
+    """Test KD-tree point inspector."""
+
+    print("\n" + "="*70)
+    print("KD-Tree Point Inspector Test")
+    print("="*70 + "\n")
+
+    rng = np.random.default_rng(3)
+
+    # Test 1: Nearest point
+    print("Test 1: Nearest point matches brute force")
+    print("-" * 70)
+    points = rng.uniform(0, 1000, size=(100_000, 2))
+    start = time.perf_counter()
+    tree = KDTree(points)
+    built = time.perf_counter() - start
+    queries = rng.uniform(0, 1000, size=(200, 2))
+    start = time.perf_counter()
+    found = [tree.query(q) for q in queries]
+    per_query = (time.perf_counter() - start) / len(queries)
+    expected = [int(np.argmin(((points - q) ** 2).sum(axis=1))) for q in queries]
+    ok = [i for i, _ in found] == expected
+    print(f"  Build: {built*1000:.0f} ms, query: {per_query*1e6:.0f} µs")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 2: Radius
+    print("Test 2: Pick radius")
+    print("-" * 70)
+    small = KDTree(np.array([[10.0, 10.0], [50.0, 50.0]]))
+    ok = small.query((13.0, 14.0), 8.0) == (0, 5.0) and small.query((30.0, 30.0), 8.0)[0] == -1
+    ok = ok and KDTree(np.empty((0, 2))).query((0.0, 0.0))[0] == -1
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 3: Hover
+    print("Test 3: Hover shows dataset, reference and values")
+    print("-" * 70)
+    fig, ax = plt.subplots()
+    up = rng.uniform(0.5, 4.0, 20_000)
+    us = 3.94 + 1.49 * up + 0.05 * rng.standard_normal(len(up))
+    ax.scatter(up, us, s=4)
+    fig.canvas.draw()
+    shown = []
+    inspector = PointInspector(fig.canvas, show=lambda text, event: shown.append(text),
+                               hide=lambda: shown.append(None))
+    inspector.add_points(ax, up, us,
+                         lambda i: f"Dataset: cu.yaml\nReference: Marsh\nUp = {up[i]:.3f}, Us = {us[i]:.3f}",
+                         name="Copper")
+    target = 1234
+    x_px, y_px = ax.transData.transform((up[target], us[target]))
+    event = MouseEvent('motion_notify_event', fig.canvas, x_px, y_px)
+    fig.canvas.callbacks.process('motion_notify_event', event)
+    ok = inspector.nearest(x_px, y_px)[1:] == (target, 0.0)
+    # Events carry whole pixels, so the hovered point is the nearest to that pixel
+    hit = inspector.nearest(event.x, event.y)
+    ok = ok and hit is not None and len(shown) == 1
+    ok = ok and shown[0].startswith("Copper\nDataset: cu.yaml\nReference: Marsh")
+    ok = ok and f"Up = {up[hit[1]]:.3f}" in shown[0]
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 4: Rebuilds
+    print("Test 4: Index rebuilt only on zoom or data change")
+    print("-" * 70)
+    builds = inspector.builds
+    for dx in range(50):
+        inspector.nearest(x_px + dx * 0.1, y_px)
+    ok = inspector.builds == builds
+    ax.set_xlim(up[target] - 0.01, up[target] + 0.01)
+    ax.set_ylim(us[target] - 0.01, us[target] + 0.01)
+    x_px, y_px = ax.transData.transform((up[target], us[target]))
+    ok = ok and inspector.nearest(x_px, y_px)[1] == target and inspector.builds == builds + 1
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 5: Remove
+    print("Test 5: Removed sets are not picked")
+    print("-" * 70)
+    inspector.remove_points("Copper")
+    ok = inspector.nearest(x_px, y_px) is None
+    fig.canvas.callbacks.process('motion_notify_event',
+                                 MouseEvent('motion_notify_event', fig.canvas, x_px, y_px))
+    ok = ok and shown[-1] is None
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+    plt.close('all')
+
+
+if __name__ == "__main__":
+    test_point_inspector()
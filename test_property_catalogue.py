@@ -0,0 +1,194 @@
+#!/usr/bin/env python3
+"""
+Test Script: Columnar Property Catalogue
+
+Tests that:
+1. Rows load into integer-coded columns sorted by property
+2. Property entries are zero-copy slices of the long columns
+3. lookup() matches the get_material_properties() first-entry layout
+4. refresh() reloads only changed materials and keeps codes stable, and
+   skips the checksum query while the change signal is unchanged
+5. Selection lookups over many materials and properties are fast
+6. The change signal falls back to index and statistics lookups (no
+   COUNT(*)) without counters, and the counters install once per connection
+"""
+
+import hashlib
+import time
+
+import numpy as np
+
+from Visualization.property_catalogue import PropertyCatalogue
+from db.table_version_storage import TableVersionStorage
+
+
+class FakeService:
+    """Stands in for VisualizationDataService._execute_query()."""
+
+    def __init__(self, rows, versions=True):
+        self.rows = rows
+        self.queries = 0
+        self.writes = 0
+        self.versions = versions
+        self.signals = []
+
+    def _ensure_table_versions(self):
+        return self.versions
+
+    def _execute_query(self, query, params=None):
+        self.queries += 1
+        if 'table_versions' in query:
+            self.signals.append(query)
+            return [{'version': self.writes}]
+        if 'pg_stat_user_tables' in query:
+            self.signals.append(query)
+            return [{'max_value_id': max(r['value_id'] for r in self.rows), 'writes': self.writes}]
+        if 'md5' in query:
+            by_material = {}
+            for row in sorted(self.rows, key=lambda r: (r['parameter_name'], r['entry_index'])):
+                by_material.setdefault(row['material_id'], []).append(
+                    f"{row['parameter_name']}|{row['entry_index']}|{row['parameter_value']}|{row['parameter_unit']}")
+            return [{'material_id': mid, 'checksum': hashlib.md5(','.join(parts).encode()).hexdigest()}
+                    for mid, parts in by_material.items()]
+        if params:
+            return [row for row in self.rows if row['material_id'] in params[0]]
+        return list(self.rows)
+
+
+def make_row(material_id, name, prop, value, unit='', index=1, value_id=0):
+    return {'material_id': material_id, 'material_name': name, 'parameter_name': prop,
+            'parameter_unit': unit, 'parameter_value': value, 'value_ref': '101',
+            'value_id': value_id, 'entry_index': index, 'category_name': 'Physical',
+            'category_number': 1}
+
+
+def test_property_catalogue():
+    """Test columnar catalogue."""
+
+    print("\n" + "="*70)
+    print("Columnar Property Catalogue Test")
+    print("="*70 + "\n")
+
+    rows = [
+        make_row(1, 'Aluminum', 'Density', '2700', 'kg/m³', 1, 1),
+        make_row(1, 'Aluminum', 'Density', '2710', 'kg/m³', 2, 2),
+        make_row(1, 'Aluminum', 'Melting Temperature', '933', 'K', 1, 3),
+        make_row(3, 'Copper', 'Density', '8960', 'kg/m³', 1, 4),
+        make_row(3, 'Copper', 'Crystal', 'FCC', '', 1, 5),
+    ]
+    service = FakeService(rows)
+    catalogue = PropertyCatalogue().load(service)
+
+    # Test 1: Columns
+    print("Test 1: Integer-coded columns sorted by property")
+    print("-" * 70)
+    ok = len(catalogue) == 5 and catalogue.material.dtype == np.int32 and catalogue.value.dtype == np.float64
+    ok = ok and bool(np.all(np.diff(catalogue.property) >= 0))
+    ok = ok and np.isnan(catalogue.entries('Crystal')['value'][0]) and catalogue.entries('Crystal')['text'][0] == 'FCC'
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 2: Zero-copy slices
+    print("Test 2: Property entries and columns are views")
+    print("-" * 70)
+    density = catalogue.entries('Density')
+    ok = np.shares_memory(density['value'], catalogue.value) and list(density['value']) == [2700.0, 2710.0, 8960.0]
+    ok = ok and np.shares_memory(catalogue.column('Density'), catalogue.first)
+    ok = ok and np.array_equal(catalogue.values([3, 1, 99], ['Density']), [[8960.0, 2700.0, np.nan]], equal_nan=True)
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 3: lookup layout
+    print("Test 3: lookup() matches get_material_properties() layout")
+    print("-" * 70)
+    data = catalogue.lookup([1, 3], ['Density', 'Melting Temperature'])
+    ok = data[1]['_material_name'] == 'Aluminum' and data[1]['Density']['value'] == '2700'
+    ok = ok and data[1]['Density']['unit'] == 'kg/m³' and 'Melting Temperature' not in data[3]
+    available = {p['parameter_name']: p['material_count'] for p in catalogue.available_properties([1, 3])}
+    ok = ok and available == {'Density': 2, 'Melting Temperature': 1, 'Crystal': 1}
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 4: Incremental refresh
+    print("Test 4: Refresh reloads only changed materials")
+    print("-" * 70)
+    codes = dict(catalogue.properties._codes)
+    before = service.queries
+    ok = catalogue.refresh(service) == [] and service.queries == before + 1
+    service.writes += 2
+    service.rows[3] = make_row(3, 'Copper', 'Density', '8940', 'kg/m³', 1, 4)
+    service.rows.append(make_row(5, 'Nickel', 'Density', '8908', 'kg/m³', 1, 6))
+    changed = catalogue.refresh(service)
+    ok = ok and sorted(changed) == [3, 5]
+    ok = ok and np.array_equal(catalogue.values([1, 3, 5], ['Density']), [[2700.0, 8940.0, 8908.0]])
+    ok = ok and all(catalogue.properties.code(name) == code for name, code in codes.items())
+    service.writes += 3
+    service.rows = [row for row in service.rows if row['material_id'] != 1]
+    ok = ok and catalogue.refresh(service) == [1] and np.isnan(catalogue.values([1], ['Density'])[0, 0])
+    ok = ok and len(catalogue) == 3
+    print(f"  Changed: {sorted(changed)}")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 5: Scale
+    print("Test 5: 500 materials x 200 properties selection")
+    print("-" * 70)
+    big = [make_row(m, f'M{m}', f'P{p}', str(m + p / 1000.0), 'u', 1, m * 1000 + p)
+           for m in range(500) for p in range(200)]
+    start = time.perf_counter()
+    catalogue = PropertyCatalogue().load(FakeService(big))
+    load_s = time.perf_counter() - start
+    start = time.perf_counter()
+    block = catalogue.values(list(range(0, 500, 2)), [f'P{p}' for p in range(0, 200, 4)])
+    select_s = time.perf_counter() - start
+    ok = block.shape == (50, 250) and block[1, 1] == 2.004
+    print(f"  Load: {load_s*1000:.1f} ms, selection: {select_s*1000:.3f} ms")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 6: Fallback signal and counter installation
+    print("Test 6: Fallback change signal and counters installed once")
+    print("-" * 70)
+    service = FakeService([make_row(1, 'Aluminum', 'Density', '2700', 'kg/m³', 1, 1)], versions=False)
+    catalogue = PropertyCatalogue().load(service)
+    before = service.queries
+    ok = catalogue.refresh(service) == [] and service.queries == before + 1
+    ok = ok and all('pg_stat_user_tables' in q and 'COUNT' not in q.upper() for q in service.signals)
+    service.writes += 1
+    service.rows[0] = make_row(1, 'Aluminum', 'Density', '2710', 'kg/m³', 1, 1)
+    ok = ok and catalogue.refresh(service) == [1]
+
+    class FakeCursor:
+        def __init__(self, conn):
+            self.conn = conn
+        def __enter__(self):
+            return self
+        def __exit__(self, *exc):
+            return False
+        def execute(self, sql, params=None):
+            self.conn.executed.append(sql)
+        def fetchone(self):
+            return (True, self.conn.installed, self.conn.installed)
+
+    class FakeConnection:
+        def __init__(self, installed):
+            self.installed = installed
+            self.executed = []
+        def cursor(self):
+            return FakeCursor(self)
+        def commit(self):
+            pass
+        def rollback(self):
+            pass
+
+    fresh, ready = FakeConnection(False), FakeConnection(True)
+    ok = ok and TableVersionStorage(fresh).available and TableVersionStorage(fresh).available
+    ok = ok and sum('CREATE TRIGGER' in sql for sql in fresh.executed) == 2 and len(fresh.executed) == 4
+    ok = ok and TableVersionStorage(ready).available and len(ready.executed) == 1
+    print(f"  Statements on fresh connection: {len(fresh.executed)}, on installed: {len(ready.executed)}")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+
+if __name__ == "__main__":
+    test_property_catalogue()
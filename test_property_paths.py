@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+"""
+Test Script: Property Path Queries
+
+Tests that:
+1. Path queries compile to lquery (wildcards, Row indices, alternatives)
+2. Queries without a root search both properties and models
+3. Malformed queries are rejected
+4. One SQL query is issued, restricted to the matching root and materials
+"""
+
+from db.property_path_storage import (
+    compile_path, path_label, path_query_sql, get_create_sql, PropertyPathStorage
+)
+
+
+class FakeCursor:
+    def __init__(self, conn):
+        self.conn = conn
+
+    def execute(self, query, params=None):
+        self.conn.executed.append((query, params))
+
+    def fetchall(self):
+        return self.conn.rows
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        pass
+
+
+class FakeConnection:
+    def __init__(self, rows):
+        self.rows = rows
+        self.executed = []
+
+    def cursor(self):
+        return FakeCursor(self)
+
+
+def test_property_paths():
+    """Test path query compilation and execution."""
+
+    print("\n" + "="*70)
+    print("Property Path Query Test")
+    print("="*70 + "\n")
+
+    # Test 1: Compilation
+    print("Test 1: Path query compilation")
+    print("-" * 70)
+    ok = compile_path("models.EOSModel.Row[*].K0") == ("models.EOSModel.Row.*{1}.K0", ("models",))
+    ok = ok and compile_path("models.EOSModel.Row[2].unreacted|reacted.K0")[0] == \
+        "models.EOSModel.Row.2.unreacted|reacted.K0"
+    ok = ok and compile_path("properties.Thermal.Dens*")[0] == "properties.Thermal.Dens*"
+    ok = ok and compile_path("models.**.Density")[0] == "models.*.Density"
+    ok = ok and path_label("Phase State") == "Phase_State"
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 2: Unrooted queries
+    print("Test 2: Unrooted queries")
+    print("-" * 70)
+    lquery, roots = compile_path("EOSModel.Row[*].K0")
+    ok = lquery == "*{1}.EOSModel.Row.*{1}.K0" and roots == ("properties", "models")
+    ok = ok and compile_path("**.K0") == ("*.K0", ("properties", "models"))
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 3: Errors
+    print("Test 3: Malformed queries")
+    print("-" * 70)
+    rejected = 0
+    for bad in ["", "a..b", "De*ns", "Row[x]", "[2]"]:
+        try:
+            compile_path(bad)
+        except ValueError:
+            rejected += 1
+    ok = rejected == 5
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 4: Single query
+    print("Test 4: One indexed query")
+    print("-" * 70)
+    storage = PropertyPathStorage.__new__(PropertyPathStorage)
+    storage.available = True
+    storage.conn = FakeConnection([("RDX", "models.EOSModel.Row.1.K0", "13.9", "GPa", "112", 1)])
+    results = storage.query("models.EOSModel.Row[*].K0", ["RDX", "TNT"])
+    query, params = storage.conn.executed[0]
+    ok = len(storage.conn.executed) == 1 and "property_entries" not in query
+    ok = ok and "e.path ~ %(lquery)s::lquery" in query and params['materials'] == ["RDX", "TNT"]
+    ok = ok and results[0]['material'] == "RDX" and results[0]['ref'] == "112"
+    ok = ok and "UNION ALL" in path_query_sql() and "USING GIST (path)" in get_create_sql()
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+
+if __name__ == "__main__":
+    test_property_paths()
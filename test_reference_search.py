@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+"""
+Test Script: Reference Full-Text Search
+
+Tests that:
+1. Search text becomes an AND of prefix terms (partially typed words match)
+2. Text without searchable words falls back to plain listing
+3. The schema adds a weighted, generated search_vector with a GIN index
+4. Existing columns are detected without DDL, once per connection
+"""
+
+from db.query import prefix_tsquery, ReferenceQuerier
+from db.schema import get_create_schema_sql, get_references_search_sql
+
+
+class FakeCursor:
+    def __init__(self, conn):
+        self.conn = conn
+
+    def execute(self, query, params=None):
+        self.conn.executed.append(query)
+
+    def fetchone(self):
+        return (self.conn.present,)
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        pass
+
+
+class FakeConnection:
+    def __init__(self, present):
+        self.present = present
+        self.executed = []
+
+    def cursor(self):
+        return FakeCursor(self)
+
+    def commit(self):
+        pass
+
+
+def ensure(conn):
+    querier = ReferenceQuerier.__new__(ReferenceQuerier)
+    querier.conn = conn
+    querier._ensure_search_vector()
+
+
+def test_reference_search():
+    """Test reference full-text search."""
+
+    print("\n" + "="*70)
+    print("Reference Full-Text Search Test")
+    print("="*70 + "\n")
+
+    # Test 1: Prefix queries
+    print("Test 1: Prefix queries")
+    print("-" * 70)
+    ok = prefix_tsquery("Marsh shock-wave") == "marsh:* & shock:* & wave:*"
+    ok = ok and prefix_tsquery("LASL_1980") == "lasl:* & 1980:*"
+    ok = ok and prefix_tsquery("hugon") == "hugon:*"
+    # Quotes and operators are never passed through to to_tsquery
+    ok = ok and prefix_tsquery("it's (a|b) & !c") == "it:* & s:* & a:* & b:* & c:*"
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 2: Empty searches
+    print("Test 2: Empty searches")
+    print("-" * 70)
+    ok = prefix_tsquery("") is None and prefix_tsquery("  -- ") is None
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 3: Schema
+    print("Test 3: Search vector schema")
+    print("-" * 70)
+    sql = get_references_search_sql()
+    ok = "ADD COLUMN IF NOT EXISTS search_vector tsvector" in sql and "STORED" in sql
+    ok = ok and all(f"COALESCE({field}, '')), '{weight}')" in sql
+                    for field, weight in [('title', 'A'), ('author', 'B'), ('journal', 'C'), ('year', 'D')])
+    ok = ok and 'USING GIN (search_vector)' in sql and sql in get_create_schema_sql()
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 4: No DDL on migrated databases
+    print("Test 4: Search column checked once, DDL only when missing")
+    print("-" * 70)
+    present = FakeConnection(present=True)
+    ensure(present)
+    ensure(present)
+    ok = len(present.executed) == 1 and "information_schema.columns" in present.executed[0]
+    missing = FakeConnection(present=False)
+    ensure(missing)
+    ok = ok and missing.executed[-1] == sql
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+
+if __name__ == "__main__":
+    test_reference_search()
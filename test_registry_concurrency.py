@@ -0,0 +1,193 @@
+#!/usr/bin/env python3
+"""
+Test Script: Concurrent Data Type Probing and Prefetch
+
+Tests that:
+1. Availability probes for one material run concurrently
+2. Probe results are cached until invalidate()
+3. load_data_async() shares one load between concurrent requests
+4. when_all() reports results once every load finished
+5. prefetch() warms data caches without blocking
+6. Many background probes at once do not deadlock the shared pool
+7. A load queued behind prefetches is not kept waiting by them
+8. Cached availability is re-probed when a type's availability version changes
+"""
+
+import importlib
+import sys
+import threading
+import time
+import types
+from pathlib import Path
+
+# The data_types package needs QWidget only for type hints; stub PyQt6 and
+# load the package without its __init__ (which pulls in the Qt data types)
+if 'PyQt6' not in sys.modules:
+    qt = types.ModuleType('PyQt6')
+    qt.QtWidgets = types.ModuleType('PyQt6.QtWidgets')
+    qt.QtWidgets.QWidget = object
+    sys.modules['PyQt6'] = qt
+    sys.modules['PyQt6.QtWidgets'] = qt.QtWidgets
+package = types.ModuleType('data_types')
+package.__path__ = [str(Path(__file__).parent / 'Visualization/final_visualization/data_types')]
+sys.modules['data_types'] = package
+
+BaseDataType = importlib.import_module('data_types.base_data_type').BaseDataType
+DataTypeRegistry = importlib.import_module('data_types.registry').DataTypeRegistry
+
+
+class SlowType(BaseDataType):
+    """Data type whose probes and loads take a fixed time."""
+
+    def __init__(self, name, delay, materials):
+        super().__init__(name=name, category="experimental")
+        self.delay = delay
+        self.materials = set(materials)
+        self.probes = 0
+        self.loads = 0
+        self.lock = threading.Lock()
+
+    def can_load(self, material_name):
+        with self.lock:
+            self.probes += 1
+        time.sleep(self.delay)
+        return material_name in self.materials
+
+    def load_data(self, material_name):
+        with self.lock:
+            self.loads += 1
+        time.sleep(self.delay)
+        self.data_cache[material_name] = {'material': material_name, 'source': self.name}
+        return self.data_cache[material_name]
+
+    def get_plot_data(self, material_name):
+        return {}
+
+    def get_display_widget(self, material_name):
+        return None
+
+
+def test_registry_concurrency():
+    """Test concurrent registry."""
+
+    print("\n" + "="*70)
+    print("Concurrent Data Type Registry Test")
+    print("="*70 + "\n")
+
+    DataTypeRegistry.clear()
+    slow = [SlowType(f"Type {i}", 0.2, ["Copper"] if i % 2 else ["Copper", "Nickel"]) for i in range(4)]
+    for data_type in slow:
+        DataTypeRegistry.register(data_type)
+
+    # Test 1: Concurrent probes
+    print("Test 1: Four 0.2 s probes run concurrently")
+    print("-" * 70)
+    start = time.perf_counter()
+    available = DataTypeRegistry.get_available_for_material("Nickel")
+    elapsed = time.perf_counter() - start
+    ok = elapsed < 0.6 and [dt.name for dt in available['experimental']] == ["Type 0", "Type 2"]
+    print(f"  Probe time: {elapsed*1000:.0f} ms")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 2: Cache
+    print("Test 2: Cached until invalidated")
+    print("-" * 70)
+    start = time.perf_counter()
+    DataTypeRegistry.get_available_for_material("Nickel")
+    ok = time.perf_counter() - start < 0.05 and all(dt.probes == 1 for dt in slow)
+    DataTypeRegistry.invalidate("Nickel")
+    DataTypeRegistry.get_available_for_material("Nickel")
+    ok = ok and all(dt.probes == 2 for dt in slow)
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 3: Shared loads
+    print("Test 3: Concurrent load requests share one load")
+    print("-" * 70)
+    first = DataTypeRegistry.load_data_async(slow[0], "Copper")
+    second = DataTypeRegistry.load_data_async(slow[0], "Copper")
+    missing = DataTypeRegistry.load_data_async(slow[1], "Nickel")
+    ok = first is second and first.result()['source'] == "Type 0" and slow[0].loads == 1
+    ok = ok and missing.result() is None and slow[1].loads == 0
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 4: when_all
+    print("Test 4: when_all() after every load")
+    print("-" * 70)
+    done = threading.Event()
+    results = []
+
+    def callback(values):
+        results.extend(values)
+        done.set()
+
+    DataTypeRegistry.when_all([DataTypeRegistry.load_data_async(dt, "Copper") for dt in slow[2:]], callback)
+    ok = done.wait(2.0) and [r['source'] for r in results] == ["Type 2", "Type 3"]
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 5: Prefetch
+    print("Test 5: Prefetch returns immediately and warms caches")
+    print("-" * 70)
+    start = time.perf_counter()
+    DataTypeRegistry.prefetch(["Aluminum", "Copper", "Aluminum"])
+    returned = time.perf_counter() - start
+    deadline = time.time() + 3.0
+    while time.time() < deadline and not all("Copper" in dt.data_cache for dt in slow):
+        time.sleep(0.02)
+    ok = returned < 0.05 and all("Copper" in dt.data_cache for dt in slow)
+    ok = ok and not any("Aluminum" in dt.data_cache for dt in slow)
+    print(f"  Prefetch call: {returned*1000:.1f} ms")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 6: Saturated pool
+    print("Test 6: More background probes than pool workers finish")
+    print("-" * 70)
+    materials = [f"Alloy {i}" for i in range(20)]
+    futures = [DataTypeRegistry.probe_async(m) for m in materials]
+    deadline = time.time() + 5.0
+    finished = all(f.exception(timeout=max(0.0, deadline - time.time())) is None for f in futures)
+    ok = finished and all(f.result() == {} for f in futures)
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 7: Prefetch does not delay real loads
+    print("Test 7: Queued prefetch is promoted to the shared pool")
+    print("-" * 70)
+    DataTypeRegistry.prefetch([f"Queued {i}" for i in range(10)] + ["Nickel"])
+    start = time.perf_counter()
+    future = DataTypeRegistry.load_data_async(slow[0], "Nickel")
+    shared = DataTypeRegistry.load_data_async(slow[0], "Nickel") is future
+    result = future.result(timeout=3.0)
+    elapsed = time.perf_counter() - start
+    ok = shared and result['source'] == "Type 0" and elapsed < 0.6
+    print(f"  Load time: {elapsed*1000:.0f} ms")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 8: Versioned availability
+    print("Test 8: Availability follows the data type's version")
+    print("-" * 70)
+    DataTypeRegistry.clear()
+    listing = SlowType("Listing", 0.0, [])
+    listing.version = 1
+    listing.availability_version = lambda: listing.version
+    DataTypeRegistry.register(listing)
+    ok = DataTypeRegistry.get_available_for_material("Zinc") == {}
+    listing.materials.add("Zinc")
+    ok = ok and DataTypeRegistry.get_available_for_material("Zinc") == {}
+    listing.version = 2      # e.g. a new file appeared in the directory
+    available = DataTypeRegistry.get_available_for_material("Zinc")
+    ok = ok and available == {"experimental": [listing]} and listing.probes == 2
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    DataTypeRegistry.shutdown()
+    DataTypeRegistry.clear()
+
+
+if __name__ == "__main__":
+    test_registry_concurrency()
@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+"""
+Test Script: Retained Plot Updates
+
+Tests that:
+1. Adding a material within the current limits only blits
+2. Adding and removing a material touches only its own artists
+3. Update requests are coalesced through the scheduler
+4. A 30-material overlay updates without full redraws
+5. A foreign draw (resize, zoom) invalidates the background
+"""
+
+import importlib.util
+import time
+from pathlib import Path
+
+import numpy as np
+import matplotlib
+matplotlib.use('Agg')
+from matplotlib.figure import Figure
+from matplotlib.backends.backend_agg import FigureCanvasAgg
+
+# Load directly: the final_visualization package imports PyQt6
+_spec = importlib.util.spec_from_file_location(
+    'retained_plot', Path(__file__).parent / 'Visualization/final_visualization/retained_plot.py')
+retained_plot = importlib.util.module_from_spec(_spec)
+_spec.loader.exec_module(retained_plot)
+RetainedPlot = retained_plot.RetainedPlot
+
+
+class BlitCanvas(FigureCanvasAgg):
+    """Agg canvas with the blit() hook interactive backends provide."""
+
+    def blit(self, bbox=None):
+        pass
+
+
+def series(c0, s, color):
+    up = np.linspace(0.5, 3.0, 12)
+    return [
+        {'x': up, 'y': c0 + s * up, 'fmt': 'o', 'style': {'color': color, 'label': 'Exp'}},
+        {'x': up, 'y': c0 + s * up, 'fmt': '-', 'style': {'color': color}},
+    ]
+
+
+def make_plot(scheduler=None):
+    figure = Figure(figsize=(6, 4), dpi=80)
+    canvas = BlitCanvas(figure)
+    plot = RetainedPlot(figure, canvas, scheduler=scheduler)
+    ax = plot.add_axes('main', 111)
+    ax.set_xlim(0, 5)
+    ax.set_ylim(0, 20)
+    ax.set_autoscale_on(False)
+    plot.enable_legend('main')
+    return plot
+
+
+def test_retained_plot():
+    """Test retained plot."""
+
+    print("\n" + "="*70)
+    print("Retained Plot Test")
+    print("="*70 + "\n")
+
+    # Test 1: Blit only
+    print("Test 1: Adding within the limits blits")
+    print("-" * 70)
+    plot = make_plot()
+    plot.set_series('Copper', 'main', series(3.94, 1.49, 'C0'))
+    full = plot.full_draws
+    plot.set_series('Nickel', 'main', series(4.44, 1.60, 'C1'))
+    ok = full == 1 and plot.full_draws == 1 and plot.blits == 2
+    print(f"  Full draws: {plot.full_draws}, blits: {plot.blits}")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 2: Per-material artists
+    print("Test 2: Add/remove touches only that material")
+    print("-" * 70)
+    copper = list(plot.artists['Copper'])
+    plot.remove_material('Nickel')
+    ax = plot.axes['main']
+    ok = plot.artists['Copper'] == copper and all(line in ax.lines for line in copper)
+    ok = ok and 'Nickel' not in plot.artists and len(ax.lines) == 2
+    plot.set_color('Copper', 'C3')
+    ok = ok and all(line.get_color() == 'C3' for line in copper) and plot.full_draws == 1
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 3: Coalescing
+    print("Test 3: Requests coalesced into one update")
+    print("-" * 70)
+    queued = []
+    plot = make_plot(scheduler=queued.append)
+    for i in range(5):
+        plot.set_series(f"M{i}", 'main', series(3.0 + i, 1.5, f"C{i}"))
+    ok = len(queued) == 1 and plot.full_draws == 0
+    queued.pop()()
+    ok = ok and plot.full_draws == 1 and plot.blits == 1
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 4: 30-material overlay
+    print("Test 4: 30-material overlay updates by blitting")
+    print("-" * 70)
+    plot = make_plot()
+    for i in range(30):
+        plot.set_series(f"M{i}", 'main', series(2.0 + 0.3 * i, 1.2, f"C{i % 10}"))
+    start = time.perf_counter()
+    plot.set_series("M7", 'main', series(4.0, 1.3, 'C9'))
+    elapsed = time.perf_counter() - start
+    ok = plot.full_draws == 1 and len(plot.axes['main'].lines) == 60
+    print(f"  Update time: {elapsed*1000:.1f} ms")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 5: Foreign draw
+    print("Test 5: Foreign draw invalidates the background")
+    print("-" * 70)
+    plot.canvas.draw()
+    plot.set_color("M0", 'C5')
+    ok = plot.full_draws == 2
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+
+if __name__ == "__main__":
+    test_retained_plot()
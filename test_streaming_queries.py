@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+"""
+Test Script: Streaming Queries and Keyset Pages
+
+Tests that:
+1. stream_query uses a named WITH HOLD cursor and yields rows lazily
+2. Material pages continue from the last row with a (name, id) keyset
+3. iter_materials streams summary dictionaries
+4. The visualization service creates the (name, material_id) index once
+"""
+
+from db.database import stream_query
+from db.query import MaterialQuerier, MATERIAL_FIELDS
+from Visualization.visualization_service import VisualizationDataService
+
+
+class FakeCursor:
+    """Cursor over generated rows; counts rows handed out."""
+
+    def __init__(self, conn, name=None, withhold=False):
+        self.conn = conn
+        self.name = name
+        self.withhold = withhold
+        self.itersize = 1
+        self.produced = 0
+
+    def execute(self, query, params=None):
+        self.conn.executed.append((self.name, query, params))
+
+    def fetchone(self):
+        return {'present': self.conn.indexed}
+
+    def fetchall(self):
+        return [(i, f"X{i}", f"M{i:03d}", None, None, None, None) for i in range(3)]
+
+    def __iter__(self):
+        for i in range(self.conn.rows):
+            self.produced += 1
+            yield (i, f"X{i}", f"M{i:06d}", None, None, None, None)
+
+    def close(self):
+        pass
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.conn.closed_cursors.append(self.name)
+
+
+class FakeConnection:
+    def __init__(self, rows):
+        self.rows = rows
+        self.cursors = []
+        self.executed = []
+        self.closed_cursors = []
+        self.indexed = False
+        self.commits = 0
+        self.closed = False
+
+    def commit(self):
+        self.commits += 1
+
+    def rollback(self):
+        pass
+
+    def close(self):
+        self.closed = True
+
+    def cursor(self, name=None, withhold=False):
+        cursor = FakeCursor(self, name, withhold)
+        self.cursors.append(cursor)
+        return cursor
+
+
+def test_streaming_queries():
+    """Test streaming queries and keyset pages."""
+
+    print("\n" + "="*70)
+    print("Streaming Queries Test")
+    print("="*70 + "\n")
+
+    # Test 1: Named cursors
+    print("Test 1: Server-side cursor")
+    print("-" * 70)
+    conn = FakeConnection(rows=100000)
+    rows = stream_query(conn, "SELECT 1", batch_size=500)
+    first = next(rows)
+    cursor = conn.cursors[0]
+    ok = first[0] == 0 and cursor.produced == 1
+    ok = ok and cursor.name.startswith("stream_") and cursor.withhold and cursor.itersize == 500
+    rest = sum(1 for _ in rows)
+    ok = ok and rest == 99999 and conn.closed_cursors == [cursor.name]
+    other = FakeConnection(rows=1)
+    list(stream_query(other, "SELECT 1"))
+    ok = ok and other.cursors[0].name != cursor.name
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 2: Keyset pages
+    print("Test 2: Keyset pages")
+    print("-" * 70)
+    querier = MaterialQuerier.__new__(MaterialQuerier)
+    querier.conn = FakeConnection(rows=0)
+    page = querier.list_materials_page(limit=3)
+    _, first_sql, first_params = querier.conn.executed[-1]
+    querier.list_materials_page(limit=3, after=page[-1])
+    _, next_sql, next_params = querier.conn.executed[-1]
+    ok = first_params == (3,) and "WHERE" not in first_sql
+    ok = ok and "(name, material_id) > (%s, %s)" in next_sql and next_params == ("M002", 2, 3)
+    ok = ok and "OFFSET" not in next_sql and list(page[0]) == MATERIAL_FIELDS
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 3: Streaming materials
+    print("Test 3: iter_materials")
+    print("-" * 70)
+    querier.conn = FakeConnection(rows=5)
+    materials = list(querier.iter_materials())
+    ok = [m['name'] for m in materials] == [f"M{i:06d}" for i in range(5)]
+    ok = ok and querier.conn.cursors[0].name is not None
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 4: Listing index
+    print("Test 4: Material order index created once")
+    print("-" * 70)
+    service = VisualizationDataService.__new__(VisualizationDataService)
+    service._order_index_ready = None
+    service._connection = FakeConnection(rows=2)
+    list(service.iter_materials())
+    list(service.iter_materials())
+    creates = [q for _, q, _ in service._connection.executed if 'CREATE INDEX' in q]
+    checks = [q for _, q, _ in service._connection.executed if 'to_regclass' in q]
+    ok = len(checks) == 1 and len(creates) == 1
+    ok = ok and 'xml_finalized_materials(name, material_id)' in creates[0]
+    service._order_index_ready = None
+    service._connection = FakeConnection(rows=2)
+    service._connection.indexed = True
+    list(service.iter_materials())
+    ok = ok and not any('CREATE INDEX' in q for _, q, _ in service._connection.executed)
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+
+if __name__ == "__main__":
+    test_streaming_queries()
@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+"""
+Test Script: Frank-Kamenetskii Critical Temperature Tables
+
+Tests that:
+1. Solved critical temperatures satisfy delta(Tc) = delta_c
+2. Tc decreases with size and increases slab → cylinder → sphere
+3. Formulations borrow missing inputs from their surrogate and record the source
+4. Input hash is stable and changes with the inputs
+5. Long-format CSV output
+6. The storage table is checked once per connection and created only when missing
+"""
+
+import csv
+import os
+import tempfile
+
+import numpy as np
+
+from db.critical_temperature_storage import CriticalTemperatureStorage
+from physics.material_params import GAS_CONSTANT
+from physics.thermal_explosion import (
+    GEOMETRIES, build_tables, critical_temperature, input_hash, resolve_inputs, write_table_csv
+)
+
+
+# HMX-like single-step kinetics (SI)
+HMX = {'Ea': 220.5e3, 'lnZ': 48.7, 'Q': 2.09e6, 'k': 0.40, 'rho': 1900.0, 'cp': 1050.0}
+
+
+class FakeCursor:
+    def __init__(self, conn):
+        self.conn = conn
+
+    def execute(self, query, params=None):
+        self.conn.executed.append(query)
+
+    def fetchone(self):
+        return (self.conn.present,)
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        pass
+
+
+class FakeConnection:
+    def __init__(self, present):
+        self.present = present
+        self.executed = []
+
+    def cursor(self):
+        return FakeCursor(self)
+
+    def commit(self):
+        pass
+
+
+def test_thermal_explosion():
+    """Test critical temperature tables."""
+
+    print("\n" + "="*70)
+    print("Frank-Kamenetskii Critical Temperature Test")
+    print("="*70 + "\n")
+
+    # Test 1: FK criterion residual
+    print("Test 1: delta(Tc) equals delta_c")
+    print("-" * 70)
+    sizes = np.geomspace(1.0e-3, 1.0, 7)
+    worst = 0.0
+    for geometry, delta_c in GEOMETRIES.items():
+        tc = critical_temperature(HMX['Ea'], HMX['lnZ'], HMX['Q'], HMX['k'], HMX['rho'], sizes, delta_c)
+        delta = (sizes ** 2 * HMX['rho'] * HMX['Q'] * HMX['Ea'] * np.exp(HMX['lnZ'] - HMX['Ea'] / (GAS_CONSTANT * tc))
+                 / (HMX['k'] * GAS_CONSTANT * tc ** 2))
+        worst = max(worst, float(np.max(np.abs(delta / delta_c - 1.0))))
+    ok = worst < 1.0e-8
+    print(f"  Max relative residual: {worst:.2e}")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 2: Size and geometry ordering
+    print("Test 2: Tc falls with size; slab < cylinder < sphere")
+    print("-" * 70)
+    resolved = resolve_inputs({'HMX': HMX}, surrogates={})
+    columns = build_tables(resolved, sizes=sizes)
+    tc = {g: columns['Tc_K'][columns['geometry'] == g] for g in GEOMETRIES}
+    ok = all(bool(np.all(np.diff(t) < 0.0)) for t in tc.values())
+    ok = ok and bool(np.all(tc['slab'] < tc['cylinder'])) and bool(np.all(tc['cylinder'] < tc['sphere']))
+    ok = ok and not np.isnan(columns['Tc_K']).any()
+    print(f"  Sphere Tc: {tc['sphere'][0] - 273.15:.1f} °C @ 1 mm → {tc['sphere'][-1] - 273.15:.1f} °C @ 1 m")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 3: Surrogate inputs
+    print("Test 3: Formulation inputs borrowed from surrogate")
+    print("-" * 70)
+    formulation = {'Ea': None, 'lnZ': None, 'Q': None, 'k': 0.23, 'rho': 1840.0, 'cp': None}
+    orphan = {'Ea': None, 'lnZ': None, 'Q': None, 'k': 0.3, 'rho': 2000.0, 'cp': 1000.0}
+    resolved = resolve_inputs({'HMX': HMX, 'PBX': formulation, 'NEW': orphan}, surrogates={'PBX': 'HMX'})
+    pbx = resolved['PBX']
+    ok = not pbx['missing'] and pbx['sources']['Ea'] == 'HMX' and pbx['sources']['k'] == 'PBX'
+    ok = ok and pbx['values']['rho'] == 1840.0 and resolved['NEW']['missing'] == ['Ea', 'lnZ', 'Q']
+    columns = build_tables(resolved, sizes=sizes)
+    ok = ok and set(columns['material']) == {'HMX', 'PBX'}
+    ok = ok and set(columns['kinetics_source'][columns['material'] == 'PBX']) == {'HMX'}
+    ok = ok and set(columns['thermal_source'][columns['material'] == 'PBX']) == {'HMX,PBX'}
+    print(f"  PBX sources: {pbx['sources']}")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 4: Input hash
+    print("Test 4: Input hash stable and data sensitive")
+    print("-" * 70)
+    changed = resolve_inputs({'HMX': dict(HMX, k=0.41)}, surrogates={})['HMX']
+    ok = input_hash(resolved['HMX']) == input_hash(resolve_inputs({'HMX': HMX}, surrogates={})['HMX'])
+    ok = ok and input_hash(changed) != input_hash(resolved['HMX'])
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 5: CSV output
+    print("Test 5: Long-format CSV output")
+    print("-" * 70)
+    with tempfile.TemporaryDirectory() as tmp:
+        path = os.path.join(tmp, 'pbx.csv')
+        write_table_csv(columns, path, 'PBX')
+        with open(path, newline='') as f:
+            rows = list(csv.DictReader(f))
+    ok = len(rows) == len(GEOMETRIES) * len(sizes) and rows[0]['material'] == 'PBX'
+    print(f"  {len(rows)} rows written")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 6: One-time schema check
+    print("Test 6: Storage table checked once per connection")
+    print("-" * 70)
+    conn = FakeConnection(present=False)
+    CriticalTemperatureStorage(conn)
+    CriticalTemperatureStorage(conn)
+    creates = [q for q in conn.executed if 'CREATE TABLE' in q]
+    checks = [q for q in conn.executed if 'to_regclass' in q]
+    ok = len(checks) == 1 and len(creates) == 1
+    existing = FakeConnection(present=True)
+    CriticalTemperatureStorage(existing)
+    ok = ok and not any('CREATE TABLE' in q for q in existing.executed)
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+
+if __name__ == "__main__":
+    test_thermal_explosion()
@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+"""
+Test Script: Monte Carlo Uncertainty Propagation
+
+Tests that:
+1. Every stored entry of a multi-reference parameter is collected
+2. Empirical sampling only draws stored entries; single entries stay fixed
+3. Percentile bands bracket the curves of the extreme entries
+4. Results are reproducible and independent of the number of workers
+5. Missing parameters raise ValueError
+6. CSV band output
+7. Plot band output (median and 68/95% bands)
+"""
+
+import csv
+import os
+import tempfile
+
+import numpy as np
+
+from parser.xml_parser import parse_material_xml
+from physics.uncertainty import (
+    collect_entries, draw_samples, evaluate_eos, propagate, write_band, write_band_csv
+)
+
+
+def test_uncertainty():
+    """Test uncertainty engine."""
+
+    print("\n" + "="*70)
+    print("Monte Carlo Uncertainty Test")
+    print("="*70 + "\n")
+
+    hmx = parse_material_xml('xml/HMX.xml')
+
+    # Test 1: Entry collection
+    print("Test 1: All IsothermalBulkModulus entries collected for HMX")
+    print("-" * 70)
+    entries = collect_entries(hmx, 'eos')
+    ok = len(entries['K0']) == 10 and np.isclose(entries['K0'].min(), 5.3e9) and np.isclose(entries['K0'].max(), 16.5e9)
+    print(f"  K0: {len(entries['K0'])} entries, K0': {entries['K0_prime']}")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 2: Sampling
+    print("Test 2: Empirical prior draws stored entries only")
+    print("-" * 70)
+    samples = draw_samples(entries, 5000, np.random.default_rng(0))
+    ok = set(np.unique(samples['K0'])) <= set(entries['K0']) and len(np.unique(samples['K0'])) == len(np.unique(entries['K0']))
+    ok = ok and np.all(samples['K0_prime'] == entries['K0_prime'][0])
+    uniform = draw_samples(entries, 5000, np.random.default_rng(0), prior='uniform')
+    ok = ok and uniform['K0'].min() >= 5.3e9 and uniform['K0'].max() <= 16.5e9
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 3: Bands
+    print("Test 3: Bands bracketed by extreme-entry curves")
+    print("-" * 70)
+    result = propagate(entries, 'eos', n_samples=20000, seed=3)
+    extremes = evaluate_eos({'K0': np.array([entries['K0'].min(), entries['K0'].max()]),
+                             'K0_prime': np.repeat(entries['K0_prime'], 2)}, result['x'])
+    bands = result['percentiles']
+    ok = bool(np.all(extremes[0] <= bands[2.5] + 1.0e-12)) and bool(np.all(bands[97.5] <= extremes[1] + 1.0e-12))
+    ok = ok and bool(np.all(bands[2.5] <= bands[50.0])) and bool(np.all(bands[50.0] <= bands[97.5]))
+    ok = ok and bands[97.5][-1] > 2.0 * bands[2.5][-1]
+    print(f"  P at V/V0 = {result['x'][-1]:.2f}: {bands[2.5][-1]:.2f} .. {bands[97.5][-1]:.2f} GPa (95%)")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 4: Reproducibility
+    print("Test 4: Same seed, same bands with 1 or 2 workers")
+    print("-" * 70)
+    hugoniot = collect_entries(hmx, 'hugoniot')
+    a = propagate(hugoniot, 'hugoniot', n_samples=5000, seed=7, chunk_size=1000)
+    b = propagate(hugoniot, 'hugoniot', n_samples=5000, seed=7, chunk_size=1000, workers=2)
+    c = propagate(hugoniot, 'hugoniot', n_samples=5000, seed=8, chunk_size=1000)
+    ok = all(np.array_equal(a['percentiles'][p], b['percentiles'][p]) for p in a['percentiles'])
+    ok = ok and np.array_equal(a['mean'], b['mean']) and not np.array_equal(a['mean'], c['mean'])
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 5: Missing parameters
+    print("Test 5: Missing parameters raise ValueError")
+    print("-" * 70)
+    try:
+        propagate(dict(hugoniot, s=np.array([])), 'hugoniot', n_samples=10)
+        ok = False
+    except ValueError:
+        ok = True
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 6: CSV output
+    print("Test 6: Band CSV output")
+    print("-" * 70)
+    with tempfile.TemporaryDirectory() as tmp:
+        path = os.path.join(tmp, 'band.csv')
+        write_band_csv(result, path, 'HMX')
+        with open(path, newline='') as f:
+            rows = list(csv.DictReader(f))
+    ok = len(rows) == len(result['x']) and rows[-1]['material'] == 'HMX' and 'p97.5' in rows[0]
+    print(f"  {len(rows)} rows written")
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+    # Test 7: Plot output
+    print("Test 7: Band plot output")
+    print("-" * 70)
+    with tempfile.TemporaryDirectory() as tmp:
+        path = os.path.join(tmp, 'band.png')
+        write_band(result, path, 'HMX')
+        with open(path, 'rb') as f:
+            ok = f.read(8) == b'\x89PNG\r\n\x1a\n'
+    print(f"  Result: {'PASS ✓' if ok else 'FAIL ✗'}\n")
+    assert ok
+
+
+if __name__ == "__main__":
+    test_uncertainty()